@@ -12,6 +12,7 @@ PAGE 0 :
    RAMLS2      		: origin = 0x009000, length = 0x000800
    RAMLS3      		: origin = 0x009800, length = 0x000800
    RAMLS4      		: origin = 0x00A000, length = 0x000800
+   RAMLS7      		: origin = 0x00B800, length = 0x000800     /* CLA data, loaded from Flash */
    RESET           	: origin = 0x3FFFC0, length = 0x000002
 
    /* Flash sectors */
@@ -57,11 +58,12 @@ PAGE 1 :
 
    BOOT_RSVD       : origin = 0x000002, length = 0x0000F1     /* Part of M0, BOOT rom will use this for stack */
    RAMM1           : origin = 0x000400, length = 0x0003F8     /* on-chip RAM block M1 */
+   CLA1_MSGRAMLOW  : origin = 0x001480, length = 0x000080     /* CLA to CPU message RAM */
+   CLA1_MSGRAMHIGH : origin = 0x001500, length = 0x000080     /* CPU to CLA message RAM */
 //   RAMM1_RSVD      : origin = 0x0007F8, length = 0x000008     /* Reserve and do not use for code as per the errata advisory "Memory: Prefetching Beyond Valid Memory" */
 
    RAMLS5      : origin = 0x00A800, length = 0x000800
    RAMLS6      : origin = 0x00B000, length = 0x000800
-   RAMLS7      : origin = 0x00B800, length = 0x000800
 
    RAMGS0      : origin = 0x00C000, length = 0x002000
    RAMGS1      : origin = 0x00E000, length = 0x002000
@@ -101,10 +103,25 @@ SECTIONS
    ramgs0           : > RAMGS0,    PAGE = 1
    ramgs1           : > RAMGS1,    PAGE = 1
 
+   /* DEFAULT_ISR() capture, kept across resets (FAULT_RECORD.h) */
+   faultrec         : > RAMLS6,    PAGE = 1, TYPE = NOINIT
+
+   /* Last good MEP scale factor for warm starts (MEP_CACHE.h) */
+   mepcache         : > RAMLS6,    PAGE = 1, TYPE = NOINIT
+
+   /* Datalogger capture buffers, DLOG_CHANNELS x DLOG_DEPTH floats (DATALOG.h) */
+   dlogbuf          : > RAMGS2,    PAGE = 1
+
+   Cla1ToCpuMsgRAM  : > CLA1_MSGRAMLOW,   PAGE = 1
+   CpuToCla1MsgRAM  : > CLA1_MSGRAMHIGH,  PAGE = 1
+
  
+   /* ISRs and per-period control code (CODE_SECTION ".TI.ramfunc") run from
+      LSx RAM without Flash wait states; InitSysCtrl() copies them. Init and
+      background code stays in .text. See FLASH_BENCH.h for the cost. */
 #if defined(__TI_EABI__) 
-   .TI.ramfunc      : LOAD = FLASH_BANK0_SEC1,
-                      RUN = RAMLS0,
+   .TI.ramfunc      : LOAD = FLASH_BANK0_SEC7,
+                      RUN = RAMLS0 | RAMLS1 | RAMLS2 | RAMLS3,
                       LOAD_START(RamfuncsLoadStart),
                       LOAD_SIZE(RamfuncsLoadSize),
                       LOAD_END(RamfuncsLoadEnd),
@@ -113,8 +130,8 @@ SECTIONS
                       RUN_END(RamfuncsRunEnd),
                       PAGE = 0, ALIGN(4)
 #else					  
-   .TI.ramfunc      : LOAD = FLASH_BANK0_SEC1,
-                      RUN = RAMLS0,
+   .TI.ramfunc      : LOAD = FLASH_BANK0_SEC7,
+                      RUN = RAMLS0 | RAMLS1 | RAMLS2 | RAMLS3,
                       LOAD_START(_RamfuncsLoadStart),
                       LOAD_SIZE(_RamfuncsLoadSize),
                       LOAD_END(_RamfuncsLoadEnd),
@@ -124,6 +141,37 @@ SECTIONS
                       PAGE = 0, ALIGN(4)
 #endif
 
+   /* CLA program and constants are copied to RAMLS4/RAMLS7 by initCLA() */
+#if defined(__TI_EABI__)
+   Cla1Prog         : LOAD = FLASH_BANK0_SEC6,
+                      RUN = RAMLS4,
+                      LOAD_START(Cla1ProgLoadStart),
+                      LOAD_SIZE(Cla1ProgLoadSize),
+                      RUN_START(Cla1ProgRunStart),
+                      PAGE = 0, ALIGN(4)
+   .const_cla       : LOAD = FLASH_BANK0_SEC6,
+                      RUN = RAMLS7,
+                      LOAD_START(Cla1ConstLoadStart),
+                      LOAD_SIZE(Cla1ConstLoadSize),
+                      RUN_START(Cla1ConstRunStart),
+                      PAGE = 0, ALIGN(4)
+#else
+   Cla1Prog         : LOAD = FLASH_BANK0_SEC6,
+                      RUN = RAMLS4,
+                      LOAD_START(_Cla1ProgLoadStart),
+                      LOAD_SIZE(_Cla1ProgLoadSize),
+                      RUN_START(_Cla1ProgRunStart),
+                      PAGE = 0, ALIGN(4)
+   .const_cla       : LOAD = FLASH_BANK0_SEC6,
+                      RUN = RAMLS7,
+                      LOAD_START(_Cla1ConstLoadStart),
+                      LOAD_SIZE(_Cla1ConstLoadSize),
+                      RUN_START(_Cla1ConstRunStart),
+                      PAGE = 0, ALIGN(4)
+#endif
+   .scratchpad      : > RAMLS7,    PAGE = 0
+   .bss_cla         : > RAMLS7,    PAGE = 0
+
 }
 
 /*
@@ -12,6 +12,7 @@ PAGE 0 :
    RAMLS2      		: origin = 0x009000, length = 0x000800
    RAMLS3      		: origin = 0x009800, length = 0x000800
    RAMLS4      		: origin = 0x00A000, length = 0x000800
+   RAMGS3      		: origin = 0x012000, length = 0x001FF8     /* Default ISR, kept out of LSx */
    RESET           	: origin = 0x3FFFC0, length = 0x000002
 
  /* Flash sectors: you can use FLASH for program memory when the RAM is filled up*/
@@ -55,6 +56,8 @@ PAGE 1 :
 
    BOOT_RSVD       : origin = 0x000002, length = 0x0000F1     /* Part of M0, BOOT rom will use this for stack */
    RAMM1           : origin = 0x000400, length = 0x0003F8     /* on-chip RAM block M1 */
+   CLA1_MSGRAMLOW  : origin = 0x001480, length = 0x000080     /* CLA to CPU message RAM */
+   CLA1_MSGRAMHIGH : origin = 0x001500, length = 0x000080     /* CPU to CLA message RAM */
 //   RAMM1_RSVD      : origin = 0x0007F8, length = 0x000008     /* Reserve and do not use for code as per the errata advisory "Memory: Prefetching Beyond Valid Memory" */
 
    RAMLS5      : origin = 0x00A800, length = 0x000800
@@ -64,7 +67,6 @@ PAGE 1 :
    RAMGS0      : origin = 0x00C000, length = 0x002000
    RAMGS1      : origin = 0x00E000, length = 0x002000
    RAMGS2      : origin = 0x010000, length = 0x002000
-   RAMGS3      : origin = 0x012000, length = 0x001FF8
 //   RAMGS3_RSVD : origin = 0x013FF8, length = 0x000008     /* Reserve and do not use for code as per the errata advisory "Memory: Prefetching Beyond Valid Memory" */
 }
 
@@ -72,12 +74,16 @@ PAGE 1 :
 SECTIONS
 {
    codestart        : > BEGIN,     PAGE = 0
-   .TI.ramfunc      : > RAMM0,      PAGE = 0
-   .text            : >> RAMLS0 | RAMLS1 | RAMLS2 | RAMLS3 | RAMLS4,   PAGE = 0
+   .TI.ramfunc      : >> RAMLS0 | RAMLS1 | RAMLS2 | RAMLS3,   PAGE = 0
+   .text            : >> RAMLS0 | RAMLS1 | RAMLS2 | RAMLS3,   PAGE = 0
    .cinit           : > RAMM0,     PAGE = 0
    .switch          : > RAMM0,     PAGE = 0
    .reset           : > RESET,     PAGE = 0, TYPE = DSECT /* not used, */
 
+   /* DEFAULT_ISR() only runs on a fault; keep it out of the LSx RAM that
+      holds .text and .TI.ramfunc */
+   defaultisr       : { f28004x_defaultisr.obj (.text:retain) } > RAMGS3,   PAGE = 0
+
    .stack           : > RAMM1,     PAGE = 1
 
 #if defined(__TI_EABI__)
@@ -98,6 +104,24 @@ SECTIONS
 
    ramgs0           : > RAMGS0,    PAGE = 1
    ramgs1           : > RAMGS1,    PAGE = 1  
+
+   /* CLA program in RAMLS4, CLA data in RAMLS7 (see initCLA()) */
+   Cla1Prog         : > RAMLS4,    PAGE = 0
+   .scratchpad      : > RAMLS7,    PAGE = 1
+   .bss_cla         : > RAMLS7,    PAGE = 1
+   .const_cla       : > RAMLS7,    PAGE = 1
+
+   /* DEFAULT_ISR() capture, kept across resets (FAULT_RECORD.h) */
+   faultrec         : > RAMLS6,    PAGE = 1, TYPE = NOINIT
+
+   /* Last good MEP scale factor for warm starts (MEP_CACHE.h) */
+   mepcache         : > RAMLS6,    PAGE = 1, TYPE = NOINIT
+
+   /* Datalogger capture buffers, DLOG_CHANNELS x DLOG_DEPTH floats (DATALOG.h) */
+   dlogbuf          : > RAMGS2,    PAGE = 1
+
+   Cla1ToCpuMsgRAM  : > CLA1_MSGRAMLOW,   PAGE = 1
+   CpuToCla1MsgRAM  : > CLA1_MSGRAMHIGH,  PAGE = 1
 }
 
 /*
@@ -1,7 +1,8 @@
 //
-// initADC - Function to configure and power up ADCA.
+// initADCPowerUp - Configure ADCA and ADCB and start their power-up. The
+//                  ADCs need 1 ms to settle before the first conversion.
 //
-void initADC(void)
+void initADCPowerUp(void)
 {
     //
     // Setup VREF as internal
@@ -16,18 +17,32 @@ void initADC(void)
     // Set ADCCLK divider to /4
     //
     AdcaRegs.ADCCTL2.bit.PRESCALE = 6;
+    AdcbRegs.ADCCTL2.bit.PRESCALE = 6;
 
     //
     // Set pulse positions to late
     //
     AdcaRegs.ADCCTL1.bit.INTPULSEPOS = 1;
+    AdcbRegs.ADCCTL1.bit.INTPULSEPOS = 1;
 
     //
-    // Power up the ADC and then delay for 1 ms
+    // Power up the ADCs
     //
     AdcaRegs.ADCCTL1.bit.ADCPWDNZ = 1;
+    AdcbRegs.ADCCTL1.bit.ADCPWDNZ = 1;
     EDIS;
+}
+
+//
+// initADC - Function to configure and power up ADCA and ADCB.
+//
+void initADC(void)
+{
+    initADCPowerUp();
 
+    //
+    // Delay for 1 ms to allow the ADCs to power up
+    //
     DELAY_US(1000);
 }
 
@@ -87,6 +102,131 @@ void initADCSOC(void)
     EDIS;
 }
 
+//
+// ADC sequencer - ADCA and ADCB SOC0..SOCn convert a channel list each on
+// every ePWM1 SOCA. ADCA and ADCB convert in parallel, so the ADCA list must
+// be at least as long as the ADCB list; the end of the last ADCA SOC raises
+// one ADCA INT1 for the whole burst. The ISR calls adcSeqCapture(), which
+// copies the burst into the idle half of the adcFrame[] ping-pong buffer and
+// then publishes it, and the control loop reads complete frames with
+// adcSeqReadFrame().
+//
+#define ADC_SEQ_MAX_SOC         16
+#define ADC_SEQ_TRIG_EPWM1_SOCA 5       // TRIGSEL - ePWM1 SOCA
+#define ADC_SEQ_ACQPS           9       // Sample window is 10 SYSCLK cycles
+
+//
+// ADCSOCxCTL image: CHSEL at bit 15, TRIGSEL at bit 20, ACQPS at bit 0
+//
+#define ADC_SEQ_SOCCTL(ch)                                                  \
+    (((uint32_t)ADC_SEQ_TRIG_EPWM1_SOCA << 20) | ((uint32_t)(ch) << 15) |   \
+     ADC_SEQ_ACQPS)
+
+typedef struct
+{
+    uint16_t a[ADC_SEQ_MAX_SOC];        // ADCA results in SOC order
+    uint16_t b[ADC_SEQ_MAX_SOC];        // ADCB results in SOC order
+} ADC_FRAME;
+
+ADC_FRAME adcFrame[2];                  // Ping-pong result frames
+volatile uint16_t adcFrameReady;        // Index of the last complete frame
+volatile uint16_t adcFrameCount;        // # of frames published
+uint16_t adcSeqCountA, adcSeqCountB;    // # of SOCs used on ADCA / ADCB
+
+//
+// initADCSequencer - Configure ADCA SOC0..countA-1 and ADCB SOC0..countB-1
+//                    to convert chA[] and chB[] on ePWM1 SOCA, with one ADCA
+//                    INT1 at the end of the burst. 1 <= countA <= 16 and
+//                    countB <= countA.
+//
+void initADCSequencer(const uint16_t *chA, uint16_t countA,
+                      const uint16_t *chB, uint16_t countB)
+{
+    uint16_t i;
+
+    EALLOW;
+
+    for(i = 0; i < countA; i++)
+    {
+        (&AdcaRegs.ADCSOC0CTL)[i].all = ADC_SEQ_SOCCTL(chA[i]);
+    }
+
+    for(i = 0; i < countB; i++)
+    {
+        (&AdcbRegs.ADCSOC0CTL)[i].all = ADC_SEQ_SOCCTL(chB[i]);
+    }
+
+    AdcaRegs.ADCINTSEL1N2.bit.INT1SEL = countA - 1; // End of last SOC sets
+                                                    // INT1 flag
+    AdcaRegs.ADCINTSEL1N2.bit.INT1E = 1;   // Enable INT1 flag
+    AdcaRegs.ADCINTFLGCLR.bit.ADCINT1 = 1; // Make sure INT1 flag is cleared
+
+    EDIS;
+
+    adcSeqCountA = countA;
+    adcSeqCountB = countB;
+    adcFrameReady = 0;
+    adcFrameCount = 0;
+}
+
+//
+// Part of the ADCA INT1 ISR path, runs from RAM
+//
+#pragma CODE_SECTION(adcSeqCapture, ".TI.ramfunc");
+
+//
+// adcSeqCapture - Copy the finished burst into the idle frame and publish
+//                 it. Call from the ADCA INT1 ISR.
+//
+void adcSeqCapture(void)
+{
+    ADC_FRAME *frame;
+    uint16_t next, i;
+
+    next = adcFrameReady ^ 1;
+    frame = &adcFrame[next];
+
+    for(i = 0; i < adcSeqCountA; i++)
+    {
+        frame->a[i] = (&AdcaResultRegs.ADCRESULT0)[i];
+    }
+
+    for(i = 0; i < adcSeqCountB; i++)
+    {
+        frame->b[i] = (&AdcbResultRegs.ADCRESULT0)[i];
+    }
+
+    adcFrameReady = next;
+    adcFrameCount++;
+}
+
+//
+// adcSeqReadFrame - Copy the most recent complete frame into dst. The frame
+//                   being copied is only rewritten two bursts later, so the
+//                   copy is retried only if that happened while copying.
+//
+void adcSeqReadFrame(ADC_FRAME *dst)
+{
+    uint16_t count, i;
+    const ADC_FRAME *src;
+
+    do
+    {
+        count = adcFrameCount;
+        src = &adcFrame[adcFrameReady];
+
+        for(i = 0; i < adcSeqCountA; i++)
+        {
+            dst->a[i] = src->a[i];
+        }
+
+        for(i = 0; i < adcSeqCountB; i++)
+        {
+            dst->b[i] = src->b[i];
+        }
+    } while((uint16_t)(adcFrameCount - count) > 1);
+}
+
 //
 // adcA1ISR - ADC A Interrupt 1 ISR
 //
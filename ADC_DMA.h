@@ -0,0 +1,146 @@
+#ifndef ADC_DMA_H
+#define ADC_DMA_H
+
+//
+// DMA-driven ADC capture.
+//
+// DMA CH1 is triggered by ADCA INT1 (end of the SOC burst started by ePWM1
+// SOCA) and moves ADCRESULT0..n-1 into the adcDmaBuf[] circular buffer in
+// RAMGS0 with no CPU involvement. The buffer is split into two halves, one
+// DMA transfer per half, and the CPU is only interrupted when a transfer
+// starts: at that point the previous half is complete and the ISR points
+// the DMA shadow destination at the half after the current one.
+//
+// Use with initADC() and initADCSOC()/initADCSequencer(); the ADCA INT1
+// flag is switched to continuous mode so it keeps triggering the DMA
+// without being cleared, and ADCA1_INT must not be enabled in the PIE.
+//
+
+//
+// Defines
+//
+#define ADC_DMA_BUF_SIZE        512     // Words, two halves
+#define ADC_DMA_HALF_SIZE       (ADC_DMA_BUF_SIZE / 2)
+#define ADC_DMA_TRIG_ADCAINT1   1       // DMACHSRCSEL - ADCA INT1
+#define ADC_DMA_ADDR(p)         ((uint32_t)(uintptr_t)(p))  // DMA address
+
+//
+// Globals
+//
+#pragma DATA_SECTION(adcDmaBuf, "ramgs0");
+uint16_t adcDmaBuf[ADC_DMA_BUF_SIZE];   // Circular capture buffer
+volatile uint16_t adcDmaHalf;           // Last completed half (0 or 1)
+volatile uint16_t adcDmaEvents;         // # of completed halves
+uint16_t adcDmaXfer;                    // # of DMA transfers started
+
+//
+// initADCDMA - Configure DMA CH1 to copy socCount ADCA results per trigger
+//              into adcDmaBuf[]. ADC_DMA_HALF_SIZE must be a multiple of
+//              socCount.
+//
+void initADCDMA(uint16_t socCount)
+{
+    EALLOW;
+
+    //
+    // Let ADCA INT1 pulse on every burst without the CPU clearing the flag
+    //
+    AdcaRegs.ADCINTSEL1N2.bit.INT1CONT = 1;
+
+    DmaRegs.DMACTRL.bit.HARDRESET = 1;
+    __asm(" NOP");
+    DmaRegs.DEBUGCTRL.bit.FREE = 1;         // Keep running on emulation halt
+
+    DmaClaSrcSelRegs.DMACHSRCSEL1.bit.CH1 = ADC_DMA_TRIG_ADCAINT1;
+
+    //
+    // One burst per trigger: ADCRESULT0..socCount-1, then back to ADCRESULT0
+    //
+    DmaRegs.CH1.BURST_SIZE = socCount - 1;
+    DmaRegs.CH1.SRC_BURST_STEP = 1;
+    DmaRegs.CH1.DST_BURST_STEP = 1;
+
+    //
+    // One transfer per buffer half
+    //
+    DmaRegs.CH1.TRANSFER_SIZE = (ADC_DMA_HALF_SIZE / socCount) - 1;
+    DmaRegs.CH1.SRC_TRANSFER_STEP = -(int16_t)(socCount - 1);
+    DmaRegs.CH1.DST_TRANSFER_STEP = 1;
+
+    //
+    // No wrapping inside a transfer
+    //
+    DmaRegs.CH1.SRC_WRAP_SIZE = 0xFFFF;
+    DmaRegs.CH1.SRC_WRAP_STEP = 0;
+    DmaRegs.CH1.DST_WRAP_SIZE = 0xFFFF;
+    DmaRegs.CH1.DST_WRAP_STEP = 0;
+
+    DmaRegs.CH1.SRC_BEG_ADDR_SHADOW = ADC_DMA_ADDR(&AdcaResultRegs.ADCRESULT0);
+    DmaRegs.CH1.SRC_ADDR_SHADOW = ADC_DMA_ADDR(&AdcaResultRegs.ADCRESULT0);
+    DmaRegs.CH1.DST_BEG_ADDR_SHADOW = ADC_DMA_ADDR(&adcDmaBuf[0]);
+    DmaRegs.CH1.DST_ADDR_SHADOW = ADC_DMA_ADDR(&adcDmaBuf[0]);
+
+    DmaRegs.CH1.MODE.bit.PERINTSEL = 1;
+    DmaRegs.CH1.MODE.bit.PERINTE = 1;       // Peripheral trigger enable
+    DmaRegs.CH1.MODE.bit.ONESHOT = 0;       // One burst per trigger
+    DmaRegs.CH1.MODE.bit.CONTINUOUS = 1;    // Re-arm after each transfer
+    DmaRegs.CH1.MODE.bit.DATASIZE = 0;      // 16-bit words
+    DmaRegs.CH1.MODE.bit.CHINTMODE = 0;     // Interrupt at transfer start
+    DmaRegs.CH1.MODE.bit.CHINTE = 1;
+
+    DmaRegs.CH1.CONTROL.bit.PERINTCLR = 1;
+    DmaRegs.CH1.CONTROL.bit.ERRCLR = 1;
+
+    EDIS;
+
+    adcDmaHalf = 0;
+    adcDmaEvents = 0;
+    adcDmaXfer = 0;
+}
+
+//
+// startADCDMA - Start DMA CH1
+//
+void startADCDMA(void)
+{
+    EALLOW;
+    DmaRegs.CH1.CONTROL.bit.RUN = 1;
+    EDIS;
+}
+
+//
+// ISR runs from RAM
+//
+#pragma CODE_SECTION(adcDmaISR, ".TI.ramfunc");
+
+//
+// adcDmaISR - DMA CH1 ISR, called when a transfer starts
+//
+__interrupt void adcDmaISR(void)
+{
+    uint32_t next;
+
+    //
+    // The transfer that just started fills half (adcDmaXfer & 1); the one
+    // before it is complete
+    //
+    if(adcDmaXfer != 0)
+    {
+        adcDmaHalf = (adcDmaXfer - 1) & 1;
+        adcDmaEvents++;
+    }
+    adcDmaXfer++;
+
+    //
+    // Queue the other half for the next transfer
+    //
+    next = ADC_DMA_ADDR(&adcDmaBuf[(adcDmaXfer & 1) * ADC_DMA_HALF_SIZE]);
+    EALLOW;
+    DmaRegs.CH1.DST_BEG_ADDR_SHADOW = next;
+    DmaRegs.CH1.DST_ADDR_SHADOW = next;
+    EDIS;
+
+    PieCtrlRegs.PIEACK.all = PIEACK_GROUP7;
+}
+
+#endif  // ADC_DMA_H
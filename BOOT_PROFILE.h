@@ -0,0 +1,213 @@
+#ifndef BOOT_PROFILE_H
+#define BOOT_PROFILE_H
+
+//
+// Boot-stage timestamps and fast boot.
+//
+// bootStart() clears bootStamp[] and stamps BOOT_ID_START; bootStage(id)
+// then records CPU Timer 1 (TIMEBASE.h) at the end of each boot stage.
+// bootReport() converts the stamps to microseconds since main() in
+// bootTime[] for the debugger. initTimebase() and bootStart() must be the
+// first calls in main(). Counts taken before the PLL stage run on INTOSC2,
+// the clock the device comes out of reset on, and are converted at
+// BOOT_PRE_PLL_HZ. The oscillator trim limits their accuracy. Part of the
+// PLL stage itself runs on the crystal, so BOOT_ID_PLL may read long.
+//
+// Stages that a build does not run keep a zero stamp, e.g. BOOT_ID_CLOCKS
+// and BOOT_ID_ADC_ON without FAST_BOOT. On the C28x the COFF startup does
+// not zero globals, so this relies on bootStart().
+//
+// With FAST_BOOT set, bootInitSysCtrl() replaces InitSysCtrl():
+//
+//   - only the peripheral clocks in bootPeripheralClocks() are turned on
+//   - the ADCs are powered up before the PLL is started, and bootAdcWait()
+//     only waits out what is left of the 1 ms settling time after the PLL
+//     lock and the PIE setup, instead of initADC()'s fixed DELAY_US(1000)
+//   - bootSeedScaleFactor() loads HRMSTEP with a known MEP scale factor,
+//     the cached one from before a warm reset (MEP_CACHE.h) or else
+//     BOOT_MEP_SF_DEFAULT, so HRPWM can start before the first full SFO()
+//     calibration; the background SFO task replaces it on completion
+//
+
+#include <string.h>
+
+#ifndef FAST_BOOT
+#define FAST_BOOT               1       // 0 = InitSysCtrl(), blocking SFO()
+#endif
+
+//
+// Defines
+//
+#define BOOT_PRE_PLL_HZ         10000000UL  // INTOSC2, SYSCLK out of reset
+#define BOOT_SYSCLK_HZ          100000000UL
+#define BOOT_ADC_SETTLE_US      1000
+#define BOOT_MEP_SF_DEFAULT     60          // Typical MEP steps per SYSCLK
+
+#define BOOT_ID_START           0       // main() entry
+#define BOOT_ID_CLOCKS          1       // Watchdog, Flash, peripheral clocks
+#define BOOT_ID_ADC_ON          2       // ADC power-up started (fast boot)
+#define BOOT_ID_PLL             3       // PLL locked, SYSCLK at 100 MHz
+#define BOOT_ID_INIT            4       // Fault record, profiling, benchmarks
+#define BOOT_ID_PIE             5       // GPIO, PIE and vector table
+#define BOOT_ID_ADC             6       // ADCs settled
+#define BOOT_ID_EPWM            7       // ePWM, ADC triggers and HRPWM set up
+#define BOOT_ID_SFO             8       // HRMSTEP valid, PWM usable
+#define BOOT_ID_RUN             9       // Scheduler started
+#define BOOT_STAGES             10
+
+extern int MEP_ScaleFactor;             // Updated by SFO()
+
+//
+// Globals
+//
+uint32_t bootStamp[BOOT_STAGES];        // Timer 1 count at the stage's end
+uint32_t bootTime[BOOT_STAGES];         // us since main(), from bootReport()
+
+//
+// The timer is read in place: before InitSysCtrl() has copied .TI.ramfunc
+// to RAM, timebaseNow() cannot be called in Flash builds
+//
+#define bootStage(id)           (bootStamp[id] = ~CpuTimer1Regs.TIM.all)
+
+//
+// bootStart - Clear the stamps left from before the reset and stamp
+//             BOOT_ID_START
+//
+void bootStart(void)
+{
+    memset(bootStamp, 0, sizeof(bootStamp));
+    bootStage(BOOT_ID_START);
+}
+
+//
+// bootTimeUs - Microseconds from main() to timer count t, t taken before
+//              the PLL stage if prePll
+//
+uint32_t bootTimeUs(uint32_t t, uint16_t prePll)
+{
+    uint32_t pll;
+
+    pll = prePll ? t : bootStamp[BOOT_ID_PLL];
+    t -= pll;
+    pll -= bootStamp[BOOT_ID_START];
+
+    return(pll / (BOOT_PRE_PLL_HZ / 1000000UL) +
+           t / (BOOT_SYSCLK_HZ / 1000000UL));
+}
+
+//
+// bootReport - Fill bootTime[] from the recorded stages. Stages that did
+//              not run are left at zero.
+//
+void bootReport(void)
+{
+    uint16_t i;
+
+    for(i = 0; i < BOOT_STAGES; i++)
+    {
+        if(bootStamp[i] == 0)
+        {
+            bootTime[i] = 0;
+        }
+        else
+        {
+            bootTime[i] = bootTimeUs(bootStamp[i], i < BOOT_ID_PLL);
+        }
+    }
+}
+
+//
+// bootPeripheralClocks - Clocks for the peripherals the application uses;
+//                        the rest stay gated
+//
+void bootPeripheralClocks(void)
+{
+    EALLOW;
+
+    CpuSysRegs.PCLKCR0.bit.CLA1 = 1;        // CLA_CONTROL.h
+    CpuSysRegs.PCLKCR0.bit.DMA = 1;         // ADC_DMA.h
+    CpuSysRegs.PCLKCR0.bit.CPUTIMER0 = 1;   // Scheduler tick
+    CpuSysRegs.PCLKCR0.bit.CPUTIMER1 = 1;   // Timebase
+    CpuSysRegs.PCLKCR0.bit.HRPWM = 1;
+    CpuSysRegs.PCLKCR0.bit.TBCLKSYNC = 1;
+
+    CpuSysRegs.PCLKCR2.bit.EPWM1 = 1;       // PWM_CONFIG.h
+    CpuSysRegs.PCLKCR2.bit.EPWM2 = 1;
+    CpuSysRegs.PCLKCR2.bit.EPWM3 = 1;
+    CpuSysRegs.PCLKCR2.bit.EPWM4 = 1;
+    CpuSysRegs.PCLKCR2.bit.EPWM5 = 1;
+
+    CpuSysRegs.PCLKCR7.bit.SCI_A = 1;       // TELEMETRY.h
+
+    CpuSysRegs.PCLKCR13.bit.ADC_A = 1;      // ADC_CONFIG.h
+    CpuSysRegs.PCLKCR13.bit.ADC_B = 1;
+
+    EDIS;
+}
+
+//
+// bootInitSysCtrl - InitSysCtrl() with the reduced clock set and the ADC
+//                   power-up started ahead of the PLL
+//
+void bootInitSysCtrl(void)
+{
+    //
+    // Only BOOT_ID_START may be stamped yet
+    //
+    memset(&bootStamp[BOOT_ID_CLOCKS], 0,
+           sizeof(bootStamp) - sizeof(bootStamp[0]) * BOOT_ID_CLOCKS);
+
+    DisableDog();
+
+#ifdef _FLASH
+    //
+    // Copy the RAM functions, InitFlash() among them, and set wait states
+    //
+    memcpy(&RamfuncsRunStart, &RamfuncsLoadStart, (size_t)&RamfuncsLoadSize);
+    InitFlash();
+#else
+    //
+    // Analog and oscillator trims, as the boot ROM does on a device reset
+    //
+    Device_cal();
+#endif
+
+    bootPeripheralClocks();
+    bootStage(BOOT_ID_CLOCKS);
+
+    //
+    // The ADCs settle while the PLL locks
+    //
+    initADCPowerUp();
+    bootStage(BOOT_ID_ADC_ON);
+
+    InitSysPll(XTAL_OSC, IMULT_10, FMULT_0, PLLCLK_BY_2);
+}
+
+//
+// bootAdcWait - Wait out the rest of the ADC settling time
+//
+void bootAdcWait(void)
+{
+    uint32_t on;
+
+    on = bootTimeUs(bootStamp[BOOT_ID_ADC_ON], 1);
+    while(bootTimeUs(~CpuTimer1Regs.TIM.all, 0) - on < BOOT_ADC_SETTLE_US)
+    {
+    }
+}
+
+//
+// bootSeedScaleFactor - Start HRPWM on scale factor sf until SFO() has
+//                       calibrated one
+//
+void bootSeedScaleFactor(int sf)
+{
+    MEP_ScaleFactor = sf;
+
+    EALLOW;
+    EPwm1Regs.HRMSTEP.bit.HRMSTEP = sf;
+    EDIS;
+}
+
+#endif  // BOOT_PROFILE_H
@@ -0,0 +1,167 @@
+#ifndef CLA_CONTROL_H
+#define CLA_CONTROL_H
+
+//
+// CLA inner control loop.
+//
+// Shared between the C28x application and cla_control.cla. CLA task 1 is
+// triggered by ADCA INT1 at the end of each ePWM1 SOCA burst, reads
+// ADCRESULT0, runs a PI voltage loop in float32 and writes the result to
+// CLA_LOOP_EPWM CMPA:CMPAHR directly. The C28x only exchanges parameters
+// and status through the CLA message RAMs:
+//
+//   claParams - CpuToCla1MsgRAM, written by the C28x, read by the CLA
+//   claState  - Cla1ToCpuMsgRAM, written by the CLA, read by the C28x
+//
+// Task 8 is the initialization task; it clears claState and is forced once
+// by initCLA(). The CLA program (Cla1Prog) runs from RAMLS4 and its data
+// (.scratchpad, .bss_cla, .const_cla) lives in RAMLS7, see the linker
+// command files.
+//
+// Task 1 takes the ADCA INT1 trigger in place of adcA1ISR(): with the CLA
+// loop on, the ADCA1 PIE interrupt stays disabled, and the CPU sees the
+// loop only through claState.
+//
+
+//
+// Defines
+//
+#define CLA_TRIG_ADCA1          1       // CLA1TASKSRCSEL - ADCA INT1
+#define CLA_LOOP_EPWM           EPwm1Regs   // Module driven by task 1
+#define CLA_LOOP_ADC_RESULT     AdcaResultRegs.ADCRESULT0
+
+//
+// CPU to CLA mailbox
+//
+typedef struct
+{
+    float vref;                 // Voltage reference (V)
+    float gain;                 // ADC count to volts
+    float kp;                   // Proportional gain (duty / V)
+    float ki;                   // Integral gain per sample (duty / V)
+    float dutyMin;              // Duty limits, as CMPA / TBPRD
+    float dutyMax;
+    float period;               // TBPRD of CLA_LOOP_EPWM
+    uint16_t enable;            // 1 = task 1 writes CMPA:CMPAHR
+} CLA_LOOP_PARAMS;
+
+//
+// CLA to CPU mailbox
+//
+typedef struct
+{
+    float vout;                 // Last Vout sample (V)
+    float err;                  // Last error (V)
+    float integ;                // Integrator state
+    float duty;                 // Last duty written
+    uint32_t cmp;               // Last CMPA:CMPAHR image written
+    uint32_t runs;              // # of task 1 executions
+    uint16_t sat;               // 1 = duty clamped on the last sample
+} CLA_LOOP_STATE;
+
+//
+// Mailboxes and task entry points
+//
+extern CLA_LOOP_PARAMS claParams;
+extern CLA_LOOP_STATE claState;
+
+__interrupt void Cla1Task1(void);
+__interrupt void Cla1Task2(void);
+__interrupt void Cla1Task3(void);
+__interrupt void Cla1Task4(void);
+__interrupt void Cla1Task5(void);
+__interrupt void Cla1Task6(void);
+__interrupt void Cla1Task7(void);
+__interrupt void Cla1Task8(void);
+
+#ifndef __TMS320C28XX_CLA__
+
+#include <string.h>
+
+//
+// Globals
+//
+#pragma DATA_SECTION(claParams, "CpuToCla1MsgRAM");
+CLA_LOOP_PARAMS claParams;
+#pragma DATA_SECTION(claState, "Cla1ToCpuMsgRAM");
+CLA_LOOP_STATE claState;
+
+#ifdef _FLASH
+extern uint16_t Cla1ProgLoadStart, Cla1ProgLoadSize, Cla1ProgRunStart;
+extern uint16_t Cla1ConstLoadStart, Cla1ConstLoadSize, Cla1ConstRunStart;
+#endif
+
+//
+// initCLAMsgRAM - Zero both CLA message RAMs. Done by initCLA(); call it on
+//                 its own when the CLA is not used but claState is read.
+//
+void initCLAMsgRAM(void)
+{
+    EALLOW;
+    MemCfgRegs.MSGxINIT.bit.INIT_CLA1TOCPU = 1;
+    while(MemCfgRegs.MSGxINITDONE.bit.INITDONE_CLA1TOCPU != 1)
+    {
+    }
+    MemCfgRegs.MSGxINIT.bit.INIT_CPUTOCLA1 = 1;
+    while(MemCfgRegs.MSGxINITDONE.bit.INITDONE_CPUTOCLA1 != 1)
+    {
+    }
+    EDIS;
+}
+
+//
+// initCLA - Hand RAMLS4/RAMLS7 to the CLA, map the task vectors and arm
+//           task 1 on ADCA INT1. claParams should be filled in before the
+//           loop is enabled; the ADCA INT1 flag is switched to continuous
+//           mode so it keeps triggering the CLA without being cleared.
+//
+void initCLA(void)
+{
+#ifdef _FLASH
+    //
+    // Copy the CLA program and constants from Flash while the CPU still
+    // owns the LS RAMs
+    //
+    memcpy(&Cla1ProgRunStart, &Cla1ProgLoadStart, (size_t)&Cla1ProgLoadSize);
+    memcpy(&Cla1ConstRunStart, &Cla1ConstLoadStart,
+           (size_t)&Cla1ConstLoadSize);
+#endif
+
+    initCLAMsgRAM();
+
+    EALLOW;
+
+    //
+    // RAMLS4 = CLA program, RAMLS7 = CLA data
+    //
+    MemCfgRegs.LSxMSEL.bit.MSEL_LS4 = 1;
+    MemCfgRegs.LSxCLAPGM.bit.CLAPGM_LS4 = 1;
+    MemCfgRegs.LSxMSEL.bit.MSEL_LS7 = 1;
+    MemCfgRegs.LSxCLAPGM.bit.CLAPGM_LS7 = 0;
+
+    //
+    // Task vectors and triggers
+    //
+    Cla1Regs.MVECT1 = (uint16_t)(uintptr_t)&Cla1Task1;
+    Cla1Regs.MVECT8 = (uint16_t)(uintptr_t)&Cla1Task8;
+    DmaClaSrcSelRegs.CLA1TASKSRCSEL1.bit.TASK1 = CLA_TRIG_ADCA1;
+    AdcaRegs.ADCINTSEL1N2.bit.INT1CONT = 1;
+
+    Cla1Regs.MCTL.bit.IACKE = 1;
+    Cla1Regs.MIER.all = M_INT1 | M_INT8;
+
+    //
+    // Run the initialization task and wait for it to finish
+    //
+    Cla1Regs.MIFRC.bit.INT8 = 1;
+    __asm(" RPT #3 || NOP");
+    while(Cla1Regs.MIRUN.bit.INT8 == 1)
+    {
+    }
+
+    EDIS;
+}
+
+#endif  // __TMS320C28XX_CLA__
+
+#endif  // CLA_CONTROL_H
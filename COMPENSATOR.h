@@ -0,0 +1,338 @@
+#ifndef COMPENSATOR_H
+#define COMPENSATOR_H
+
+//
+// Digital power compensators: 2-pole/2-zero, 3-pole/3-zero and PI, each in
+// float32 (FPU) and Q24 fixed point.
+//
+// The difference equations are
+//
+//   2p2z: u(k) = b0 e(k) + b1 e(k-1) + b2 e(k-2) - a1 u(k-1) - a2 u(k-2)
+//   3p3z: u(k) = b0 e(k) + ... + b3 e(k-3) - a1 u(k-1) - ... - a3 u(k-3)
+//   PI:   u(k) = kp e(k) + i(k),  i(k) = i(k-1) + ki e(k)
+//
+// Every kernel is split in two so that the ADC EOC to compare update path
+// only does one multiply-add and a clamp:
+//
+//   cntlXxxRun()    - u = sat(b0 e + partial), call right after the sample,
+//                     then write u to the compare register
+//   cntlXxxUpdate() - shift the history and precompute partial for the next
+//                     sample, call after the compare write
+//
+// The kernels have no loops or data-dependent branches; saturation uses the
+// min/max intrinsics, so each one takes a fixed number of cycles. The
+// output is clamped to [outMin, outMax] before it enters the history, which
+// also makes the 2p2z/3p3z anti-windup. The PI integrator is clamped to the
+// same limits.
+//
+// Q24 signals are per-unit: an ADC result maps to CNTL_ADC_TO_Q24() (1.0 =
+// 4096 counts) and a duty output of 1.0 is a whole TBPRD. Keep outMax of a
+// Q24 duty loop below CNTL_Q24(1.0) for cntlDutyToCmpQ24().
+//
+
+//
+// Defines
+//
+#define CNTL_Q24(x)             ((int32_t)((x) * 16777216.0 + 0.5))
+#define CNTL_ADC_TO_Q24(adc)    ((int32_t)(adc) << 12)
+#define CNTL_ADC_TO_F32(adc)    ((float)(adc) * (1.0f / 4096.0f))
+
+//
+// The CLA has no integer min/max, so CNTL_SATL clamps in float32. That is
+// exact while |lo| and |hi| are at most 2^24 (CNTL_Q24(1.0)): an x inside
+// the limits converts exactly, and one outside rounds no further than the
+// limit it is clamped to.
+//
+#if defined(__TMS320C28XX_CLA__)
+#define CNTL_SATF(x, lo, hi)    __mminf32(__mmaxf32((x), (lo)), (hi))
+#define CNTL_SATL(x, lo, hi)    ((int32_t)__mminf32(__mmaxf32((float)(x),    \
+                                    (float)(lo)), (float)(hi)))
+#elif defined(__TMS320C28XX__)
+#define CNTL_SATF(x, lo, hi)    __fmin(__fmax((x), (lo)), (hi))
+#define CNTL_SATL(x, lo, hi)    __lmin(__lmax((x), (lo)), (hi))
+#else
+#define CNTL_SATF(x, lo, hi)    ((x) < (lo) ? (lo) : ((x) > (hi) ? (hi) : (x)))
+#define CNTL_SATL(x, lo, hi)    ((x) < (lo) ? (lo) : ((x) > (hi) ? (hi) : (x)))
+#endif
+
+//
+// Q24 multiply, 32 x 32 -> 64 bit product shifted down by 24: IMPYL/QMPYL
+// through the intrinsic on the C28x, a 64-bit multiply on the host.
+//
+#if defined(__TMS320C28XX__) && !defined(__TMS320C28XX_CLA__)
+#define CNTL_QMPY24(a, b)       __qmpy32((a), (b), 24)
+#else
+#define CNTL_QMPY24(a, b)       ((int32_t)(((int64_t)(a) * (b)) >> 24))
+#endif
+
+//
+// float32 compensators
+//
+typedef struct
+{
+    float b0, b1, b2;           // Numerator
+    float a1, a2;               // Denominator (a0 = 1)
+    float e1, e2;               // Error history
+    float u1, u2;               // Output history
+    float partial;              // Precomputed part of the next output
+    float outMin, outMax;       // Output clamp
+} CNTL_2P2Z_F32;
+
+typedef struct
+{
+    float b0, b1, b2, b3;
+    float a1, a2, a3;
+    float e1, e2, e3;
+    float u1, u2, u3;
+    float partial;
+    float outMin, outMax;
+} CNTL_3P3Z_F32;
+
+typedef struct
+{
+    float kp, ki;               // Proportional, integral gain per sample
+    float i1;                   // Integrator
+    float partial;              // i1 + ki e, precomputed without e
+    float outMin, outMax;
+} CNTL_PI_F32;
+
+//
+// Q24 compensators
+//
+typedef struct
+{
+    int32_t b0, b1, b2;
+    int32_t a1, a2;
+    int32_t e1, e2;
+    int32_t u1, u2;
+    int32_t partial;
+    int32_t outMin, outMax;
+} CNTL_2P2Z_Q24;
+
+typedef struct
+{
+    int32_t b0, b1, b2, b3;
+    int32_t a1, a2, a3;
+    int32_t e1, e2, e3;
+    int32_t u1, u2, u3;
+    int32_t partial;
+    int32_t outMin, outMax;
+} CNTL_3P3Z_Q24;
+
+typedef struct
+{
+    int32_t kp, ki;
+    int32_t i1;
+    int32_t partial;
+    int32_t outMin, outMax;
+} CNTL_PI_Q24;
+
+//
+// cntlReset2p2zF32 / cntlReset3p3zF32 / cntlResetPiF32 - Clear the history,
+//                    keeping coefficients and limits
+//
+static inline void cntlReset2p2zF32(CNTL_2P2Z_F32 *c)
+{
+    c->e1 = 0; c->e2 = 0;
+    c->u1 = 0; c->u2 = 0;
+    c->partial = 0;
+}
+
+static inline void cntlReset3p3zF32(CNTL_3P3Z_F32 *c)
+{
+    c->e1 = 0; c->e2 = 0; c->e3 = 0;
+    c->u1 = 0; c->u2 = 0; c->u3 = 0;
+    c->partial = 0;
+}
+
+static inline void cntlResetPiF32(CNTL_PI_F32 *c)
+{
+    c->i1 = 0;
+    c->partial = 0;
+}
+
+//
+// C28x: the Run/Update kernels execute from RAM (.TI.ramfunc)
+//
+#ifndef __TMS320C28XX_CLA__
+#pragma CODE_SECTION(cntlRun2p2zF32, ".TI.ramfunc");
+#pragma CODE_SECTION(cntlUpdate2p2zF32, ".TI.ramfunc");
+#pragma CODE_SECTION(cntlRun3p3zF32, ".TI.ramfunc");
+#pragma CODE_SECTION(cntlUpdate3p3zF32, ".TI.ramfunc");
+#pragma CODE_SECTION(cntlRunPiF32, ".TI.ramfunc");
+#pragma CODE_SECTION(cntlUpdatePiF32, ".TI.ramfunc");
+#pragma CODE_SECTION(cntlRun2p2zQ24, ".TI.ramfunc");
+#pragma CODE_SECTION(cntlUpdate2p2zQ24, ".TI.ramfunc");
+#pragma CODE_SECTION(cntlRun3p3zQ24, ".TI.ramfunc");
+#pragma CODE_SECTION(cntlUpdate3p3zQ24, ".TI.ramfunc");
+#pragma CODE_SECTION(cntlRunPiQ24, ".TI.ramfunc");
+#pragma CODE_SECTION(cntlUpdatePiQ24, ".TI.ramfunc");
+#pragma CODE_SECTION(cntlDutyToCmpF32, ".TI.ramfunc");
+#pragma CODE_SECTION(cntlDutyToCmpQ24, ".TI.ramfunc");
+#endif
+
+//
+// cntlRun2p2zF32 - Critical path: output for error e
+//
+static inline float cntlRun2p2zF32(const CNTL_2P2Z_F32 *c, float e)
+{
+    float u = c->b0 * e + c->partial;
+
+    return(CNTL_SATF(u, c->outMin, c->outMax));
+}
+
+//
+// cntlUpdate2p2zF32 - Store e and the (clamped) output u from
+//                     cntlRun2p2zF32(), precompute the next partial
+//
+static inline void cntlUpdate2p2zF32(CNTL_2P2Z_F32 *c, float e, float u)
+{
+    c->e2 = c->e1;
+    c->e1 = e;
+    c->u2 = c->u1;
+    c->u1 = u;
+
+    c->partial = c->b1 * c->e1 + c->b2 * c->e2
+               - c->a1 * c->u1 - c->a2 * c->u2;
+}
+
+static inline float cntlRun3p3zF32(const CNTL_3P3Z_F32 *c, float e)
+{
+    float u = c->b0 * e + c->partial;
+
+    return(CNTL_SATF(u, c->outMin, c->outMax));
+}
+
+static inline void cntlUpdate3p3zF32(CNTL_3P3Z_F32 *c, float e, float u)
+{
+    c->e3 = c->e2;
+    c->e2 = c->e1;
+    c->e1 = e;
+    c->u3 = c->u2;
+    c->u2 = c->u1;
+    c->u1 = u;
+
+    c->partial = c->b1 * c->e1 + c->b2 * c->e2 + c->b3 * c->e3
+               - c->a1 * c->u1 - c->a2 * c->u2 - c->a3 * c->u3;
+}
+
+//
+// cntlRunPiF32 - Critical path: output for error e. The integral term is
+//                included here so the output reacts to e in the same sample.
+//
+static inline float cntlRunPiF32(const CNTL_PI_F32 *c, float e)
+{
+    float u = (c->kp + c->ki) * e + c->partial;
+
+    return(CNTL_SATF(u, c->outMin, c->outMax));
+}
+
+//
+// cntlUpdatePiF32 - Advance the integrator with e, clamped to the output
+//                   limits (anti-windup)
+//
+static inline void cntlUpdatePiF32(CNTL_PI_F32 *c, float e)
+{
+    float i = c->i1 + c->ki * e;
+
+    c->i1 = CNTL_SATF(i, c->outMin, c->outMax);
+    c->partial = c->i1;
+}
+
+//
+// Q24 variants, same call sequence as the float32 kernels
+//
+static inline void cntlReset2p2zQ24(CNTL_2P2Z_Q24 *c)
+{
+    c->e1 = 0; c->e2 = 0;
+    c->u1 = 0; c->u2 = 0;
+    c->partial = 0;
+}
+
+static inline void cntlReset3p3zQ24(CNTL_3P3Z_Q24 *c)
+{
+    c->e1 = 0; c->e2 = 0; c->e3 = 0;
+    c->u1 = 0; c->u2 = 0; c->u3 = 0;
+    c->partial = 0;
+}
+
+static inline void cntlResetPiQ24(CNTL_PI_Q24 *c)
+{
+    c->i1 = 0;
+    c->partial = 0;
+}
+
+static inline int32_t cntlRun2p2zQ24(const CNTL_2P2Z_Q24 *c, int32_t e)
+{
+    int32_t u = CNTL_QMPY24(c->b0, e) + c->partial;
+
+    return(CNTL_SATL(u, c->outMin, c->outMax));
+}
+
+static inline void cntlUpdate2p2zQ24(CNTL_2P2Z_Q24 *c, int32_t e, int32_t u)
+{
+    c->e2 = c->e1;
+    c->e1 = e;
+    c->u2 = c->u1;
+    c->u1 = u;
+
+    c->partial = CNTL_QMPY24(c->b1, c->e1) + CNTL_QMPY24(c->b2, c->e2)
+               - CNTL_QMPY24(c->a1, c->u1) - CNTL_QMPY24(c->a2, c->u2);
+}
+
+static inline int32_t cntlRun3p3zQ24(const CNTL_3P3Z_Q24 *c, int32_t e)
+{
+    int32_t u = CNTL_QMPY24(c->b0, e) + c->partial;
+
+    return(CNTL_SATL(u, c->outMin, c->outMax));
+}
+
+static inline void cntlUpdate3p3zQ24(CNTL_3P3Z_Q24 *c, int32_t e, int32_t u)
+{
+    c->e3 = c->e2;
+    c->e2 = c->e1;
+    c->e1 = e;
+    c->u3 = c->u2;
+    c->u2 = c->u1;
+    c->u1 = u;
+
+    c->partial = CNTL_QMPY24(c->b1, c->e1) + CNTL_QMPY24(c->b2, c->e2)
+               + CNTL_QMPY24(c->b3, c->e3)
+               - CNTL_QMPY24(c->a1, c->u1) - CNTL_QMPY24(c->a2, c->u2)
+               - CNTL_QMPY24(c->a3, c->u3);
+}
+
+static inline int32_t cntlRunPiQ24(const CNTL_PI_Q24 *c, int32_t e)
+{
+    int32_t u = CNTL_QMPY24(c->kp + c->ki, e) + c->partial;
+
+    return(CNTL_SATL(u, c->outMin, c->outMax));
+}
+
+static inline void cntlUpdatePiQ24(CNTL_PI_Q24 *c, int32_t e)
+{
+    int32_t i = c->i1 + CNTL_QMPY24(c->ki, e);
+
+    c->i1 = CNTL_SATL(i, c->outMin, c->outMax);
+    c->partial = c->i1;
+}
+
+//
+// HRPWM outputs: turn a duty (fraction of period) into the CMPx:CMPxHR
+// register image, same layout as hrmathDutyToCmp()
+//
+static inline uint32_t cntlDutyToCmpF32(uint16_t period, float duty)
+{
+    float cmp = duty * period;
+    uint32_t coarse = (uint32_t)cmp;
+
+    return((coarse << 16) |
+           ((uint32_t)((cmp - (float)coarse) * 256.0f) << 8));
+}
+
+static inline uint32_t cntlDutyToCmpQ24(uint16_t period, int32_t duty)
+{
+    return((uint32_t)period * (uint16_t)(duty >> 8));
+}
+
+#endif  // COMPENSATOR_H
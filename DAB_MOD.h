@@ -0,0 +1,188 @@
+#ifndef DAB_MOD_H
+#define DAB_MOD_H
+
+//
+// Dual-active-bridge phase-shift modulator.
+//
+// Every bridge leg is a slave ePWM module running in up-down count mode
+// from the same TBPRD as the sync master. A leg is placed in the switching
+// period by the counter position and direction it is loaded with on sync,
+// see hrmathLagToSync(). TRREM is seeded with the HR remainder of the new
+// phase so the first period after the sync does not start from a stale
+// remainder.
+//
+// Each leg's lag is its base offset plus the outer phase shift (secondary
+// legs, DAB_LEG_PHASE) and/or the inner EPS angle (DAB_LEG_INNER). The
+// phase registers are staged through the leg's HRPWM_UPDATE entry:
+//
+//   dabModulate(&dab, phase, inner);  // compute, fill tbphs/tbphshr
+//   if(updateHRPWM(upd, count))       // stage TBPHS with period/compares
+//       dabCommit(&dab);              // PHSDIR/TRREM, arm one-shot sync
+//
+// The master only emits SYNCO once per dabCommit() (one-shot sync mode), so
+// all legs load their new phase on the same master CTR = 0 and never see a
+// partly written set. dabCommit() goes through once per update set that
+// updateHRPWM() accepted and returns 0 otherwise, which keeps it to one
+// sync per switching period: updateHRPWM() waits until the last sync has
+// fired and the legs have loaded TBPHS.
+//
+
+#include "HRPWM_UPDATE.h"
+#include "HRPWM_MATH.h"
+
+//
+// Defines
+//
+#define DAB_MAX_LEGS            8
+#define DAB_LEG_PHASE           0x0001  // Add the outer phase shift
+#define DAB_LEG_INNER           0x0002  // Add the inner (EPS) angle
+#define DAB_HALF_PERIOD         0x8000  // 180 degrees in Q16
+#define DAB_SYNC_CTR_ZERO       1       // SYNCOSEL - CTR = 0
+
+typedef struct
+{
+    HRPWM_UPDATE *upd;          // Update entry of the leg's ePWM module
+    uint16_t base;              // Lag at zero command (Q16 period)
+    uint16_t flags;             // DAB_LEG_xxx
+    uint16_t phsdir;            // Computed count direction after sync
+    uint16_t trrem;             // Computed TRREM seed
+} DAB_LEG;
+
+typedef struct
+{
+    volatile struct EPWM_REGS *master;  // Sync master
+    uint16_t period;            // TBPRD shared by master and legs
+    uint16_t phase;             // Last outer phase shift (Q16 period)
+    uint16_t inner;             // Last inner angle (Q16 period)
+    uint16_t legCount;
+    uint16_t set;               // hrpwmGldSets at the last commit
+    uint32_t skips;             // # of dabCommit() calls turned away
+    DAB_LEG leg[DAB_MAX_LEGS];
+} DAB_MOD;
+
+//
+// initDAB - Put master in one-shot sync mode with SYNCO on CTR = 0. Legs
+//           are added with dabAddLeg(); their modules must have PHSEN set
+//           and pass the sync chain through (SYNCOSEL = SYNCI).
+//
+void initDAB(DAB_MOD *m, volatile struct EPWM_REGS *master, uint16_t period)
+{
+    m->master = master;
+    m->period = period;
+    m->phase = 0;
+    m->inner = 0;
+    m->legCount = 0;
+    m->set = hrpwmGldSets;
+    m->skips = 0;
+
+    EALLOW;
+    master->TBCTL.bit.SYNCOSEL = DAB_SYNC_CTR_ZERO;
+    master->TBCTL2.bit.OSHTSYNCMODE = 1;
+    EDIS;
+}
+
+//
+// dabAddLeg - Add the leg driven by upd->regs with the given base lag and
+//             DAB_LEG_xxx flags
+//
+void dabAddLeg(DAB_MOD *m, HRPWM_UPDATE *upd, uint16_t base, uint16_t flags)
+{
+    DAB_LEG *l;
+
+    if(m->legCount >= DAB_MAX_LEGS)
+    {
+        return;
+    }
+
+    l = &m->leg[m->legCount++];
+    l->upd = upd;
+    l->base = base;
+    l->flags = flags;
+    l->phsdir = TB_UP;
+    l->trrem = 0;
+}
+
+//
+// Per-period path runs from RAM; initDAB()/dabAddLeg() stay in Flash
+//
+#pragma CODE_SECTION(dabModulate, ".TI.ramfunc");
+#pragma CODE_SECTION(dabCommit, ".TI.ramfunc");
+
+//
+// dabModulate - Compute every leg's phase for an outer phase shift and an
+//               inner EPS angle, both as Q16 fractions of the switching
+//               period (0x8000 = 180 degrees)
+//
+void dabModulate(DAB_MOD *m, uint16_t phase, uint16_t inner)
+{
+    DAB_LEG *l;
+    uint32_t tbphs;
+    uint16_t lag, i;
+
+    m->phase = phase;
+    m->inner = inner;
+
+    for(i = 0; i < m->legCount; i++)
+    {
+        l = &m->leg[i];
+
+        lag = l->base;
+        if(l->flags & DAB_LEG_PHASE)
+        {
+            lag += phase;
+        }
+        if(l->flags & DAB_LEG_INNER)
+        {
+            lag += inner;
+        }
+
+        tbphs = hrmathLagToSync(m->period, lag, &l->phsdir);
+
+        l->upd->tbphs = (uint16_t)(tbphs >> 16);
+        l->upd->tbphshr = (uint16_t)tbphs;
+        l->trrem = (uint16_t)tbphs >> 8;
+    }
+}
+
+//
+// dabCommit - Set PHSDIR/TRREM of every leg and let the master emit one
+//             SYNCO, after updateHRPWM() has staged TBPHS:TBPHSHR. Returns
+//             1, or 0 with nothing written if there is no new update set.
+//
+// PHSDIR and TRREM have no shadow and are written live. PHSDIR is only
+// used when a leg loads TBPHS:TBPHSHR on SYNCI, and TRREM is the HR
+// remainder the leg starts from at that load. The next SYNCI is the one
+// armed below. The previous one has already fired, because updateHRPWM()
+// waited for the master's CTR = 0 after it was armed. Until the new sync
+// the leg runs on at its old phase. With TBPRDHR in use the leg also carries its
+// running remainder in TRREM, so the write can change the HR part of the
+// period in progress. The sync then restarts the counter from TBPHS, so
+// nothing carries over into the new phase.
+//
+uint16_t dabCommit(DAB_MOD *m)
+{
+    volatile struct EPWM_REGS *p;
+    uint16_t i;
+
+    if(m->set == hrpwmGldSets)
+    {
+        m->skips++;
+        return(0);
+    }
+    m->set = hrpwmGldSets;
+
+    for(i = 0; i < m->legCount; i++)
+    {
+        p = m->leg[i].upd->regs;
+
+        p->TBCTL.bit.PHSDIR = m->leg[i].phsdir;
+        p->TRREM.bit.TRREM = m->leg[i].trrem;
+    }
+
+    m->master->TBCTL2.bit.OSHTSYNC = 1;
+    hrpwmSyncArmed();
+
+    return(1);
+}
+
+#endif  // DAB_MOD_H
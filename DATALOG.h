@@ -0,0 +1,279 @@
+#ifndef DATALOG_H
+#define DATALOG_H
+
+//
+// Triggered multi-channel datalogger.
+//
+// Up to DLOG_CHANNELS variables are sampled by dlogRun(), once every
+// `decimation` calls, into dlogData[][] in RAMGS2 (the "dlogbuf" section).
+// Each sample is converted to float32 so a CCS graph can plot any channel
+// directly. Storage is struct-of-arrays: each channel has its own
+// DLOG_DEPTH array, and a record is one store per channel at the same
+// index.
+//
+// dlogArm() starts a capture:
+//
+//   DLOG_IDLE -> ARMED      - dlogArm(); fills the pre-trigger history
+//   ARMED -> TRIGGERED      - trigger condition, once `pre` samples exist
+//   TRIGGERED -> FROZEN     - DLOG_DEPTH - pre samples after the trigger
+//
+// A trigger is a level (channel above/below level), an edge (channel
+// crossing level up/down), or a fault: dlogTrigger() from any context,
+// e.g. a protection ISR. Once FROZEN, dlogRun() stops writing, so the
+// buffer can be read while the target keeps running in real-time mode. The
+// oldest sample is at index dlog.start and the trigger sample at
+// dlog.trigger; dlogSample() unrolls the ring.
+//
+
+//
+// Defines
+//
+#define DLOG_CHANNELS           4
+#define DLOG_DEPTH              512     // Samples per channel
+
+#define DLOG_U16                0       // Channel source types
+#define DLOG_I32                1
+#define DLOG_Q16                2       // int32_t 16.16
+#define DLOG_F32                3
+
+#define DLOG_TRIG_NONE          0       // Fault trigger (dlogTrigger()) only
+#define DLOG_TRIG_ABOVE         1       // Level: channel > level
+#define DLOG_TRIG_BELOW         2       // Level: channel < level
+#define DLOG_TRIG_RISING        3       // Edge: crosses level upward
+#define DLOG_TRIG_FALLING       4       // Edge: crosses level downward
+
+#define DLOG_IDLE               0
+#define DLOG_ARMED              1
+#define DLOG_TRIGGERED          2
+#define DLOG_FROZEN             3
+
+typedef struct
+{
+    const volatile void *src;   // Logged variable
+    uint16_t type;              // DLOG_U16..F32
+} DLOG_CHANNEL;
+
+typedef struct
+{
+    DLOG_CHANNEL ch[DLOG_CHANNELS];
+    uint16_t decimation;        // Record one call in `decimation`
+    uint16_t mode;              // DLOG_TRIG_xxx
+    uint16_t trigCh;            // Channel compared against level
+    float level;
+    uint16_t pre;               // Pre-trigger samples (< DLOG_DEPTH)
+
+    volatile uint16_t state;    // DLOG_IDLE..FROZEN
+    volatile uint16_t fault;    // Set by dlogTrigger()
+    uint16_t index;             // Next write position
+    uint16_t filled;            // Samples since dlogArm(), saturating
+    uint16_t remain;            // Samples left after the trigger
+    uint16_t prescale;          // Decimation counter
+    uint16_t start;             // Oldest sample once FROZEN
+    uint16_t trigger;           // Trigger sample once FROZEN
+    float last;                 // Previous trigger channel value (edges)
+} DLOG;
+
+//
+// Globals
+//
+#pragma DATA_SECTION(dlogData, "dlogbuf");
+float dlogData[DLOG_CHANNELS][DLOG_DEPTH];
+DLOG dlog;
+
+//
+// Sampled from ISRs, runs from RAM
+//
+#pragma CODE_SECTION(dlogRead, ".TI.ramfunc");
+#pragma CODE_SECTION(dlogRun, ".TI.ramfunc");
+
+//
+// dlogRead - Current value of channel c as float32
+//
+static inline float dlogRead(const DLOG_CHANNEL *c)
+{
+    switch(c->type)
+    {
+        case DLOG_U16:
+            return((float)*(const volatile uint16_t *)c->src);
+        case DLOG_I32:
+            return((float)*(const volatile int32_t *)c->src);
+        case DLOG_Q16:
+            return((float)*(const volatile int32_t *)c->src *
+                   (1.0f / 65536.0f));
+        default:
+            return(*(const volatile float *)c->src);
+    }
+}
+
+//
+// initDatalog - Clear the channel list and stop the logger. Unused
+//               channels log zero.
+//
+void initDatalog(uint16_t decimation)
+{
+    static const float zero = 0.0f;
+    uint16_t i;
+
+    for(i = 0; i < DLOG_CHANNELS; i++)
+    {
+        dlog.ch[i].src = &zero;
+        dlog.ch[i].type = DLOG_F32;
+    }
+
+    dlog.decimation = (decimation == 0) ? 1 : decimation;
+    dlog.mode = DLOG_TRIG_NONE;
+    dlog.state = DLOG_IDLE;
+    dlog.fault = 0;
+}
+
+//
+// dlogSetChannel - Log the variable at src (DLOG_U16..F32) on channel ch
+//
+void dlogSetChannel(uint16_t ch, const volatile void *src, uint16_t type)
+{
+    if(ch < DLOG_CHANNELS)
+    {
+        dlog.ch[ch].src = src;
+        dlog.ch[ch].type = type;
+    }
+}
+
+//
+// dlogArm - Start a capture that triggers on mode/trigCh/level, with
+//           preFrac (Q16 of DLOG_DEPTH) of the buffer before the trigger.
+//           Re-arming discards a frozen capture.
+//
+void dlogArm(uint16_t mode, uint16_t trigCh, float level, uint16_t preFrac)
+{
+    dlog.state = DLOG_IDLE;
+
+    dlog.mode = mode;
+    dlog.trigCh = (trigCh < DLOG_CHANNELS) ? trigCh : 0;
+    dlog.level = level;
+    dlog.pre = (uint16_t)(((uint32_t)preFrac * DLOG_DEPTH) >> 16);
+    if(dlog.pre >= DLOG_DEPTH)
+    {
+        dlog.pre = DLOG_DEPTH - 1;
+    }
+
+    dlog.index = 0;
+    dlog.filled = 0;
+    dlog.prescale = 0;
+    dlog.fault = 0;
+    dlog.last = dlogRead(&dlog.ch[dlog.trigCh]);
+
+    dlog.state = DLOG_ARMED;
+}
+
+//
+// dlogTrigger - Fault trigger, safe from any ISR. Latched; it takes
+//               effect once the pre-trigger history is full.
+//
+void dlogTrigger(void)
+{
+    dlog.fault = 1;
+}
+
+//
+// dlogRun - Call at the sample rate, e.g. from the ADC ISR
+//
+void dlogRun(void)
+{
+    uint16_t i, idx, hit;
+    float v;
+
+    if((dlog.state != DLOG_ARMED) && (dlog.state != DLOG_TRIGGERED))
+    {
+        return;
+    }
+
+    if(++dlog.prescale < dlog.decimation)
+    {
+        return;
+    }
+    dlog.prescale = 0;
+
+    //
+    // One record: the same index in every channel array
+    //
+    idx = dlog.index;
+    for(i = 0; i < DLOG_CHANNELS; i++)
+    {
+        dlogData[i][idx] = dlogRead(&dlog.ch[i]);
+    }
+    dlog.index = (idx + 1 == DLOG_DEPTH) ? 0 : idx + 1;
+
+    if(dlog.state == DLOG_TRIGGERED)
+    {
+        if(--dlog.remain == 0)
+        {
+            dlog.start = dlog.index;
+            dlog.state = DLOG_FROZEN;
+        }
+        return;
+    }
+
+    //
+    // ARMED: look for the trigger once the pre-trigger history is there
+    //
+    v = dlogData[dlog.trigCh][idx];
+    if(dlog.filled < dlog.pre)
+    {
+        dlog.filled++;
+        dlog.last = v;
+        return;
+    }
+
+    switch(dlog.mode)
+    {
+        case DLOG_TRIG_ABOVE:
+            hit = v > dlog.level;
+            break;
+        case DLOG_TRIG_BELOW:
+            hit = v < dlog.level;
+            break;
+        case DLOG_TRIG_RISING:
+            hit = (dlog.last <= dlog.level) && (v > dlog.level);
+            break;
+        case DLOG_TRIG_FALLING:
+            hit = (dlog.last >= dlog.level) && (v < dlog.level);
+            break;
+        default:
+            hit = 0;
+            break;
+    }
+    dlog.last = v;
+
+    if(hit || dlog.fault)
+    {
+        dlog.trigger = idx;
+        dlog.remain = DLOG_DEPTH - dlog.pre - 1;
+        if(dlog.remain == 0)
+        {
+            dlog.start = dlog.index;
+            dlog.state = DLOG_FROZEN;
+        }
+        else
+        {
+            dlog.state = DLOG_TRIGGERED;
+        }
+    }
+}
+
+//
+// dlogSample - n-th oldest sample of channel ch in a frozen capture
+//
+float dlogSample(uint16_t ch, uint16_t n)
+{
+    uint16_t idx;
+
+    idx = dlog.start + n;
+    if(idx >= DLOG_DEPTH)
+    {
+        idx -= DLOG_DEPTH;
+    }
+
+    return(dlogData[ch][idx]);
+}
+
+#endif  // DATALOG_H
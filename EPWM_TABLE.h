@@ -0,0 +1,126 @@
+#ifndef EPWM_TABLE_H
+#define EPWM_TABLE_H
+
+//
+// Table-driven ePWM/HRPWM configuration.
+//
+// Each ePWM module is described by one const EPWM_CHANNEL_CFG row holding the
+// whole-register images for TBCTL, CMPCTL, AQCTLx, DBCTL, HRCNFG and HRPCTL
+// plus the phase and HR extension values. configEPWMTable() writes every
+// register of a module exactly once (SWFSYNC, being a strobe, is the only
+// second TBCTL write), instead of the per-bitfield read-modify-writes of the
+// unrolled configHRPWM() variants.
+//
+
+//
+// Register image builders. Bit positions follow the F28004x EPWM_REGS
+// bitfield definitions; arguments use the usual TB_xxx / CC_xxx / AQ_xxx /
+// DB_xxx / HR_xxx constants. TBCLK is fixed at SYSCLK (HSPCLKDIV = CLKDIV =
+// TB_DIV1) since HRPWM requires a PWM clock above 60MHz.
+//
+#define EPWM_TBCTL(ctrmode, phsen, prdld, syncosel, phsdir, freesoft)       \
+    ((uint16_t)(ctrmode)          | ((uint16_t)(phsen) << 2)     |          \
+     ((uint16_t)(prdld) << 3)     | ((uint16_t)(syncosel) << 4)  |          \
+     ((uint16_t)TB_DIV1 << 7)     | ((uint16_t)TB_DIV1 << 10)    |          \
+     ((uint16_t)(phsdir) << 13)   | ((uint16_t)(freesoft) << 14))
+
+#define EPWM_TBCTL_SWFSYNC      0x0040U     // TBCTL.SWFSYNC strobe
+
+#define EPWM_CMPCTL(loada, loadb, shdwa, shdwb)                             \
+    ((uint16_t)(loada)            | ((uint16_t)(loadb) << 2)     |          \
+     ((uint16_t)(shdwa) << 4)     | ((uint16_t)(shdwb) << 6))
+
+#define EPWM_AQCTL(zro, prd, cau, cad, cbu, cbd)                            \
+    ((uint16_t)(zro)              | ((uint16_t)(prd) << 2)       |          \
+     ((uint16_t)(cau) << 4)       | ((uint16_t)(cad) << 6)       |          \
+     ((uint16_t)(cbu) << 8)       | ((uint16_t)(cbd) << 10))
+
+#define EPWM_DBCTL(outmode, polsel, inmode, halfcycle)                      \
+    ((uint16_t)(outmode)          | ((uint16_t)(polsel) << 2)    |          \
+     ((uint16_t)(inmode) << 4)    | ((uint16_t)(halfcycle) << 15))
+
+#define EPWM_HRCNFG(edgmode, ctlmode, hrload, edgmodeb, ctlmodeb, hrloadb,  \
+                    autoconv)                                               \
+    ((uint16_t)(edgmode)          | ((uint16_t)(ctlmode) << 2)   |          \
+     ((uint16_t)(hrload) << 3)    | ((uint16_t)(autoconv) << 6)  |          \
+     ((uint16_t)(edgmodeb) << 8)  | ((uint16_t)(ctlmodeb) << 10) |          \
+     ((uint16_t)(hrloadb) << 11))
+
+#define EPWM_HRPCTL(hrpe, tbphshrloade)                                     \
+    ((uint16_t)(hrpe)             | ((uint16_t)(tbphshrloade) << 2))
+
+//
+// Per-module descriptor. CMPA/CMPB start at period / 2 (50% duty); the
+// remaining fields are loaded verbatim.
+//
+typedef struct
+{
+    volatile struct EPWM_REGS *regs;    // ePWM module
+    uint16_t tbctl;                     // EPWM_TBCTL()
+    uint16_t swfsync;                   // 1 = force sync once TBCLK runs
+    uint16_t cmpctl;                    // EPWM_CMPCTL()
+    uint16_t aqctla;                    // EPWM_AQCTL()
+    uint16_t aqctlb;                    // EPWM_AQCTL()
+    uint16_t dbctl;                     // EPWM_DBCTL()
+    uint16_t hrcnfg;                    // EPWM_HRCNFG()
+    uint16_t hrpctl;                    // EPWM_HRPCTL()
+    uint16_t tbphs;                     // TBPHS coarse phase
+    uint16_t tbphshr;                   // TBPHSHR fine phase
+    uint16_t trrem;                     // TRREM HR remainder
+    uint16_t cmpahr;                    // CMPAHR initial value
+    uint16_t cmpbhr;                    // CMPBHR initial value
+} EPWM_CHANNEL_CFG;
+
+//
+// configEPWMTable - Configure the ePWM modules listed in cfg[0..count-1]
+//                   for the given period. TBCLK is held off while the
+//                   modules are written so that all counters start together.
+//
+void configEPWMTable(const EPWM_CHANNEL_CFG *cfg, uint16_t count,
+                     uint16_t period)
+{
+    volatile struct EPWM_REGS *p;
+    uint32_t cmp;
+    uint16_t i;
+
+    cmp = (uint32_t)(period >> 1) << 16;
+
+    EALLOW;
+    CpuSysRegs.PCLKCR0.bit.TBCLKSYNC = 0;   // Disable TBCLK within the EPWM
+
+    for(i = 0; i < count; i++)
+    {
+        p = cfg[i].regs;
+
+        p->TBCTL.all  = cfg[i].tbctl;
+        p->TBPRD      = period;
+        p->TBCTR      = 0;
+        p->TBPHS.all  = ((uint32_t)cfg[i].tbphs << 16) | cfg[i].tbphshr;
+        p->TRREM.all  = cfg[i].trrem;
+        p->CMPCTL.all = cfg[i].cmpctl;
+        p->CMPA.all   = cmp | cfg[i].cmpahr;
+        p->CMPB.all   = cmp | cfg[i].cmpbhr;
+        p->AQCTLA.all = cfg[i].aqctla;
+        p->AQCTLB.all = cfg[i].aqctlb;
+        p->DBCTL.all  = cfg[i].dbctl;
+        p->HRCNFG.all = cfg[i].hrcnfg;
+        p->HRPCTL.all = cfg[i].hrpctl;
+    }
+
+    CpuSysRegs.PCLKCR0.bit.TBCLKSYNC = 1;   // Enable TBCLK within the EPWM
+
+    //
+    // Synchronize high resolution phase to start HR period
+    //
+    for(i = 0; i < count; i++)
+    {
+        if(cfg[i].swfsync)
+        {
+            cfg[i].regs->TBCTL.all = cfg[i].tbctl | EPWM_TBCTL_SWFSYNC;
+        }
+    }
+
+    EDIS;
+}
+
+#endif  // EPWM_TABLE_H
@@ -0,0 +1,50 @@
+#ifndef FAULT_RECORD_H
+#define FAULT_RECORD_H
+
+//
+// Default-interrupt fault record.
+//
+// Every PIE vector without an application ISR points at DEFAULT_ISR()
+// (f28004x_defaultisr.c). When one fires, it snapshots which vector was
+// taken and the interrupt enable/flag registers into faultRecord. It then
+// forces a one-shot trip on ePWM1..8 and halts.
+//
+// faultRecord is placed in the "faultrec" section in RAMLS6, NOINIT, so
+// neither the C startup nor a warm reset clears it. After a reset,
+// faultRecordValid() tells whether it holds a capture. vector is the entry
+// index in PieVectTableInit (f28004x_pievect.c), whose comments name the
+// interrupt.
+//
+
+//
+// Defines
+//
+#define FAULT_MAGIC             0xFA017EC0UL    // Record holds a capture
+#define FAULT_PIE_VECT_BASE     0x0D00          // PIE vector table address
+#define FAULT_PIE_GROUPS        12
+
+typedef struct
+{
+    uint32_t magic;             // FAULT_MAGIC once a capture is stored
+    uint16_t count;             // # of default interrupts taken
+    uint16_t vector;            // PieVectTableInit index of the last one
+    uint16_t pieVect;           // PIECTRL.PIEVECT, fetched vector address
+    uint16_t ier;               // CPU IER / IFR at entry
+    uint16_t ifr;
+    uint16_t pieier[FAULT_PIE_GROUPS];  // PIEIERx / PIEIFRx at entry
+    uint16_t pieifr[FAULT_PIE_GROUPS];
+    uint32_t timestamp;         // SYSCLKs, CPU Timer 1 (TIMEBASE.h)
+} FAULT_RECORD;
+
+extern FAULT_RECORD faultRecord;
+
+interrupt void DEFAULT_ISR(void);
+
+//
+// faultRecordValid - 1 if faultRecord holds a capture from before reset
+// faultRecordClear - Discard it once reported
+//
+#define faultRecordValid()      (faultRecord.magic == FAULT_MAGIC)
+#define faultRecordClear()      (faultRecord.magic = 0)
+
+#endif  // FAULT_RECORD_H
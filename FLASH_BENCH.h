@@ -0,0 +1,202 @@
+#ifndef FLASH_BENCH_H
+#define FLASH_BENCH_H
+
+//
+// RAM vs Flash execution benchmark.
+//
+// Times one control-loop iteration (a float32 2p2z step and the CMPA:CMPAHR
+// conversion, the body of a typical ADC ISR) from two copies of the same
+// code: flashBenchRam() in .TI.ramfunc and flashBenchFlash() in .text. The
+// Flash copy is timed once per flash read-interface setting, with the
+// RWAIT programmed by InitFlash():
+//
+//   FLASH_BENCH_RAM         - RAM copy (reference)
+//   FLASH_BENCH_FLASH       - Flash, prefetch + data cache (InitFlash())
+//   FLASH_BENCH_NO_CACHE    - Flash, prefetch only
+//   FLASH_BENCH_NO_PREFETCH - Flash, data cache only
+//   FLASH_BENCH_NONE        - Flash, every fetch pays RWAIT
+//
+// Results are SYSCLKs per call (timebase overhead removed) in flashBench[]
+// for the watch window. min is the steady state; max includes the first,
+// cold call. In a RAM build (no _FLASH) both copies run from RAM and only
+// the first two entries are filled.
+//
+// This is a debug build option (FLASH_BENCH = 1): it adds to the boot time
+// and switches the prefetch and data cache while it runs. It times a model
+// kernel, not the ISR; the cost of the real adcA1ISR() is
+// isrStats[ISR_ID_ADCA1] (ISR_PROFILE.h) in every build. To compare the
+// two, run bench_dump.js on the CPU1_RAM and CPU1_FLASH builds and
+//
+//   python opt_bench.py CPU1_RAM CPU1_FLASH
+//
+
+#include "TIMEBASE.h"
+#include "COMPENSATOR.h"
+
+#ifndef FLASH_BENCH
+#define FLASH_BENCH             0       // 1 = build in the benchmark
+#endif
+
+#if FLASH_BENCH
+
+//
+// Defines
+//
+#define FLASH_BENCH_RUNS        64      // Calls timed per mode
+#define FLASH_BENCH_PERIOD      500     // TBPRD for the CMPA conversion
+
+#define FLASH_BENCH_RAM         0
+#define FLASH_BENCH_FLASH       1
+#define FLASH_BENCH_NO_CACHE    2
+#define FLASH_BENCH_NO_PREFETCH 3
+#define FLASH_BENCH_NONE        4
+#define FLASH_BENCH_MODES       5
+
+typedef struct
+{
+    uint32_t min;               // SYSCLKs per call
+    uint32_t max;
+    uint32_t total;             // Sum over FLASH_BENCH_RUNS calls
+} FLASH_BENCH_RESULT;
+
+//
+// Globals
+//
+FLASH_BENCH_RESULT flashBench[FLASH_BENCH_MODES];
+uint16_t flashBenchRwait;       // FRDCNTL.RWAIT during the run, 0 = RAM
+uint32_t flashBenchSink;        // Keeps the kernel results live
+
+//
+// FLASH_BENCH_KERNEL - One loop iteration. The 2p2z is written out rather
+//                      than calling cntlRun2p2zF32()/cntlUpdate2p2zF32(),
+//                      which themselves run from RAM, so each copy fetches
+//                      all of its code from its own memory.
+//
+#define FLASH_BENCH_KERNEL(name)                                            \
+uint32_t name(CNTL_2P2Z_F32 *c, float e)                                    \
+{                                                                           \
+    float u, cmp;                                                           \
+    uint32_t coarse;                                                        \
+                                                                            \
+    u = c->b0 * e + c->partial;                                             \
+    u = (u < c->outMin) ? c->outMin : ((u > c->outMax) ? c->outMax : u);    \
+                                                                            \
+    c->e2 = c->e1;                                                          \
+    c->e1 = e;                                                              \
+    c->u2 = c->u1;                                                          \
+    c->u1 = u;                                                              \
+    c->partial = c->b1 * c->e1 + c->b2 * c->e2                              \
+               - c->a1 * c->u1 - c->a2 * c->u2;                             \
+                                                                            \
+    cmp = u * FLASH_BENCH_PERIOD;                                           \
+    coarse = (uint32_t)cmp;                                                 \
+                                                                            \
+    return((coarse << 16) |                                                 \
+           ((uint32_t)((cmp - (float)coarse) * 256.0f) << 8));              \
+}
+
+#pragma CODE_SECTION(flashBenchRam, ".TI.ramfunc");
+FLASH_BENCH_KERNEL(flashBenchRam)
+FLASH_BENCH_KERNEL(flashBenchFlash)
+
+//
+// flashBenchSetIntf - Enable/disable the Flash prefetch and data cache.
+//                     Must not run from Flash itself.
+//
+#pragma CODE_SECTION(flashBenchSetIntf, ".TI.ramfunc");
+void flashBenchSetIntf(uint16_t prefetch, uint16_t cache)
+{
+#ifdef _FLASH
+    EALLOW;
+    Flash0CtrlRegs.FRD_INTF_CTRL.bit.PREFETCH_EN = prefetch;
+    Flash0CtrlRegs.FRD_INTF_CTRL.bit.DATA_CACHE_EN = cache;
+    EDIS;
+
+    //
+    // Let the new setting take effect before the next Flash fetch
+    //
+    __asm(" RPT #7 || NOP");
+#endif
+}
+
+//
+// flashBenchMode - Time FLASH_BENCH_RUNS calls of kernel into r
+//
+void flashBenchMode(FLASH_BENCH_RESULT *r,
+                    uint32_t (*kernel)(CNTL_2P2Z_F32 *c, float e))
+{
+    CNTL_2P2Z_F32 c;
+    uint32_t t0, t1, overhead, t;
+    uint16_t i;
+
+    c.b0 = 0.5f;    c.b1 = -0.4f;   c.b2 = 0.1f;
+    c.a1 = -1.2f;   c.a2 = 0.3f;
+    c.outMin = 0.0f;
+    c.outMax = 0.95f;
+    cntlReset2p2zF32(&c);
+
+    t0 = timebaseNow();
+    t1 = timebaseNow();
+    overhead = t1 - t0;
+
+    r->min = 0xFFFFFFFF;
+    r->max = 0;
+    r->total = 0;
+
+    for(i = 0; i < FLASH_BENCH_RUNS; i++)
+    {
+        t0 = timebaseNow();
+        flashBenchSink += kernel(&c, (i & 1) ? 0.01f : -0.01f);
+        t1 = timebaseNow();
+
+        t = t1 - t0 - overhead;
+        if(t < r->min)
+        {
+            r->min = t;
+        }
+        if(t > r->max)
+        {
+            r->max = t;
+        }
+        r->total += t;
+    }
+}
+
+//
+// runFlashBench - Fill flashBench[]. Call after initTimebase() and
+//                 InitSysCtrl() (which sets RWAIT, prefetch and cache);
+//                 interrupts are held off for the duration and the flash
+//                 interface is left as InitFlash() configured it.
+//
+void runFlashBench(void)
+{
+    uint16_t intm;
+
+    intm = __disable_interrupts();
+
+    flashBenchMode(&flashBench[FLASH_BENCH_RAM], flashBenchRam);
+    flashBenchMode(&flashBench[FLASH_BENCH_FLASH], flashBenchFlash);
+    flashBenchRwait = 0;
+
+#ifdef _FLASH
+    flashBenchRwait = Flash0CtrlRegs.FRDCNTL.bit.RWAIT;
+
+    flashBenchSetIntf(1, 0);
+    flashBenchMode(&flashBench[FLASH_BENCH_NO_CACHE], flashBenchFlash);
+    flashBenchSetIntf(0, 1);
+    flashBenchMode(&flashBench[FLASH_BENCH_NO_PREFETCH], flashBenchFlash);
+    flashBenchSetIntf(0, 0);
+    flashBenchMode(&flashBench[FLASH_BENCH_NONE], flashBenchFlash);
+    flashBenchSetIntf(1, 1);
+#endif
+
+    __restore_interrupts(intm);
+}
+
+#else
+
+#define runFlashBench()
+
+#endif  // FLASH_BENCH
+
+#endif  // FLASH_BENCH_H
@@ -1,3 +1,73 @@
+//
+// Scope timing probes.
+//
+// Each probe is a GPIO named by a port letter and bit in the table below.
+// probeSet(), probeClear() and probeToggle() expand to a single 32-bit
+// write of a constant mask to GPxSET / GPxCLEAR / GPxTOGGLE, so they cost
+// a few cycles, never read-modify-write the data register and cannot
+// disturb other pins from an ISR. Build with GPIO_PROBES = 0 to remove
+// every probe.
+//
+
+#ifndef GPIO_PROBES
+#define GPIO_PROBES             1       // 0 = compile out all probes
+#endif
+
+//
+// Probe table - PROBE_xxx  port, bit
+//
+#define PROBE_ADCA1_ISR         A, 13   // GPIO13 - adcA1ISR()
+#define PROBE_SCHED_TICK        A, 16   // GPIO16 - schedTickISR()
+#define PROBE_SCHED_TASK        A, 17   // GPIO17 - scheduled task running
+
+#define PROBE_LIST(X)                                                       \
+    X(PROBE_ADCA1_ISR)                                                      \
+    X(PROBE_SCHED_TICK)                                                     \
+    X(PROBE_SCHED_TASK)
+
+//
+// The extra level of macros expands a probe name into its port, bit pair
+// before it is pasted into the register name
+//
+#define PROBE_WRITE_(port, bit, op)                                         \
+    (GpioDataRegs.GP##port##op.all = (1UL << (bit)))
+#define PROBE_GPIO_A(bit)       (bit)
+#define PROBE_GPIO_B(bit)       ((bit) + 32)
+#define PROBE_GPIO_(port, bit)  PROBE_GPIO_##port(bit)
+#define PROBE_SET_(port, bit)       PROBE_WRITE_(port, bit, SET)
+#define PROBE_CLEAR_(port, bit)     PROBE_WRITE_(port, bit, CLEAR)
+#define PROBE_TOGGLE_(port, bit)    PROBE_WRITE_(port, bit, TOGGLE)
+
+#if GPIO_PROBES
+#define probeSet(id)            PROBE_SET_(id)
+#define probeClear(id)          PROBE_CLEAR_(id)
+#define probeToggle(id)         PROBE_TOGGLE_(id)
+#define PROBE_INIT_(id)         initProbePin(PROBE_GPIO_(id));
+#else
+#define probeSet(id)
+#define probeClear(id)
+#define probeToggle(id)
+#define PROBE_INIT_(id)
+#endif
+
+//
+// initProbePin - GPIO output, driven low
+//
+void initProbePin(uint16_t gpio)
+{
+    GPIO_SetupPinMux(gpio, GPIO_MUX_CPU1, 0);
+    GPIO_SetupPinOptions(gpio, GPIO_OUTPUT, GPIO_PUSHPULL);
+    GPIO_WritePin(gpio, 0);
+}
+
+//
+// initProbes - Configure every pin in PROBE_LIST
+//
+void initProbes(void)
+{
+    PROBE_LIST(PROBE_INIT_)
+}
+
 //
 // initHRPWM1GPIO - Initialize HRPWM1 GPIOs
 //
@@ -41,10 +111,6 @@ void initHRPWM1GPIO(void)
     // This specifies which of the possible GPIO pins will be EPWM1 functional
     // pins.
     //
-    GpioCtrlRegs.GPAMUX1.bit.GPIO13 = 0;   // Configure GPIO13 as GPIO OUT
-    GpioCtrlRegs.GPADIR.bit.GPIO13 = 1;   // Configure GPIO13 as GPIO OUT
-
-
     GpioCtrlRegs.GPAMUX1.bit.GPIO0 = 1;   // Configure GPIO0 as EPWM1A
     GpioCtrlRegs.GPAMUX1.bit.GPIO1 = 1;   // Configure GPIO1 as EPWM1B
 
@@ -64,4 +130,9 @@ void initHRPWM1GPIO(void)
     GpioCtrlRegs.GPAMUX1.bit.GPIO11 = 1;   // Configure GPIO5 as EPWM3B
 
     EDIS;
+
+    //
+    // Timing probes (GPIO13 and friends), see PROBE_LIST
+    //
+    initProbes();
 }
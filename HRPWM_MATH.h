@@ -0,0 +1,121 @@
+#ifndef HRPWM_MATH_H
+#define HRPWM_MATH_H
+
+//
+// Fixed-point Q16 kernels for the control path.
+//
+// All scale factors are folded into integer constants at compile time, so
+// none of these kernels divide or touch the floating point runtime (no
+// FS$$DIV from rts2800_fpu32). Q16 values are 16.16 fixed point.
+//
+
+//
+// Compile-time constant helpers (constant expressions only)
+//
+#define HRMATH_Q16(x)           ((int32_t)((x) * 65536.0 + 0.5))
+#define HRMATH_ADC_MAX          4095        // 12-bit ADC full scale code
+#define HRMATH_SYNC_DELAY       2           // TBCLKs from SYNCO to the
+                                            // slave counter load
+
+//
+// HRMATH_ADC_GAIN_Q24 - Q24 gain converting one ADC count into engineering
+//                       units, for a signal that reads fullscale units at
+//                       HRMATH_ADC_MAX. Valid for fullscale < 128.
+//
+#define HRMATH_ADC_GAIN_Q24(fullscale)                                      \
+    ((int32_t)((fullscale) / (double)HRMATH_ADC_MAX * 16777216.0 + 0.5))
+
+//
+// HRMATH_ADC_COUNTS - ADC code corresponding to value engineering units
+//
+#define HRMATH_ADC_COUNTS(value, fullscale)                                 \
+    ((uint16_t)((value) / (double)(fullscale) * HRMATH_ADC_MAX + 0.5))
+
+//
+// The kernels run in ISR context, keep them in RAM (.TI.ramfunc)
+//
+#pragma CODE_SECTION(hrmathAdcToQ16, ".TI.ramfunc");
+#pragma CODE_SECTION(hrmathScaleQ16, ".TI.ramfunc");
+#pragma CODE_SECTION(hrmathDutyToCmp, ".TI.ramfunc");
+#pragma CODE_SECTION(hrmathPhaseToTbphs, ".TI.ramfunc");
+#pragma CODE_SECTION(hrmathLagToSync, ".TI.ramfunc");
+
+//
+// hrmathAdcToQ16 - Scale an ADC result into engineering units (Q16) using a
+//                  gain from HRMATH_ADC_GAIN_Q24()
+//
+static inline int32_t hrmathAdcToQ16(uint16_t adc, int32_t gainQ24)
+{
+    return(((int32_t)adc * gainQ24 + 0x80) >> 8);
+}
+
+//
+// hrmathScaleQ16 - Return counts * frac as a 16.16 value. The upper word is
+//                  the coarse TBCLK count and the lower word the HR extension
+//                  in the layout used by CMPA:CMPAHR, CMPB:CMPBHR and
+//                  TBPHS:TBPHSHR, so the result can be written to the .all
+//                  member directly. With AUTOCONV the lower 8 bits of the HR
+//                  word are ignored by the hardware.
+//
+static inline uint32_t hrmathScaleQ16(uint16_t counts, uint16_t fracQ16)
+{
+    return((uint32_t)counts * fracQ16);
+}
+
+//
+// hrmathDutyToCmp - Split a Q16 duty cycle (0 - 0.99998) of period into the
+//                   CMPx:CMPxHR register image
+//
+static inline uint32_t hrmathDutyToCmp(uint16_t period, uint16_t dutyQ16)
+{
+    return(hrmathScaleQ16(period, dutyQ16));
+}
+
+//
+// hrmathPhaseToTbphs - Split a Q16 phase (fraction of one switching period)
+//                      into the TBPHS:TBPHSHR register image. countsPerPeriod
+//                      is the number of TBCLKs in one switching period
+//                      (2 * TBPRD in up-down count mode).
+//
+static inline uint32_t hrmathPhaseToTbphs(uint16_t countsPerPeriod,
+                                          uint16_t phaseQ16)
+{
+    return(hrmathScaleQ16(countsPerPeriod, phaseQ16));
+}
+
+//
+// hrmathLagToSync - TBPHS:TBPHSHR image and PHSDIR (TB_UP/TB_DOWN) that place
+//                   an up-down counting slave lag (Q16 fraction of one
+//                   switching period) behind the sync master:
+//
+//   lead L = (1 - lag) * 2 * period + HRMATH_SYNC_DELAY, modulo 2 * period
+//   L <= period: TBPHS:TBPHSHR = L,              PHSDIR = up
+//   L >  period: TBPHS:TBPHSHR = 2 * period - L, PHSDIR = down
+//
+//                   L is carried in 16.16 so the HR part of the mirrored
+//                   count-down position is exact.
+//
+static inline uint32_t hrmathLagToSync(uint16_t period, uint16_t lag,
+                                       uint16_t *phsdir)
+{
+    uint32_t span, lead;
+
+    span = (uint32_t)(2 * period) << 16;
+    lead = hrmathPhaseToTbphs(2 * period, (uint16_t)(0 - lag)) +
+           ((uint32_t)HRMATH_SYNC_DELAY << 16);
+    if(lead >= span)
+    {
+        lead -= span;
+    }
+
+    if(lead <= ((uint32_t)period << 16))
+    {
+        *phsdir = TB_UP;
+        return(lead);
+    }
+
+    *phsdir = TB_DOWN;
+    return(span - lead);
+}
+
+#endif  // HRPWM_MATH_H
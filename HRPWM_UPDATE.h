@@ -0,0 +1,202 @@
+#ifndef HRPWM_UPDATE_H
+#define HRPWM_UPDATE_H
+
+//
+// Atomic multi-module high-resolution update.
+//
+// The modules of a group are put in one-shot global load mode with their
+// GLDCTL2 registers linked to one master module. updateHRPWM() writes the
+// new period/compare values of every module into the shadow registers and
+// then arms the one-shot load with a single OSHTLD write on the master, so
+// every module latches TBPRD:TBPRDHR, CMPA:CMPAHR and CMPB:CMPBHR on its
+// first CTR = 0 after the arm, all within one switching period.
+//
+// TBPHS:TBPHSHR has no shadow register. It is loaded on the module's next
+// SYNCI, and only if something drives the sync chain: ePWM1 leaves
+// SYNCOSEL = TB_SYNC_DISABLE unless initDAB()/initIBC() set it to CTR = 0
+// and send one sync per dabCommit()/ibcCommit().
+//
+// OSHTLD reads back 0 whether or not the load has happened, so
+// updateHRPWM() paces itself instead. When it arms a set it reads the
+// master's counter and works out how long it is to the CTR = 0 that
+// latches the set. Until then (TIMEBASE.h counter) it stages nothing and
+// returns 0, because writing the shadows any sooner could split one
+// update set across two loads. A one-shot sync armed along with the set
+// (dabCommit(), ibcCommit()) fires on the same CTR = 0 and restarts the
+// wait. HRPWM_GLD_MARGIN TBCLKs are added to the wait so that the slaves
+// have loaded TBPHS from that sync before the next set writes it. A
+// caller that runs once per switching period, away from the master's
+// CTR = 0, such as the ADC ISR, gets every set through.
+//
+// A refused set is not copied anywhere. It stays pending in the caller's
+// upd[] table, and the next call stages whatever the table holds then, so
+// the latest values win.
+//
+
+#include "TIMEBASE.h"
+
+//
+// EPWMXLINK module numbers
+//
+#define HRPWM_LINK_EPWM1        0
+#define HRPWM_LINK_EPWM2        1
+#define HRPWM_LINK_EPWM3        2
+#define HRPWM_LINK_EPWM4        3
+#define HRPWM_LINK_EPWM5        4
+#define HRPWM_LINK_EPWM6        5
+#define HRPWM_LINK_EPWM7        6
+#define HRPWM_LINK_EPWM8        7
+
+#define HRPWM_GLD_MARGIN        4       // TBCLKs past the latching CTR = 0
+
+//
+// One update target. Each module should appear at most once per update set.
+//
+typedef struct
+{
+    volatile struct EPWM_REGS *regs;    // ePWM module
+    uint16_t tbprd;                     // TBPRD
+    uint16_t tbprdhr;                   // TBPRDHR (Q16, lower 8 bits ignored)
+    uint16_t cmpa;                      // CMPA
+    uint16_t cmpahr;                    // CMPAHR
+    uint16_t cmpb;                      // CMPB
+    uint16_t cmpbhr;                    // CMPBHR
+    uint16_t tbphs;                     // TBPHS
+    uint16_t tbphshr;                   // TBPHSHR
+} HRPWM_UPDATE;
+
+//
+// Module whose GLDCTL2 write arms the whole group
+//
+volatile struct EPWM_REGS *hrpwmGldMaster;
+uint32_t hrpwmGldCycle;         // Master TBCLKs from CTR = 0 to CTR = 0
+uint16_t hrpwmGldDiv;           // SYSCLKs per master TBCLK
+uint32_t hrpwmGldArmed;         // timebaseNow() at the last OSHTLD/OSHTSYNC
+uint32_t hrpwmGldWait;          // SYSCLKs from hrpwmGldArmed to the latch
+uint32_t hrpwmGldSkips;         // # of updateHRPWM() calls turned away
+uint16_t hrpwmGldSets;          // # of update sets armed (wraps)
+
+//
+// Called from the per-period path, and not inlined at -Ooff
+//
+#pragma CODE_SECTION(hrpwmSyncArmed, ".TI.ramfunc");
+
+//
+// hrpwmSyncArmed - Start updateHRPWM()'s wait after an OSHTLD or OSHTSYNC
+//                  write on the master. Both act on its next CTR = 0, so
+//                  the wait runs to there plus HRPWM_GLD_MARGIN. The
+//                  counter is read before the timer, which can only make
+//                  the wait longer.
+//
+static inline void hrpwmSyncArmed(void)
+{
+    uint32_t tbclks;
+
+    tbclks = hrpwmGldMaster->TBCTR;
+    if(hrpwmGldMaster->TBSTS.bit.CTRDIR == 1)   // Counting up
+    {
+        tbclks = hrpwmGldCycle - tbclks;
+    }
+
+    hrpwmGldArmed = timebaseNow();
+    hrpwmGldWait = (tbclks + HRPWM_GLD_MARGIN) * hrpwmGldDiv;
+}
+
+//
+// initHRPWMGlobalLoad - Enable one-shot global load on CTR = 0 for
+//                       regs[0..count-1] and link their GLDCTL2 to the
+//                       module numbered link (HRPWM_LINK_EPWMx), which is
+//                       passed as master. Call after the master's period
+//                       and clock are set, and again if they change.
+//
+void initHRPWMGlobalLoad(volatile struct EPWM_REGS * const regs[],
+                         uint16_t count,
+                         volatile struct EPWM_REGS *master, uint16_t link)
+{
+    uint16_t i;
+
+    EALLOW;
+    for(i = 0; i < count; i++)
+    {
+        regs[i]->GLDCFG.bit.TBPRD_TBPRDHR = 1;  // Period and compares are
+        regs[i]->GLDCFG.bit.CMPA_CMPAHR = 1;    // loaded by the global
+        regs[i]->GLDCFG.bit.CMPB_CMPBHR = 1;    // load strobe
+
+        regs[i]->GLDCTL.bit.GLDMODE = 0;        // Load on CTR = 0
+        regs[i]->GLDCTL.bit.GLDPRD = 1;         // on every event
+        regs[i]->GLDCTL.bit.OSHTMODE = 1;       // once armed by OSHTLD
+        regs[i]->GLDCTL.bit.GLD = 1;            // Enable global load
+
+        regs[i]->EPWMXLINK.bit.GLDCTL2LINK = link;
+    }
+    EDIS;
+
+    //
+    // TBCLK = EPWMCLK = SYSCLK divided by CLKDIV and HSPCLKDIV
+    //
+    hrpwmGldMaster = master;
+    hrpwmGldDiv = 1U << master->TBCTL.bit.CLKDIV;
+    if(master->TBCTL.bit.HSPCLKDIV != 0)
+    {
+        hrpwmGldDiv *= 2 * master->TBCTL.bit.HSPCLKDIV;
+    }
+    if(master->TBCTL.bit.CTRMODE == TB_COUNT_UPDOWN)
+    {
+        hrpwmGldCycle = 2UL * master->TBPRD;
+    }
+    else
+    {
+        hrpwmGldCycle = (uint32_t)master->TBPRD + 1;
+    }
+
+    hrpwmGldArmed = timebaseNow();
+    hrpwmGldWait = 0;
+    hrpwmGldSkips = 0;
+}
+
+//
+// Per-period update, runs from RAM
+//
+#pragma CODE_SECTION(updateHRPWM, ".TI.ramfunc");
+
+//
+// updateHRPWM - Stage upd[0..count-1] in the shadow registers and commit
+//               them together on the next CTR = 0 of the group. Returns 1,
+//               or 0 without touching the registers while the previous
+//               update has not latched yet; keep upd[] and call again.
+//
+uint16_t updateHRPWM(const HRPWM_UPDATE *upd, uint16_t count)
+{
+    volatile struct EPWM_REGS *p;
+    uint32_t now;
+    uint16_t i;
+
+    now = timebaseNow();
+    if(now - hrpwmGldArmed < hrpwmGldWait)
+    {
+        hrpwmGldSkips++;
+        return(0);
+    }
+
+    for(i = 0; i < count; i++)
+    {
+        p = upd[i].regs;
+
+        p->TBPRD     = upd[i].tbprd;
+        p->TBPRDHR   = upd[i].tbprdhr;
+        p->CMPA.all  = ((uint32_t)upd[i].cmpa << 16) | upd[i].cmpahr;
+        p->CMPB.all  = ((uint32_t)upd[i].cmpb << 16) | upd[i].cmpbhr;
+        p->TBPHS.all = ((uint32_t)upd[i].tbphs << 16) | upd[i].tbphshr;
+    }
+
+    //
+    // Arm the one-shot load on every linked module at once
+    //
+    hrpwmGldMaster->GLDCTL2.bit.OSHTLD = 1;
+    hrpwmSyncArmed();
+    hrpwmGldSets++;
+
+    return(1);
+}
+
+#endif  // HRPWM_UPDATE_H
@@ -0,0 +1,245 @@
+#ifndef IBC_DRIVER_H
+#define IBC_DRIVER_H
+
+//
+// Interleaved multiphase boost converter driver.
+//
+// Phase 0 is the sync master; phases 1..N-1 are up-down counting slave
+// modules staged through their HRPWM_UPDATE entries. With n phases active,
+// active phase k lags the master by k/n of the switching period in high
+// resolution (see hrmathLagToSync()). The k/n lags are worked out in Flash
+// whenever n changes, so ibcModulate() does not divide. All phases share
+// one TBPRD: a period change must go to the master in the same update set
+// as the slaves, or the master must keep a fixed period. Inactive (shed)
+// phases are parked low with the action-qualifier continuous software
+// force, so the leg's dead-band must not invert an output (DB_ACTV_HI).
+//
+// Phases are shed from the top: with n active, phases 0..n-1 switch. Same
+// call sequence as the DAB modulator:
+//
+//   ibcModulate(&ibc);                // offsets for ibc.active phases
+//   if(updateHRPWM(upd, count))       // stage TBPHS with period/compares
+//       ibcCommit(&ibc);              // force/release, arm one-shot sync
+//
+// AQCSFRC is shadowed and loads on each leg's CTR = PRD, where its output
+// is low between pulses (set on CAD, clear on CAU, centred on CTR = 0),
+// and the new phase offsets load on one master sync, so shedding and
+// adding take effect on period boundaries without partial pulses. Like
+// dabCommit(), ibcCommit() goes through once per accepted update set and
+// returns 0 otherwise.
+//
+
+#include "HRPWM_UPDATE.h"
+#include "HRPWM_MATH.h"
+
+//
+// Defines
+//
+#define IBC_MIN_PHASES          2
+#define IBC_MAX_PHASES          6
+#define IBC_SYNC_CTR_ZERO       1       // SYNCOSEL - CTR = 0
+#define IBC_CSF_OFF             0       // AQCSFRC - no force
+#define IBC_CSF_LOW             1       // AQCSFRC - force low
+#define IBC_RLDCSF_PRD          1       // AQSFRC - load AQCSFRC on CTR = PRD
+
+typedef struct
+{
+    volatile struct EPWM_REGS *master;  // Phase 0, sync master
+    HRPWM_UPDATE *upd;          // Phases 1..phases-1
+    uint16_t period;            // TBPRD shared by all phases
+    uint16_t phases;            // # of phases wired (IBC_MIN..MAX_PHASES)
+    uint16_t active;            // # of phases switching
+    uint16_t capacity;          // Load one phase carries (Q16 of rated)
+    uint16_t hysteresis;        // Shedding hysteresis (Q16 of rated)
+    uint16_t lag[IBC_MAX_PHASES - 1];   // Slave lags for active (Q16)
+    uint16_t phsdir[IBC_MAX_PHASES - 1];
+    uint16_t trrem[IBC_MAX_PHASES - 1];
+    uint16_t changes;           // # of active phase count changes
+    uint16_t set;               // hrpwmGldSets at the last commit
+    uint32_t skips;             // # of ibcCommit() calls turned away
+} IBC_DRV;
+
+//
+// ibcSpreadLags - Lag of each slave for the active phase count, k/active of
+//                 the period for phase k. Shed phases keep their last lag.
+//
+void ibcSpreadLags(IBC_DRV *d)
+{
+    uint16_t i;
+
+    for(i = 0; i + 1 < d->active; i++)
+    {
+        d->lag[i] = (uint16_t)((0x10000UL * (i + 1)) / d->active);
+    }
+}
+
+//
+// initIBC - Set up an interleaved converter of phases phases, phase 0 on
+//           master and phases 1..phases-1 on upd[0..phases-2]. All phases
+//           start active. The slave modules must have PHSEN set and pass
+//           the sync chain through (SYNCOSEL = SYNCI).
+//
+void initIBC(IBC_DRV *d, volatile struct EPWM_REGS *master,
+             HRPWM_UPDATE *upd, uint16_t phases, uint16_t period)
+{
+    uint16_t i;
+
+    if(phases < IBC_MIN_PHASES)
+    {
+        phases = IBC_MIN_PHASES;
+    }
+    if(phases > IBC_MAX_PHASES)
+    {
+        phases = IBC_MAX_PHASES;
+    }
+
+    d->master = master;
+    d->upd = upd;
+    d->period = period;
+    d->phases = phases;
+    d->active = phases;
+    d->capacity = (uint16_t)(0xFFFFUL / phases);
+    d->hysteresis = d->capacity >> 3;
+    d->changes = 0;
+    d->set = hrpwmGldSets;
+    d->skips = 0;
+
+    for(i = 0; i < phases - 1; i++)
+    {
+        d->phsdir[i] = TB_UP;
+        d->trrem[i] = 0;
+    }
+    ibcSpreadLags(d);
+
+    EALLOW;
+    master->TBCTL.bit.SYNCOSEL = IBC_SYNC_CTR_ZERO;
+    master->TBCTL2.bit.OSHTSYNCMODE = 1;
+    for(i = 0; i < phases - 1; i++)
+    {
+        upd[i].regs->AQSFRC.bit.RLDCSF = IBC_RLDCSF_PRD;
+    }
+    EDIS;
+}
+
+//
+// ibcSetActive - Select how many phases switch (1..phases), returns the
+//                value used. Takes effect on the next ibcModulate() /
+//                ibcCommit().
+//
+uint16_t ibcSetActive(IBC_DRV *d, uint16_t active)
+{
+    if(active < 1)
+    {
+        active = 1;
+    }
+    if(active > d->phases)
+    {
+        active = d->phases;
+    }
+
+    if(active != d->active)
+    {
+        d->active = active;
+        d->changes++;
+        ibcSpreadLags(d);
+    }
+
+    return(d->active);
+}
+
+//
+// ibcAutoPhase - Choose the active phase count for load (Q16 of rated
+//                load). Phases are added as soon as the active ones would
+//                exceed their capacity and shed one at a time once the load
+//                fits in one phase less with hysteresis to spare.
+//
+uint16_t ibcAutoPhase(IBC_DRV *d, uint16_t load)
+{
+    uint16_t need;
+
+    need = (uint16_t)(((uint32_t)load + d->capacity - 1) / d->capacity);
+
+    if(need > d->active)
+    {
+        return(ibcSetActive(d, need));
+    }
+
+    if((need < d->active) &&
+       ((uint32_t)load + d->hysteresis <
+        (uint32_t)(d->active - 1) * d->capacity))
+    {
+        return(ibcSetActive(d, d->active - 1));
+    }
+
+    return(d->active);
+}
+
+//
+// Per-period path runs from RAM; setup and phase selection stay in Flash
+//
+#pragma CODE_SECTION(ibcModulate, ".TI.ramfunc");
+#pragma CODE_SECTION(ibcCommit, ".TI.ramfunc");
+
+//
+// ibcModulate - Spread the active phases evenly over the switching period
+//
+void ibcModulate(IBC_DRV *d)
+{
+    uint32_t tbphs;
+    uint16_t i;
+
+    for(i = 0; i < d->phases - 1; i++)
+    {
+        //
+        // Slave i is phase i + 1; shed phases keep their last offset
+        //
+        if(i + 1 >= d->active)
+        {
+            continue;
+        }
+
+        tbphs = hrmathLagToSync(d->period, d->lag[i], &d->phsdir[i]);
+
+        d->upd[i].tbphs = (uint16_t)(tbphs >> 16);
+        d->upd[i].tbphshr = (uint16_t)tbphs;
+        d->trrem[i] = (uint16_t)tbphs >> 8;
+    }
+}
+
+//
+// ibcCommit - Park shed phases, release active ones, set PHSDIR/TRREM and
+//             let the master emit one SYNCO, after updateHRPWM(). Returns
+//             1, or 0 with nothing written if there is no new update set.
+//             The live PHSDIR/TRREM writes are safe for the reasons given
+//             at dabCommit().
+//
+uint16_t ibcCommit(IBC_DRV *d)
+{
+    volatile struct EPWM_REGS *p;
+    uint16_t csf, i;
+
+    if(d->set == hrpwmGldSets)
+    {
+        d->skips++;
+        return(0);
+    }
+    d->set = hrpwmGldSets;
+
+    for(i = 0; i < d->phases - 1; i++)
+    {
+        p = d->upd[i].regs;
+        csf = (i + 1 >= d->active) ? IBC_CSF_LOW : IBC_CSF_OFF;
+
+        p->AQCSFRC.bit.CSFA = csf;
+        p->AQCSFRC.bit.CSFB = csf;
+        p->TBCTL.bit.PHSDIR = d->phsdir[i];
+        p->TRREM.bit.TRREM = d->trrem[i];
+    }
+
+    d->master->TBCTL2.bit.OSHTSYNC = 1;
+    hrpwmSyncArmed();
+
+    return(1);
+}
+
+#endif  // IBC_DRIVER_H
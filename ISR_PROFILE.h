@@ -0,0 +1,153 @@
+#ifndef ISR_PROFILE_H
+#define ISR_PROFILE_H
+
+//
+// ISR execution-time and jitter instrumentation.
+//
+// ISR_PROFILE_ENTRY(id) / ISR_PROFILE_EXIT(id) timestamp an ISR against the
+// TIMEBASE.h SYSCLK counter (CPU Timer 1) and keep, per ISR, the min/max/
+// mean execution time, the min/max entry-to-entry period (jitter) and a
+// log2 histogram of execution times in isrStats[], which can be watched in
+// real-time mode. Build with ISR_PROFILE = 0 to remove every probe.
+//
+
+#ifndef ISR_PROFILE
+#define ISR_PROFILE             1       // 0 = compile out instrumentation
+#endif
+
+//
+// Defines
+//
+#define ISR_PROFILE_COUNT       4       // # of instrumented ISRs
+#define ISR_PROFILE_BINS        16      // Histogram bin n: 2^(n-1) <= t < 2^n
+
+#define ISR_ID_ADCA1            0       // adcA1ISR()
+
+#if ISR_PROFILE
+
+typedef struct
+{
+    uint32_t count;                     // # of ISR executions
+    uint32_t entry;                     // Timebase at last entry
+    uint32_t execMin;                   // Execution time, SYSCLKs
+    uint32_t execMax;
+    uint32_t execMean;                  // Running mean (1/16 weight)
+    uint32_t periodMin;                 // Entry-to-entry period, SYSCLKs
+    uint32_t periodMax;
+    uint32_t hist[ISR_PROFILE_BINS];    // log2 execution time histogram
+} ISR_STATS;
+
+ISR_STATS isrStats[ISR_PROFILE_COUNT];
+
+//
+// The probes run inside the profiled ISRs; keep them in RAM so Flash
+// builds measure the ISR, not the probe fetches
+//
+#pragma CODE_SECTION(isrProfileEntry, ".TI.ramfunc");
+#pragma CODE_SECTION(isrProfileExit, ".TI.ramfunc");
+
+//
+// isrProfileEntry - Timestamp ISR entry and track the period
+//
+static inline void isrProfileEntry(ISR_STATS *s)
+{
+    uint32_t now, period;
+
+    now = timebaseNow();
+    if(s->count != 0)
+    {
+        period = now - s->entry;
+        if(period < s->periodMin)
+        {
+            s->periodMin = period;
+        }
+        if(period > s->periodMax)
+        {
+            s->periodMax = period;
+        }
+    }
+    s->entry = now;
+}
+
+//
+// isrProfileExit - Account the execution time of the ISR
+//
+static inline void isrProfileExit(ISR_STATS *s)
+{
+    uint32_t t;
+    uint16_t bin;
+
+    t = timebaseNow() - s->entry;
+
+    if(t < s->execMin)
+    {
+        s->execMin = t;
+    }
+    if(t > s->execMax)
+    {
+        s->execMax = t;
+    }
+    if(s->count == 0)
+    {
+        s->execMean = t;
+    }
+    else
+    {
+        s->execMean += ((int32_t)(t - s->execMean)) >> 4;
+    }
+    s->count++;
+
+    //
+    // bin = bit length of t, clamped to the last bin
+    //
+    if(t >= (1UL << (ISR_PROFILE_BINS - 1)))
+    {
+        bin = ISR_PROFILE_BINS - 1;
+    }
+    else
+    {
+        bin = 0;
+        if(t >= 0x100)  { bin += 8; t >>= 8; }
+        if(t >= 0x10)   { bin += 4; t >>= 4; }
+        if(t >= 0x4)    { bin += 2; t >>= 2; }
+        if(t >= 0x2)    { bin += 1; t >>= 1; }
+        bin += t;
+    }
+    s->hist[bin]++;
+}
+
+//
+// initISRProfile - Reset all statistics
+//
+void initISRProfile(void)
+{
+    uint16_t i, j;
+
+    for(i = 0; i < ISR_PROFILE_COUNT; i++)
+    {
+        isrStats[i].count = 0;
+        isrStats[i].entry = 0;
+        isrStats[i].execMin = 0xFFFFFFFF;
+        isrStats[i].execMax = 0;
+        isrStats[i].execMean = 0;
+        isrStats[i].periodMin = 0xFFFFFFFF;
+        isrStats[i].periodMax = 0;
+        for(j = 0; j < ISR_PROFILE_BINS; j++)
+        {
+            isrStats[i].hist[j] = 0;
+        }
+    }
+}
+
+#define ISR_PROFILE_ENTRY(id)   isrProfileEntry(&isrStats[id])
+#define ISR_PROFILE_EXIT(id)    isrProfileExit(&isrStats[id])
+
+#else
+
+#define initISRProfile()
+#define ISR_PROFILE_ENTRY(id)
+#define ISR_PROFILE_EXIT(id)
+
+#endif  // ISR_PROFILE
+
+#endif  // ISR_PROFILE_H
@@ -0,0 +1,127 @@
+#ifndef MEP_CACHE_H
+#define MEP_CACHE_H
+
+//
+// MEP scale factor cache for warm starts.
+//
+// mepCacheStore() keeps the last scale factor SFO() converged on, with the
+// die temperature the caller measured, a SYSCLK timestamp (TIMEBASE.h) and
+// an update count, in mepCache. A CRC-16/CCITT-FALSE over the record
+// protects it. The record lives in the "mepcache" section in RAMLS6,
+// NOINIT, next to the fault record, so it survives a warm reset or a
+// debugger reload but not a power cycle.
+//
+// On boot, mepCacheLoad() returns the cached scale factor when the record
+// is intact and in range, and the caller's fallback otherwise, e.g. after
+// power-up or a corrupted record. The result seeds HRMSTEP
+// (bootSeedScaleFactor()) and the background SFO task refines it.
+//
+
+//
+// Defines
+//
+#define MEP_CACHE_MAGIC         0x5F0CAC4EUL    // Record written by us
+#define MEP_CACHE_SF_MIN        1               // Valid MEP_ScaleFactor
+#define MEP_CACHE_SF_MAX        255
+#define MEP_CACHE_TEMP_NONE     (-32768)        // Temperature not measured
+
+typedef struct
+{
+    uint32_t magic;             // MEP_CACHE_MAGIC
+    uint16_t scaleFactor;       // MEP_ScaleFactor from a completed SFO()
+    int16_t temp;               // Die temperature (C) or MEP_CACHE_TEMP_NONE
+    uint32_t timestamp;         // SYSCLKs since boot at the store
+    uint16_t seq;               // # of stores since the record was created
+    uint16_t crc;               // Over all words above
+} MEP_CACHE;
+
+//
+// Globals
+//
+#pragma DATA_SECTION(mepCache, "mepcache");
+MEP_CACHE mepCache;
+uint16_t mepCacheHit;           // 1 = this boot was seeded from the cache
+
+//
+// mepCacheCrc - CRC-16/CCITT-FALSE of the record, high byte of each word
+//               first
+//
+uint16_t mepCacheCrc(const MEP_CACHE *r)
+{
+    const uint16_t *p = (const uint16_t *)r;
+    uint16_t n = sizeof(MEP_CACHE) / sizeof(uint16_t) - 1;
+    uint16_t crc = 0xFFFF;
+    uint16_t i;
+
+    while(n--)
+    {
+        crc ^= *p++;
+        for(i = 0; i < 16; i++)
+        {
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+        }
+    }
+
+    return(crc);
+}
+
+//
+// mepCacheValid - 1 if mepCache holds an intact, in-range record
+//
+uint16_t mepCacheValid(void)
+{
+    return((mepCache.magic == MEP_CACHE_MAGIC) &&
+           (mepCache.scaleFactor >= MEP_CACHE_SF_MIN) &&
+           (mepCache.scaleFactor <= MEP_CACHE_SF_MAX) &&
+           (mepCache.crc == mepCacheCrc(&mepCache)));
+}
+
+//
+// mepCacheLoad - Cached scale factor, or fallback if there is no valid
+//                record. A bad record is cleared.
+//
+int mepCacheLoad(int fallback)
+{
+    if(mepCacheValid())
+    {
+        mepCacheHit = 1;
+        return(mepCache.scaleFactor);
+    }
+
+    mepCacheHit = 0;
+    mepCache.magic = 0;
+    mepCache.seq = 0;
+    return(fallback);
+}
+
+//
+// mepCacheStore - Record scale factor sf, measured at temp. Call when
+//                 SFO() completes; a value that is out of range or
+//                 unchanged at the same temperature is not written.
+//
+void mepCacheStore(int sf, int16_t temp)
+{
+    if((sf < MEP_CACHE_SF_MIN) || (sf > MEP_CACHE_SF_MAX))
+    {
+        return;
+    }
+
+    if((mepCache.magic == MEP_CACHE_MAGIC) &&
+       (mepCache.scaleFactor == sf) && (mepCache.temp == temp))
+    {
+        return;
+    }
+
+    //
+    // The CRC goes last, so a reset part way through leaves a record that
+    // fails mepCacheValid()
+    //
+    mepCache.magic = MEP_CACHE_MAGIC;
+    mepCache.scaleFactor = sf;
+    mepCache.temp = temp;
+    mepCache.timestamp = timebaseNow();
+    mepCache.seq++;
+    mepCache.crc = mepCacheCrc(&mepCache);
+}
+
+#endif  // MEP_CACHE_H
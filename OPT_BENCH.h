@@ -0,0 +1,108 @@
+#ifndef OPT_BENCH_H
+#define OPT_BENCH_H
+
+//
+// Optimization-level benchmark.
+//
+// OPT_BENCH_ENTRY(id) / OPT_BENCH_EXIT(id) bracket one non-ISR hot path and
+// keep its SYSCLK count (TIMEBASE.h) per call as count/min/max/total in
+// optBench[id]. ISRs are timed by ISR_PROFILE.h instead; adcA1ISR() is
+// isrStats[ISR_ID_ADCA1]. A build records one optimization level. Set the
+// level with --define=OPT_BENCH_LEVEL=n, using OPT_BENCH_LEVEL_OFF for
+// -Ooff; it is stored in optBenchLevel next to the results. Build each
+// level once, e.g. the CPU1_RAM/optimizerAssistant builds, with
+// --define=OPT_BENCH=1.
+//
+// bench_dump.js runs a build on target and writes optBench[] and isrStats[]
+// to opt_bench.csv in the build directory; opt_bench.py then prints code
+// size and cycles for all builds side by side. A build with per-file
+// overrides (CCS file-specific options) is compared like any other level.
+//
+#ifndef OPT_BENCH
+#define OPT_BENCH               0       // 1 = build in the benchmark
+#endif
+
+//
+// Defines
+//
+#define OPT_BENCH_LEVEL_OFF     0xF     // -Ooff
+#define OPT_BENCH_LEVEL_UNSET   0xFF
+
+#ifndef OPT_BENCH_LEVEL
+#define OPT_BENCH_LEVEL         OPT_BENCH_LEVEL_UNSET
+#endif
+
+#define OPT_ID_CONFIG_HRPWM     0       // configHRPWM()
+#define OPT_ID_HR_UPDATE        1       // HR update loop (sweepTask())
+#define OPT_ID_SFO              2       // One SFO() call
+#define OPT_BENCH_COUNT         3
+
+#if OPT_BENCH
+
+typedef struct
+{
+    uint32_t count;             // # of timed calls
+    uint32_t entry;             // Timebase at the last OPT_BENCH_ENTRY
+    uint32_t min;               // SYSCLKs per call
+    uint32_t max;
+    uint32_t total;             // Sum, for the mean
+} OPT_BENCH_STATS;
+
+//
+// Globals
+//
+OPT_BENCH_STATS optBench[OPT_BENCH_COUNT];
+uint16_t optBenchLevel;
+
+//
+// optBenchExit - Account one call of s
+//
+static inline void optBenchExit(OPT_BENCH_STATS *s)
+{
+    uint32_t t;
+
+    t = timebaseNow() - s->entry;
+
+    if(t < s->min)
+    {
+        s->min = t;
+    }
+    if(t > s->max)
+    {
+        s->max = t;
+    }
+    s->total += t;
+    s->count++;
+}
+
+//
+// initOptBench - Reset all statistics and record the build's level
+//
+void initOptBench(void)
+{
+    uint16_t i;
+
+    for(i = 0; i < OPT_BENCH_COUNT; i++)
+    {
+        optBench[i].count = 0;
+        optBench[i].entry = 0;
+        optBench[i].min = 0xFFFFFFFF;
+        optBench[i].max = 0;
+        optBench[i].total = 0;
+    }
+
+    optBenchLevel = OPT_BENCH_LEVEL;
+}
+
+#define OPT_BENCH_ENTRY(id)     (optBench[id].entry = timebaseNow())
+#define OPT_BENCH_EXIT(id)      optBenchExit(&optBench[id])
+
+#else
+
+#define initOptBench()
+#define OPT_BENCH_ENTRY(id)
+#define OPT_BENCH_EXIT(id)
+
+#endif  // OPT_BENCH
+
+#endif  // OPT_BENCH_H
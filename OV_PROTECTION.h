@@ -0,0 +1,164 @@
+#ifndef OV_PROTECTION_H
+#define OV_PROTECTION_H
+
+//
+// Hardware overvoltage protection.
+//
+// A CMPSS high comparator watches the Vout sense pin against its DAC. Its
+// CTRIPH output is routed through ePWM X-BAR TRIP4 to the digital compare
+// unit of every protected ePWM module, where DCAEVT1 is a one-shot trip
+// source that forces ePWMxA/B low asynchronously, without CPU involvement.
+// The CPU only sees one EPWM1_TZ_INT per fault, which sets ovFault, and the
+// outputs stay forced until rearmOVProtection() is called.
+//
+
+//
+// Defines
+//
+#define OV_MAX_MODULES          8
+#define OV_TRIP_DCAH_TRIPIN4    3       // DCTRIPSEL - TRIPIN4
+#define OV_TZ_DCAH_HIGH         2       // TZDCSEL - DCAH = high, DCAL = x
+#define OV_DC_EVT_ASYNC         1       // DCACTL - async force path
+#define OV_REARM_FAIL           0
+#define OV_REARM_OK             1
+
+//
+// Globals
+//
+volatile uint16_t ovFault;              // 1 = OV trip latched
+volatile uint16_t ovFaultCount;         // # of OV trips since power-up
+volatile struct CMPSS_REGS *ovCmpss;
+volatile struct EPWM_REGS *ovEPwm[OV_MAX_MODULES];
+uint16_t ovEPwmCount;
+
+//
+// initOVProtection - Arm hardware OV protection.
+//                    cmpss/cmpssNum - CMPSS module (1..7) sensing Vout
+//                    hpMux          - its CMPxHPMXSEL input select, see the
+//                                     CMPSS mux table in the datasheet
+//                    dacCode        - trip threshold in ADC/DAC counts
+//                    regs[0..count-1] - ePWM modules to force low, at
+//                                       most OV_MAX_MODULES
+//                    The TZ interrupt is taken from regs[0].
+//
+void initOVProtection(volatile struct CMPSS_REGS *cmpss, uint16_t cmpssNum,
+                      uint16_t hpMux, uint16_t dacCode,
+                      volatile struct EPWM_REGS * const regs[],
+                      uint16_t count)
+{
+    uint16_t xbarMux, i;
+
+    if(count < 1)
+    {
+        count = 1;
+    }
+    if(count > OV_MAX_MODULES)
+    {
+        count = OV_MAX_MODULES;
+    }
+
+    EALLOW;
+
+    //
+    // Comparator: Vout (HP input) against the DAC, asynchronous CTRIPH
+    //
+    AnalogSubsysRegs.CMPHPMXSEL.all =
+        (AnalogSubsysRegs.CMPHPMXSEL.all & ~(7UL << (3 * (cmpssNum - 1)))) |
+        ((uint32_t)hpMux << (3 * (cmpssNum - 1)));
+
+    cmpss->COMPCTL.bit.COMPDACE = 1;        // Enable comparator and DAC
+    cmpss->COMPCTL.bit.COMPHSOURCE = 0;     // Negative input is the DAC
+    cmpss->COMPCTL.bit.COMPHINV = 0;        // High when Vout > threshold
+    cmpss->COMPCTL.bit.CTRIPHSEL = 0;       // Unfiltered, asynchronous
+    cmpss->COMPHYSCTL.bit.COMPHYS = 2;      // 2x hysteresis
+    cmpss->COMPDACCTL.bit.SELREF = 0;       // VDDA reference, same as ADC
+    cmpss->COMPDACCTL.bit.SWLOADSEL = 0;    // Load DACHVALA on SYSCLK
+    cmpss->DACHVALS.bit.DACVAL = dacCode;
+
+    //
+    // ePWM X-BAR TRIP4 <- CMPSSn.CTRIPH (mux 2 * (n - 1), select 0)
+    //
+    xbarMux = 2 * (cmpssNum - 1);
+    EPwmXbarRegs.TRIP4MUX0TO15CFG.all &= ~(3UL << (2 * xbarMux));
+    EPwmXbarRegs.TRIP4MUXENABLE.all |= 1UL << xbarMux;
+
+    //
+    // DCAEVT1 = TRIPIN4 high, one-shot trip forcing both outputs low
+    //
+    for(i = 0; i < count; i++)
+    {
+        regs[i]->DCTRIPSEL.bit.DCAHCOMPSEL = OV_TRIP_DCAH_TRIPIN4;
+        regs[i]->TZDCSEL.bit.DCAEVT1 = OV_TZ_DCAH_HIGH;
+        regs[i]->DCACTL.bit.EVT1SRCSEL = 0;         // Unfiltered DCAEVT1
+        regs[i]->DCACTL.bit.EVT1FRCSYNCSEL = OV_DC_EVT_ASYNC;
+        regs[i]->TZSEL.bit.DCAEVT1 = 1;             // One-shot trip
+        regs[i]->TZCTL.bit.TZA = TZ_FORCE_LO;
+        regs[i]->TZCTL.bit.TZB = TZ_FORCE_LO;
+        regs[i]->TZCLR.bit.DCAEVT1 = 1;             // Start untripped
+        regs[i]->TZCLR.bit.OST = 1;
+        regs[i]->TZCLR.bit.INT = 1;
+
+        ovEPwm[i] = regs[i];
+    }
+
+    regs[0]->TZEINT.bit.OST = 1;            // One interrupt per fault
+
+    EDIS;
+
+    ovCmpss = cmpss;
+    ovEPwmCount = count;
+    ovFault = 0;
+    ovFaultCount = 0;
+}
+
+//
+// ISR runs from RAM
+//
+#pragma CODE_SECTION(ovTripISR, ".TI.ramfunc");
+
+//
+// ovTripISR - EPWMx_TZ_INT ISR. The outputs are already forced low by the
+//             hardware; only record the fault. OST stays latched, so the
+//             interrupt does not fire again until rearmOVProtection().
+//
+__interrupt void ovTripISR(void)
+{
+    ovFault = 1;
+    ovFaultCount++;
+
+    EALLOW;
+    ovEPwm[0]->TZCLR.bit.INT = 1;
+    EDIS;
+
+    PieCtrlRegs.PIEACK.all = PIEACK_GROUP2;
+}
+
+//
+// rearmOVProtection - Release the PWM outputs after an OV trip. Returns
+//                     OV_REARM_FAIL, leaving the trip latched, while Vout
+//                     is still above the threshold.
+//
+uint16_t rearmOVProtection(void)
+{
+    uint16_t i;
+
+    if(ovCmpss->COMPSTS.bit.COMPHSTS)
+    {
+        return(OV_REARM_FAIL);
+    }
+
+    EALLOW;
+    for(i = 0; i < ovEPwmCount; i++)
+    {
+        ovEPwm[i]->TZCLR.bit.DCAEVT1 = 1;
+        ovEPwm[i]->TZCLR.bit.OST = 1;
+        ovEPwm[i]->TZCLR.bit.INT = 1;
+    }
+    EDIS;
+
+    ovFault = 0;
+
+    return(OV_REARM_OK);
+}
+
+#endif  // OV_PROTECTION_H
@@ -0,0 +1,144 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+//
+// Tick-driven cooperative scheduler.
+//
+// CPU Timer 0 interrupts at SCHED_TICK_HZ and only advances schedTick.
+// schedRun(), called from the background loop, runs the first task in the
+// list (fastest first) whose period has elapsed and returns; when no task
+// is due it runs the idle task once. A task that becomes due again before
+// it has run (the background was busy for a whole period or more) counts
+// an overrun and is re-aligned to the current tick instead of running
+// back-to-back to catch up.
+//
+// With GPIO_CONFIG.h included first, the tick toggles PROBE_SCHED_TICK and
+// PROBE_SCHED_TASK is high while a task runs.
+//
+
+//
+// Defines
+//
+#define SCHED_SYSCLK_HZ         100000000UL
+#define SCHED_TICK_HZ           10000UL
+
+//
+// Task periods in ticks for the standard slots
+//
+#define SCHED_10KHZ             1
+#define SCHED_1KHZ              10
+#define SCHED_100HZ             100
+
+typedef struct
+{
+    void (*fn)(void);           // Task function
+    uint16_t period;            // Period in ticks
+    uint16_t last;              // Tick of the last due time
+    uint16_t overruns;          // # of missed periods
+    uint32_t runs;              // # of executions
+} SCHED_TASK;
+
+//
+// Globals
+//
+volatile uint16_t schedTick;
+SCHED_TASK *schedTaskList;
+uint16_t schedTaskCount;
+void (*schedIdle)(void);
+uint32_t schedIdleRuns;
+
+//
+// Tick ISR runs from RAM
+//
+#pragma CODE_SECTION(schedTickISR, ".TI.ramfunc");
+
+//
+// schedTickISR - CPU Timer 0 ISR
+//
+__interrupt void schedTickISR(void)
+{
+#ifdef PROBE_SCHED_TICK
+    probeToggle(PROBE_SCHED_TICK);
+#endif
+    schedTick++;
+
+    PieCtrlRegs.PIEACK.all = PIEACK_GROUP1;
+}
+
+//
+// initScheduler - Register tasks[0..count-1] (fastest first) and the idle
+//                 task, and start the CPU Timer 0 tick. The caller maps
+//                 TIMER0_INT to schedTickISR and enables PIE 1.7 / INT1.
+//
+void initScheduler(SCHED_TASK *tasks, uint16_t count, void (*idle)(void))
+{
+    uint16_t i;
+
+    schedTick = 0;
+    schedTaskList = tasks;
+    schedTaskCount = count;
+    schedIdle = idle;
+    schedIdleRuns = 0;
+
+    for(i = 0; i < count; i++)
+    {
+        tasks[i].last = 0;
+        tasks[i].overruns = 0;
+        tasks[i].runs = 0;
+    }
+
+    CpuTimer0Regs.TCR.bit.TSS = 1;          // Stop timer
+    CpuTimer0Regs.PRD.all = (SCHED_SYSCLK_HZ / SCHED_TICK_HZ) - 1;
+    CpuTimer0Regs.TPR.all = 0;              // Prescale by 1 (SYSCLK)
+    CpuTimer0Regs.TPRH.all = 0;
+    CpuTimer0Regs.TCR.bit.TRB = 1;          // Reload counter
+    CpuTimer0Regs.TCR.bit.TIE = 1;          // Interrupt on every tick
+    CpuTimer0Regs.TCR.bit.TSS = 0;          // Start timer
+}
+
+//
+// schedRun - Run at most one due task, or the idle task if none is due
+//
+void schedRun(void)
+{
+    SCHED_TASK *t;
+    uint16_t now, elapsed, i;
+
+    for(i = 0; i < schedTaskCount; i++)
+    {
+        t = &schedTaskList[i];
+        now = schedTick;
+        elapsed = now - t->last;
+
+        if(elapsed >= t->period)
+        {
+            if(elapsed >= 2 * t->period)
+            {
+                t->overruns++;
+                t->last = now;
+            }
+            else
+            {
+                t->last += t->period;
+            }
+
+            t->runs++;
+#ifdef PROBE_SCHED_TASK
+            probeSet(PROBE_SCHED_TASK);
+            t->fn();
+            probeClear(PROBE_SCHED_TASK);
+#else
+            t->fn();
+#endif
+            return;
+        }
+    }
+
+    if(schedIdle)
+    {
+        schedIdleRuns++;
+        schedIdle();
+    }
+}
+
+#endif  // SCHEDULER_H
@@ -0,0 +1,146 @@
+#ifndef SFO_SCHED_H
+#define SFO_SCHED_H
+
+//
+// Background SFO calibration scheduler.
+//
+// sfoSchedRun() is called from a low-priority background slot. It starts
+// an MEP calibration every sfoSched.period SYSCLKs and advances it with
+// SFO() steps until the calibration completes or the per-call budget is
+// spent; the worst-case overrun of the budget is one SFO() step. Each
+// completed calibration publishes MEP_ScaleFactor into sfoSched.scaleFactor
+// and its drift history, and sets sfoSched.event when the scale factor has
+// moved by sfoSched.threshold or more since the last event, so that cached
+// HR register values can be recomputed. Uses the TIMEBASE.h counter.
+//
+
+//
+// Defines
+//
+#define SFO_SCHED_HISTORY       8       // Scale factor history depth,
+                                        // power of 2
+
+extern int MEP_ScaleFactor;             // Updated by SFO()
+
+typedef struct
+{
+    //
+    // Configuration
+    //
+    uint32_t period;            // SYSCLKs between calibration starts
+    uint32_t budget;            // SYSCLKs allowed per sfoSchedRun() call
+    uint16_t threshold;         // Scale factor change raising event
+
+    //
+    // Status
+    //
+    uint16_t busy;              // 1 = calibration in progress
+    uint32_t lastStart;         // Timebase at start of last calibration
+    uint32_t lastCost;          // SYSCLKs spent in the last call
+    uint32_t maxCost;           // Worst SYSCLKs spent in one call
+    uint16_t calibrations;      // # of completed calibrations
+    uint16_t errors;            // # of SFO_ERROR results
+    int scaleFactor;            // Published MEP_ScaleFactor
+    int eventScaleFactor;       // Scale factor at the last event
+    int history[SFO_SCHED_HISTORY]; // Last completed scale factors
+    uint16_t historyIndex;      // Next history[] slot
+    volatile uint16_t event;    // 1 = scale factor drifted, cleared by user
+} SFO_SCHED;
+
+SFO_SCHED sfoSched;
+
+//
+// initSFOSched - Set up the scheduler after the initial calibration has
+//                completed (MEP_ScaleFactor valid)
+//
+void initSFOSched(uint32_t period, uint32_t budget, uint16_t threshold)
+{
+    uint16_t i;
+
+    sfoSched.period = period;
+    sfoSched.budget = budget;
+    sfoSched.threshold = threshold;
+
+    sfoSched.busy = 0;
+    sfoSched.lastStart = timebaseNow();
+    sfoSched.lastCost = 0;
+    sfoSched.maxCost = 0;
+    sfoSched.calibrations = 0;
+    sfoSched.errors = 0;
+    sfoSched.scaleFactor = MEP_ScaleFactor;
+    sfoSched.eventScaleFactor = MEP_ScaleFactor;
+
+    for(i = 0; i < SFO_SCHED_HISTORY; i++)
+    {
+        sfoSched.history[i] = MEP_ScaleFactor;
+    }
+    sfoSched.historyIndex = 0;
+    sfoSched.event = 0;
+}
+
+//
+// sfoSchedRun - Run the calibration for at most one budget. Returns the
+//               last SFO() status, or SFO_INCOMPLETE if nothing was due.
+//
+uint16_t sfoSchedRun(void)
+{
+    uint32_t start, now;
+    uint16_t sfoStatus;
+    int delta;
+
+    start = timebaseNow();
+
+    if(!sfoSched.busy)
+    {
+        if((start - sfoSched.lastStart) < sfoSched.period)
+        {
+            return(SFO_INCOMPLETE);
+        }
+        sfoSched.busy = 1;
+        sfoSched.lastStart = start;
+    }
+
+    do
+    {
+        sfoStatus = SFO();
+        now = timebaseNow();
+    } while((sfoStatus == SFO_INCOMPLETE) &&
+            ((now - start) < sfoSched.budget));
+
+    sfoSched.lastCost = now - start;
+    if(sfoSched.lastCost > sfoSched.maxCost)
+    {
+        sfoSched.maxCost = sfoSched.lastCost;
+    }
+
+    if(sfoStatus == SFO_ERROR)
+    {
+        sfoSched.busy = 0;
+        sfoSched.errors++;
+    }
+    else if(sfoStatus != SFO_INCOMPLETE)
+    {
+        sfoSched.busy = 0;
+        sfoSched.calibrations++;
+        sfoSched.scaleFactor = MEP_ScaleFactor;
+
+        sfoSched.history[sfoSched.historyIndex] = MEP_ScaleFactor;
+        sfoSched.historyIndex = (sfoSched.historyIndex + 1) &
+                                (SFO_SCHED_HISTORY - 1);
+
+        delta = MEP_ScaleFactor - sfoSched.eventScaleFactor;
+        if(delta < 0)
+        {
+            delta = -delta;
+        }
+        if(delta >= sfoSched.threshold)
+        {
+            sfoSched.eventScaleFactor = MEP_ScaleFactor;
+            sfoSched.event = 1;
+        }
+    }
+
+    return(sfoStatus);
+}
+
+#endif  // SFO_SCHED_H
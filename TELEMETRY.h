@@ -0,0 +1,231 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+//
+// SCI telemetry stream.
+//
+// tlmSend() packs the words listed in the application's field table into
+// one binary frame and starts it out of SCIA (GPIO29 TX, 115200 8N1). The
+// TX FIFO interrupt refills the 16-level FIFO each time it drains to
+// TLM_TX_FIFO_LEVEL, so the CPU takes one interrupt per ~14 bytes and
+// never polls. A frame is dropped, and counted, when tlmSend() finds the
+// previous one still going out.
+//
+// Frame, one byte per 8-bit character, 16-bit values little-endian:
+//
+//   0xA5 0x5A   sync
+//   len         payload bytes (2 per field word)
+//   seq         frame sequence number, counts dropped frames too
+//   drops       frames dropped on the target so far
+//   payload     field words in table order, low byte first
+//   crc         CRC-16/CCITT-FALSE over len .. payload
+//
+// A gap in seq that matches the change in drops was lost on the target;
+// the rest was lost on the wire. tlm_decode.py is the host side.
+//
+// The caller maps SCIA_TX_INT to tlmTxISR and enables PIE 9.2 / INT9.
+//
+
+//
+// Defines
+//
+#define TLM_LSPCLK_HZ           25000000UL  // SYSCLK / 4 (LOSPCP reset value)
+#define TLM_BAUD                115200UL
+#define TLM_BRR                 ((TLM_LSPCLK_HZ + TLM_BAUD * 4) /          \
+                                 (TLM_BAUD * 8) - 1)
+#define TLM_SYNC0               0xA5
+#define TLM_SYNC1               0x5A
+#define TLM_HEADER              7           // sync, len, seq, drops
+#define TLM_MAX_WORDS           24          // Payload limit, in field words
+#define TLM_FRAME_MAX           (TLM_HEADER + 2 * TLM_MAX_WORDS + 2)
+#define TLM_TX_FIFO_LEVEL       2           // Refill at <= 2 bytes queued
+
+typedef struct
+{
+    const volatile void *src;   // Variable to send
+    uint16_t words;             // 16-bit words: 1 or 2 (int32, float)
+} TLM_FIELD;
+
+//
+// Globals
+//
+TLM_FIELD *tlmFieldList;
+uint16_t tlmFieldCount;
+uint16_t tlmFrame[TLM_FRAME_MAX];   // One byte per word, as sent
+uint16_t tlmLength;
+volatile uint16_t tlmPos;       // Next byte to queue; == tlmLength when idle
+uint16_t tlmSeq;
+uint16_t tlmDrops;
+uint32_t tlmFrames;             // # of frames started
+
+//
+// Nibble table for CRC-16/CCITT-FALSE (poly 0x1021)
+//
+const uint16_t tlmCrcTable[16] =
+{
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
+
+//
+// TX refill runs from RAM
+//
+#pragma CODE_SECTION(tlmTxISR, ".TI.ramfunc");
+
+//
+// tlmCrc - CRC-16/CCITT-FALSE of n bytes, one per word
+//
+uint16_t tlmCrc(const uint16_t *p, uint16_t n)
+{
+    uint16_t crc = 0xFFFF;
+
+    while(n--)
+    {
+        crc ^= (*p++ & 0xFF) << 8;
+        crc = (crc << 4) ^ tlmCrcTable[crc >> 12];
+        crc = (crc << 4) ^ tlmCrcTable[crc >> 12];
+    }
+
+    return(crc);
+}
+
+//
+// initTelemetry - SCIA 8N1 with FIFOs on GPIO28/29, and the field table
+//                 fields[0..count-1]. Fields past TLM_MAX_WORDS are left
+//                 out of the frame.
+//
+void initTelemetry(TLM_FIELD *fields, uint16_t count)
+{
+    uint16_t i, words;
+
+    words = 0;
+    for(i = 0; i < count; i++)
+    {
+        if(words + fields[i].words > TLM_MAX_WORDS)
+        {
+            break;
+        }
+        words += fields[i].words;
+    }
+    tlmFieldList = fields;
+    tlmFieldCount = i;
+
+    tlmLength = 0;
+    tlmPos = 0;
+    tlmSeq = 0;
+    tlmDrops = 0;
+    tlmFrames = 0;
+
+    GPIO_SetupPinMux(28, GPIO_MUX_CPU1, 1);     // SCIRXDA
+    GPIO_SetupPinOptions(28, GPIO_INPUT, GPIO_PUSHPULL);
+    GPIO_SetupPinMux(29, GPIO_MUX_CPU1, 1);     // SCITXDA
+    GPIO_SetupPinOptions(29, GPIO_OUTPUT, GPIO_ASYNC);
+
+    SciaRegs.SCICCR.all = 0x0007;       // 1 stop bit, no parity, 8 bits
+    SciaRegs.SCICTL1.all = 0x0003;      // TX, RX enabled, held in reset
+    SciaRegs.SCICTL2.all = 0x0000;      // No non-FIFO interrupts
+    SciaRegs.SCIHBAUD.all = TLM_BRR >> 8;
+    SciaRegs.SCILBAUD.all = TLM_BRR & 0xFF;
+
+    //
+    // FIFOs on, TX FIFO interrupt level set but disabled until a frame
+    // is queued; RX is unused
+    //
+    SciaRegs.SCIFFTX.all = 0xC040 | TLM_TX_FIFO_LEVEL;
+    SciaRegs.SCIFFRX.all = 0x0040;
+    SciaRegs.SCIFFCT.all = 0x0000;
+    SciaRegs.SCIFFTX.bit.TXFIFORESET = 1;
+    SciaRegs.SCIFFRX.bit.RXFIFORESET = 1;
+
+    SciaRegs.SCICTL1.all = 0x0023;      // Release from reset
+}
+
+//
+// tlmSend - Build a frame from the field table and start sending it.
+//           Returns 0 if the previous frame is still going out.
+//
+uint16_t tlmSend(void)
+{
+    uint16_t i, n, w, crc;
+    uint32_t v;
+    TLM_FIELD *f;
+
+    if(tlmPos != tlmLength)
+    {
+        tlmSeq++;
+        tlmDrops++;
+        return(0);
+    }
+
+    n = TLM_HEADER;
+    for(i = 0; i < tlmFieldCount; i++)
+    {
+        f = &tlmFieldList[i];
+        if(f->words == 2)
+        {
+            v = *(const volatile uint32_t *)f->src;
+        }
+        else
+        {
+            v = *(const volatile uint16_t *)f->src;
+        }
+
+        for(w = 0; w < f->words; w++)
+        {
+            tlmFrame[n++] = v & 0xFF;
+            tlmFrame[n++] = (v >> 8) & 0xFF;
+            v >>= 16;
+        }
+    }
+
+    tlmFrame[0] = TLM_SYNC0;
+    tlmFrame[1] = TLM_SYNC1;
+    tlmFrame[2] = n - TLM_HEADER;
+    tlmFrame[3] = tlmSeq & 0xFF;
+    tlmFrame[4] = tlmSeq >> 8;
+    tlmFrame[5] = tlmDrops & 0xFF;
+    tlmFrame[6] = tlmDrops >> 8;
+
+    crc = tlmCrc(&tlmFrame[2], n - 2);
+    tlmFrame[n++] = crc & 0xFF;
+    tlmFrame[n++] = crc >> 8;
+
+    tlmSeq++;
+    tlmFrames++;
+
+    //
+    // The ISR owns the frame from here; it fires at once since the FIFO
+    // is at or below the level
+    //
+    tlmPos = 0;
+    tlmLength = n;
+    SciaRegs.SCIFFTX.bit.TXFFINTCLR = 1;
+    SciaRegs.SCIFFTX.bit.TXFFIENA = 1;
+
+    return(1);
+}
+
+//
+// tlmTxISR - SCIA TX FIFO interrupt: top the FIFO up, stop at frame end
+//
+__interrupt void tlmTxISR(void)
+{
+    uint16_t pos;
+
+    pos = tlmPos;
+    while((pos < tlmLength) && (SciaRegs.SCIFFTX.bit.TXFFST < 16))
+    {
+        SciaRegs.SCITXBUF.all = tlmFrame[pos++];
+    }
+    tlmPos = pos;
+
+    if(pos == tlmLength)
+    {
+        SciaRegs.SCIFFTX.bit.TXFFIENA = 0;
+    }
+
+    SciaRegs.SCIFFTX.bit.TXFFINTCLR = 1;
+    PieCtrlRegs.PIEACK.all = PIEACK_GROUP9;
+}
+
+#endif  // TELEMETRY_H
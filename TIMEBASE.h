@@ -0,0 +1,41 @@
+#ifndef TIMEBASE_H
+#define TIMEBASE_H
+
+//
+// Free-running SYSCLK timebase on CPU Timer 1.
+//
+// The timer counts down from 0xFFFFFFFF with no prescaler and no interrupt,
+// so timebaseNow() returns an up-counting SYSCLK count and the difference
+// of two readings is an elapsed time that is correct across wrap-around
+// (~42.9 s at 100MHz).
+//
+
+//
+// initTimebase - Start CPU Timer 1 as a free-running SYSCLK counter
+//
+void initTimebase(void)
+{
+    CpuTimer1Regs.TCR.bit.TSS = 1;          // Stop timer
+    CpuTimer1Regs.PRD.all = 0xFFFFFFFF;     // Full 32-bit range
+    CpuTimer1Regs.TPR.all = 0;              // Prescale by 1 (SYSCLK)
+    CpuTimer1Regs.TPRH.all = 0;
+    CpuTimer1Regs.TCR.bit.TIE = 0;          // No interrupt
+    CpuTimer1Regs.TCR.bit.FREE = 1;         // Keep running on emulation halt
+    CpuTimer1Regs.TCR.bit.TRB = 1;          // Reload counter
+    CpuTimer1Regs.TCR.bit.TSS = 0;          // Start timer
+}
+
+//
+// Read from ISRs, so keep it out of Flash wait states
+//
+#pragma CODE_SECTION(timebaseNow, ".TI.ramfunc");
+
+//
+// timebaseNow - Current SYSCLK count
+//
+static inline uint32_t timebaseNow(void)
+{
+    return(~CpuTimer1Regs.TIM.all);
+}
+
+#endif  // TIMEBASE_H
@@ -0,0 +1,149 @@
+//
+// bench_dump.js - Run a build on target and dump its cycle counts.
+//
+// A Debug Server Scripting (DSS) script, run with the dss launcher that
+// ships with CCS:
+//
+//   dss.sh bench_dump.js targetConfigs/TMS320F280049C.ccxml CPU1_RAM [s]
+//
+// It loads the .out found in the build directory (Flash builds are
+// programmed by the load), runs it for s seconds (default 5), halts and
+// writes opt_bench.csv next to the .out, one line per probe:
+//
+//   # name, min, max, mean (SYSCLKs)
+//   adcA1ISR, 212, 260, 219
+//
+// ISRs come from isrStats[] (ISR_PROFILE.h), other hot paths from
+// optBench[] (OPT_BENCH.h) when the build has OPT_BENCH = 1 and the model
+// kernel from flashBench[] (FLASH_BENCH.h) when it has FLASH_BENCH = 1.
+// Probes that never ran (e.g. adcA1ISR() with CONTROL_CLA = 1) are left
+// out. opt_bench.py reads the file back.
+//
+
+importPackage(Packages.com.ti.debug.engine.scripting);
+importPackage(Packages.com.ti.ccstudio.scripting.environment);
+importPackage(Packages.java.lang);
+importPackage(Packages.java.io);
+
+//
+// Probe names and ids, as in ISR_ID_xxx / OPT_ID_xxx
+//
+var ISR_PROBES = [["adcA1ISR", 0]];
+var OPT_PROBES = [["configHRPWM", 0], ["hrUpdate", 1], ["SFO", 2]];
+
+//
+// FLASH_BENCH_xxx modes; all but the first two need a Flash build
+//
+var FLASH_MODES = ["kernel RAM", "kernel Flash", "kernel no cache",
+                   "kernel no prefetch", "kernel no prefetch/cache"];
+var FLASH_BENCH_RUNS = 64;
+
+function hasSymbol(session, name)
+{
+    try
+    {
+        session.symbol.getAddress(name);
+        return true;
+    }
+    catch(e)
+    {
+        return false;
+    }
+}
+
+function value(session, expr)
+{
+    return Number(session.expression.evaluate(expr));
+}
+
+function main(args)
+{
+    if(args.length < 2)
+    {
+        print("usage: dss.sh bench_dump.js <ccxml> <build dir> [seconds]");
+        return 2;
+    }
+
+    var dir = new File(args[1]);
+    var seconds = (args.length > 2) ? Number(args[2]) : 5;
+    var outs = dir.listFiles(new FilenameFilter({
+        accept: function(d, name) { return name.endsWith(".out"); }
+    }));
+    if(outs == null || outs.length == 0)
+    {
+        print("bench_dump: no .out in " + dir);
+        return 1;
+    }
+
+    var env = ScriptingEnvironment.instance();
+    var server = env.getServer("DebugServer.1");
+    server.setConfig(args[0]);
+    var session = server.openSession("*", "C28xx_CPU1");
+
+    session.target.connect();
+    session.memory.loadProgram(outs[0].getPath());
+    session.target.runAsynch();
+    Thread.sleep(seconds * 1000);
+    session.target.halt();
+
+    var csv = new PrintWriter(new File(dir, "opt_bench.csv"));
+    csv.println("# name, min, max, mean (SYSCLKs)");
+
+    if(hasSymbol(session, "isrStats"))
+    {
+        for(var i = 0; i < ISR_PROBES.length; i++)
+        {
+            var s = "isrStats[" + ISR_PROBES[i][1] + "]";
+            if(value(session, s + ".count") == 0)
+            {
+                continue;
+            }
+            csv.println(ISR_PROBES[i][0] + ", " +
+                        value(session, s + ".execMin") + ", " +
+                        value(session, s + ".execMax") + ", " +
+                        value(session, s + ".execMean"));
+        }
+    }
+
+    if(hasSymbol(session, "optBench"))
+    {
+        for(var i = 0; i < OPT_PROBES.length; i++)
+        {
+            var s = "optBench[" + OPT_PROBES[i][1] + "]";
+            var count = value(session, s + ".count");
+            if(count == 0)
+            {
+                continue;
+            }
+            csv.println(OPT_PROBES[i][0] + ", " +
+                        value(session, s + ".min") + ", " +
+                        value(session, s + ".max") + ", " +
+                        Math.round(value(session, s + ".total") / count));
+        }
+    }
+
+    if(hasSymbol(session, "flashBench"))
+    {
+        var modes = (value(session, "flashBenchRwait") != 0) ?
+                    FLASH_MODES.length : 2;
+        for(var i = 0; i < modes; i++)
+        {
+            var s = "flashBench[" + i + "]";
+            csv.println(FLASH_MODES[i] + ", " +
+                        value(session, s + ".min") + ", " +
+                        value(session, s + ".max") + ", " +
+                        Math.round(value(session, s + ".total") /
+                                   FLASH_BENCH_RUNS));
+        }
+    }
+
+    csv.close();
+    session.target.disconnect();
+    session.terminate();
+    server.stop();
+
+    print("bench_dump: wrote " + new File(dir, "opt_bench.csv"));
+    return 0;
+}
+
+java.lang.System.exit(main(arguments));
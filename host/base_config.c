@@ -0,0 +1,439 @@
+//###########################################################################
+//
+// FILE:   base_config.c
+//
+// TITLE:  The unrolled configHRPWM() of modified3, before EPWM_TABLE.h.
+//
+// Kept verbatim from the baseline commit, renamed baseConfigHRPWM(), as
+// the reference test_epwm_table.c holds configEPWMTable() to.
+//
+//###########################################################################
+
+//
+// Included Files
+//
+#include "F28x_Project.h"
+
+//
+// baseConfigHRPWM - Configures all ePWM channels and sets up HRPWM
+//                on ePWMxA channels &  ePWMxB channels
+//
+void baseConfigHRPWM(uint16_t period)
+{
+    uint16_t j,k;
+
+    //
+    // ePWM channel register configuration with HRPWM
+    // ePWMxA toggle low/high with MEP control on Rising edge
+    //
+    EALLOW;
+    CpuSysRegs.PCLKCR0.bit.TBCLKSYNC = 1;   // Disable TBCLK within the EPWM
+    EDIS;
+
+
+    // IBC PWM INITIALIZATION /////
+
+
+
+    EPwm1Regs.TBCTL.bit.PRDLD = TB_SHADOW;  // set Shadow load
+    EPwm1Regs.TBPRD = period;               // PWM frequency = 1/(2*TBPRD)
+    EPwm1Regs.CMPA.bit.CMPA = period / 2;   // set duty 50% initially
+    EPwm1Regs.CMPA.bit.CMPAHR = (1 << 8);   // initialize HRPWM extension
+    EPwm1Regs.CMPB.bit.CMPB = period / 2;   // set duty 50% initially
+    EPwm1Regs.CMPB.all |= 1;
+  //  (*ePWM[1]).TBPHS.all = 0;
+    EPwm1Regs.TBCTR = 0;
+    EPwm1Regs.DBCTL.bit.HALFCYCLE =1;
+
+    EPwm1Regs.TBCTL.bit.CTRMODE = TB_COUNT_UPDOWN; // Select up-down
+                                                    // count mode
+    EPwm1Regs.TBCTL.bit.SYNCOSEL = TB_SYNC_DISABLE;
+    EPwm1Regs.TBCTL.bit.HSPCLKDIV = TB_DIV1;
+    EPwm1Regs.TBCTL.bit.CLKDIV = TB_DIV1;          // TBCLK = SYSCLKOUT
+    EPwm1Regs.TBCTL.bit.FREE_SOFT = 11;
+
+    EPwm1Regs.DBCTL.bit.OUT_MODE = 3;   // ePWM1A = RED
+    EPwm1Regs.DBCTL.bit.IN_MODE = 0;    // ePWM1A = source for RED & FED
+
+
+
+    EPwm1Regs.CMPCTL.bit.LOADAMODE = CC_CTR_ZERO;  // LOAD CMPA on CTR = 0
+    EPwm1Regs.CMPCTL.bit.LOADBMODE = CC_CTR_ZERO;
+    EPwm1Regs.CMPCTL.bit.SHDWAMODE = CC_SHADOW;
+    EPwm1Regs.CMPCTL.bit.SHDWBMODE = CC_SHADOW;
+
+    EPwm1Regs.AQCTLA.bit.CAU = AQ_CLEAR;// AQ_SET;             // PWM toggle high/low
+    EPwm1Regs.AQCTLA.bit.CAD = AQ_SET;//  AQ_CLEAR;
+    EPwm1Regs.AQCTLB.bit.CBU = AQ_SET;             // PWM toggle high/low
+    EPwm1Regs.AQCTLB.bit.CBD = AQ_CLEAR;
+
+
+
+    EPwm1Regs.HRCNFG.all = 0x0;
+    EPwm1Regs.HRCNFG.bit.EDGMODE = HR_BEP;          // MEP control on
+                                                    // both edges.
+    EPwm1Regs.HRCNFG.bit.CTLMODE = HR_CMP;          // CMPAHR and TBPRDHR
+                                                     // HR control.
+    EPwm1Regs.HRCNFG.bit.HRLOAD = HR_CTR_ZERO_PRD;  // load on CTR = 0
+                                                     // and CTR = TBPRD
+    EPwm1Regs.HRCNFG.bit.EDGMODEB = HR_BEP;         // MEP control on
+                                                     // both edges
+    EPwm1Regs.HRCNFG.bit.CTLMODEB = 1;         // CMPBHR and TBPRDHR
+                                                     // HR control
+    EPwm1Regs.HRCNFG.bit.HRLOADB = HR_CTR_ZERO_PRD; // load on CTR = 0
+                                                     // and CTR = TBPRD
+    EPwm1Regs.HRCNFG.bit.AUTOCONV = 1;        // Enable autoconversion for
+                                               // HR period
+
+    EPwm1Regs.HRPCTL.bit.TBPHSHRLOADE = 1;    // Enable TBPHSHR sync
+                                               // (required for updwn
+                                               //  count HR control)
+    EPwm1Regs.HRPCTL.bit.HRPE = 1;            // Turn on high-resolution
+                                               // period control.
+
+    CpuSysRegs.PCLKCR0.bit.TBCLKSYNC = 1;      // Enable TBCLK within
+                                               // the EPWM
+ //   EPwm1Regs.TBCTL.bit.SWFSYNC = 1;          // Synchronize high
+
+                                               // resolution phase to
+                                               // start HR period
+
+
+
+//PWM2
+
+    EPwm2Regs.TBCTL.bit.PRDLD = TB_SHADOW;  // set Shadow load
+    EPwm2Regs.TBPRD = period;               // PWM frequency = 1/(2*TBPRD)
+    EPwm2Regs.CMPA.bit.CMPA = period / 2;   // set duty 50% initially
+    EPwm2Regs.CMPA.bit.CMPAHR = (1 << 8);   // initialize HRPWM extension
+    EPwm2Regs.CMPB.bit.CMPB = period / 2;   // set duty 50% initially
+    EPwm2Regs.CMPB.all |= 1;
+//    (*ePWM[2]).TBPHS.all = 0;
+    EPwm2Regs.TBCTR = 0;
+    EPwm2Regs.DBCTL.bit.HALFCYCLE =1;
+    EPwm2Regs.TBCTL.bit.PHSEN = 1;        // enable phase shift for ePWM2
+
+    EPwm2Regs.TBCTL.bit.CTRMODE = TB_COUNT_UPDOWN; // Select up-down
+                                                    // count mode
+    EPwm2Regs.TBCTL.bit.SYNCOSEL = 0;
+    EPwm2Regs.TBCTL.bit.HSPCLKDIV = TB_DIV1;
+    EPwm2Regs.TBCTL.bit.CLKDIV = TB_DIV1;          // TBCLK = SYSCLKOUT
+    EPwm2Regs.TBCTL.bit.FREE_SOFT = 11;
+
+
+    EPwm2Regs.DBCTL.bit.OUT_MODE = 3;   // ePWM1A = RED
+    EPwm2Regs.DBCTL.bit.IN_MODE = 0;    // ePWM1A = source for RED & FED
+
+
+    EPwm2Regs.CMPCTL.bit.LOADAMODE = CC_CTR_ZERO;  // LOAD CMPA on CTR = 0
+    EPwm2Regs.CMPCTL.bit.LOADBMODE = CC_CTR_ZERO;
+    EPwm2Regs.CMPCTL.bit.SHDWAMODE = CC_SHADOW;
+    EPwm2Regs.CMPCTL.bit.SHDWBMODE = CC_SHADOW;
+
+    EPwm2Regs.AQCTLA.bit.CAU = AQ_CLEAR;// AQ_SET;             // PWM toggle high/low
+    EPwm2Regs.AQCTLA.bit.CAD = AQ_SET;//  AQ_CLEAR;
+    EPwm2Regs.AQCTLB.bit.CBU = AQ_SET;             // PWM toggle high/low
+    EPwm2Regs.AQCTLB.bit.CBD = AQ_CLEAR;
+
+    EPwm2Regs.HRCNFG.all = 0x0;
+    EPwm2Regs.HRCNFG.bit.EDGMODE = HR_BEP;          // MEP control on
+                                                    // both edges.
+    EPwm2Regs.HRCNFG.bit.CTLMODE = HR_CMP;          // CMPAHR and TBPRDHR
+                                                     // HR control.
+    EPwm2Regs.HRCNFG.bit.HRLOAD = HR_CTR_ZERO_PRD;  // load on CTR = 0
+                                                     // and CTR = TBPRD
+    EPwm2Regs.HRCNFG.bit.EDGMODEB = HR_BEP;         // MEP control on
+                                                     // both edges
+    EPwm2Regs.HRCNFG.bit.CTLMODEB = 1;         // CMPBHR and TBPRDHR
+                                                    // HR control
+    EPwm2Regs.HRCNFG.bit.HRLOADB = HR_CTR_ZERO_PRD; // load on CTR = 0
+                                                     // and CTR = TBPRD
+    EPwm2Regs.HRCNFG.bit.AUTOCONV = 1;        // Enable autoconversion for
+                                               // HR period
+
+    EPwm2Regs.HRPCTL.bit.TBPHSHRLOADE = 1;    // Enable TBPHSHR sync
+                                               // (required for updwn
+                                               //  count HR control)
+    EPwm2Regs.HRPCTL.bit.HRPE = 1;            // Turn on high-resolution
+                                               // period control.
+    EPwm2Regs.TBPHS.bit.TBPHS = 0; // 750 for  minimum voltage  phase shift 695=100
+    EPwm2Regs.TBPHS.bit.TBPHSHR = 1; // 750 for  minimum voltage  phase shift 695=100
+
+    EPwm2Regs.TRREM.bit.TRREM = 0; // 750 for  minimum voltage  phase shift 695=100
+
+
+    CpuSysRegs.PCLKCR0.bit.TBCLKSYNC = 1;      // Enable TBCLK within
+
+                                               // the EPWM
+    EPwm2Regs.TBCTL.bit.SWFSYNC = 1;          // Synchronize high
+                                               // resolution phase to
+                                               // start HR period
+
+
+
+
+
+
+
+    // DAB SECONDry PWM INITIALIZATION
+
+
+    EPwm3Regs.TBCTL.bit.PRDLD = TB_SHADOW;  // set Shadow load
+    EPwm3Regs.TBPRD = period;               // PWM frequency = 1/(2*TBPRD)
+    EPwm3Regs.CMPA.bit.CMPA = period / 2;   // set duty 50% initially
+    EPwm3Regs.CMPA.bit.CMPAHR = (1 << 8);   // initialize HRPWM extension
+    EPwm3Regs.CMPB.bit.CMPB = period / 2;   // set duty 50% initially
+    EPwm3Regs.CMPB.all |= 1;
+     //      (*ePWM[3]).TBPHS.all = 0;
+    EPwm3Regs.TBCTR = 0;
+
+    EPwm3Regs.TBCTL.bit.CTRMODE = TB_COUNT_UPDOWN; // Select up-down
+                                                           // count mode
+    EPwm3Regs.TBCTL.bit.SYNCOSEL = 0;
+    EPwm3Regs.TBCTL.bit.HSPCLKDIV = TB_DIV1;
+    EPwm3Regs.TBCTL.bit.CLKDIV = TB_DIV1;          // TBCLK = SYSCLKOUT
+    EPwm3Regs.TBCTL.bit.FREE_SOFT = 11;
+    EPwm3Regs.TBCTL.bit.PHSEN = 1;        // enable phase shift for ePWM2
+           //(*ePWM[k]).TBCTL.bit.PHSEN = 1;
+
+    EPwm3Regs.DBCTL.bit.OUT_MODE = 3;   // ePWM1A = RED
+    EPwm3Regs.DBCTL.bit.IN_MODE = 0;    // ePWM1A = source for RED & FED
+
+
+    EPwm3Regs.CMPCTL.bit.LOADAMODE = CC_CTR_ZERO;  // LOAD CMPA on CTR = 0
+    EPwm3Regs.CMPCTL.bit.LOADBMODE = CC_CTR_ZERO;
+    EPwm3Regs.CMPCTL.bit.SHDWAMODE = CC_SHADOW;
+    EPwm3Regs.CMPCTL.bit.SHDWBMODE = CC_SHADOW;
+
+    EPwm3Regs.AQCTLA.bit.CAU = AQ_CLEAR;// AQ_SET;             // PWM toggle high/low
+    EPwm3Regs.AQCTLA.bit.CAD = AQ_SET;//  AQ_CLEAR;
+    EPwm3Regs.AQCTLB.bit.CBU = AQ_SET;             // PWM toggle high/low
+    EPwm3Regs.AQCTLB.bit.CBD = AQ_CLEAR;
+
+    EPwm3Regs.HRCNFG.all = 0x0;
+    EPwm3Regs.HRCNFG.bit.EDGMODE = HR_BEP;          // MEP control on
+                                                            // both edges.
+    EPwm3Regs.HRCNFG.bit.CTLMODE = HR_CMP;          // CMPAHR and TBPRDHR
+                                                            // HR control.
+    EPwm3Regs.HRCNFG.bit.HRLOAD = HR_CTR_ZERO_PRD;  // load on CTR = 0
+                                                            // and CTR = TBPRD
+    EPwm3Regs.HRCNFG.bit.EDGMODEB = HR_BEP;         // MEP control on
+                                                            // both edges
+    EPwm3Regs.HRCNFG.bit.CTLMODEB = HR_CMP;         // CMPBHR and TBPRDHR
+                                                            // HR control
+    EPwm3Regs.HRCNFG.bit.HRLOADB = HR_CTR_ZERO_PRD; // load on CTR = 0
+                                                            // and CTR = TBPRD
+    EPwm3Regs.HRCNFG.bit.AUTOCONV = 1;        // Enable autoconversion for
+                                                      // HR period
+
+    EPwm3Regs.HRPCTL.bit.TBPHSHRLOADE = 1;    // Enable TBPHSHR sync
+                                                      // (required for updwn
+                                                      //  count HR control)
+    EPwm3Regs.HRPCTL.bit.HRPE = 1;            // Turn on high-resolution
+                                                      // period control.
+    EPwm3Regs.TBPHS.bit.TBPHS = 0; // 750 for  minimum voltage  phase shift 695=100
+
+    EPwm3Regs.TRREM.bit.TRREM = 0; // 750 for  minimum voltage  phase shift 695=100
+
+    CpuSysRegs.PCLKCR0.bit.TBCLKSYNC = 1;      // Enable TBCLK within
+                                                      // the EPWM
+    EPwm3Regs.TBCTL.bit.SWFSYNC = 1;          // Synchronize high
+                                                      // resolution phase to
+                                                      // start HR period
+
+
+
+
+     EPwm4Regs.TBCTL.bit.PRDLD = TB_SHADOW;  // set Shadow load
+         //     (*ePWM[k]).TBCTL2.bit.PRDLDSYNC = 0x2;  // set Shadow load
+     EPwm4Regs.TBPRD = period;               // PWM frequency = 1/(2*TBPRD)
+     EPwm4Regs.CMPA.bit.CMPA = period / 2;   // set duty 50% initially
+     EPwm4Regs.CMPA.bit.CMPAHR = (1 << 8);   // initialize HRPWM extension
+     EPwm4Regs.CMPB.bit.CMPB = period / 2;   // set duty 50% initially
+     EPwm4Regs.CMPB.all |= 1;
+   //           (*ePWM[4]).TBPHS.all = 0;
+     EPwm4Regs.TBCTR = 0;
+
+     EPwm4Regs.TBCTL.bit.CTRMODE = TB_COUNT_UPDOWN; // Select up-down
+                                                              // count mode
+     EPwm4Regs.TBCTL.bit.SYNCOSEL = 0;
+     EPwm4Regs.TBCTL.bit.HSPCLKDIV = TB_DIV1;
+     EPwm4Regs.TBCTL.bit.CLKDIV = TB_DIV1;          // TBCLK = SYSCLKOUT
+     EPwm4Regs.TBCTL.bit.FREE_SOFT = 11;
+     EPwm4Regs.TBCTL.bit.PHSEN = 1;        // enable phase shift for ePWM2
+
+     EPwm4Regs.DBCTL.bit.OUT_MODE = 2;   // ePWM1A = RED
+     EPwm4Regs.DBCTL.bit.IN_MODE = 0;    // ePWM1A = source for RED & FED
+
+
+     EPwm4Regs.CMPCTL.bit.LOADAMODE = CC_CTR_ZERO;  // LOAD CMPA on CTR = 0
+     EPwm4Regs.CMPCTL.bit.LOADBMODE = CC_CTR_ZERO;
+     EPwm4Regs.CMPCTL.bit.SHDWAMODE = CC_SHADOW;
+     EPwm4Regs.CMPCTL.bit.SHDWBMODE = CC_SHADOW;
+
+     EPwm4Regs.AQCTLA.bit.CAU = AQ_CLEAR;// AQ_SET;             // PWM toggle high/low
+     EPwm4Regs.AQCTLA.bit.CAD = AQ_SET;//  AQ_CLEAR;
+     EPwm4Regs.AQCTLB.bit.CBU = AQ_SET;             // PWM toggle high/low
+     EPwm4Regs.AQCTLB.bit.CBD = AQ_CLEAR;
+
+      EPwm4Regs.HRCNFG.all = 0x0;
+      EPwm4Regs.HRCNFG.bit.EDGMODE = HR_BEP;          // MEP control on
+                                                               // both edges.
+      EPwm4Regs.HRCNFG.bit.CTLMODE = HR_CMP;          // CMPAHR and TBPRDHR
+                                                               // HR control.
+      EPwm4Regs.HRCNFG.bit.HRLOAD = HR_CTR_ZERO_PRD;  // load on CTR = 0
+                                                               // and CTR = TBPRD
+      EPwm4Regs.HRCNFG.bit.EDGMODEB = HR_BEP;         // MEP control on
+                                                               // both edges
+      EPwm4Regs.HRCNFG.bit.CTLMODEB = 1;         // CMPBHR and TBPRDHR
+                                                               // HR control
+      EPwm4Regs.HRCNFG.bit.HRLOADB = HR_CTR_ZERO_PRD; // load on CTR = 0
+                                                               // and CTR = TBPRD
+      EPwm4Regs.HRCNFG.bit.AUTOCONV = 1;        // Enable autoconversion for
+                                                         // HR period
+
+      EPwm4Regs.HRPCTL.bit.TBPHSHRLOADE = 1;    // Enable TBPHSHR sync
+                                                         // (required for updwn
+                                                         //  count HR control)
+      EPwm4Regs.HRPCTL.bit.HRPE = 1;            // Turn on high-resolution
+                                                         // period control.
+      EPwm4Regs.TBPHS.bit.TBPHS = 0; // 750 for  minimum voltage  phase shift 695=100
+      EPwm4Regs.TRREM.bit.TRREM = 0; // 750 for  minimum voltage  phase shift 695=100
+
+      CpuSysRegs.PCLKCR0.bit.TBCLKSYNC = 1;      // Enable TBCLK within
+                                                         // the EPWM
+      EPwm4Regs.TBCTL.bit.SWFSYNC = 1;          // Synchronize high
+                                                         // resolution phase to
+                                                         // start HR period
+
+
+
+
+      EPwm5Regs.TBCTL.bit.PRDLD = TB_SHADOW;  // set Shadow load
+          //     (*ePWM[k]).TBCTL2.bit.PRDLDSYNC = 0x2;  // set Shadow load
+      EPwm5Regs.TBPRD = period;               // PWM frequency = 1/(2*TBPRD)
+      EPwm5Regs.CMPA.bit.CMPA = period / 2;   // set duty 50% initially
+      EPwm5Regs.CMPA.bit.CMPAHR = (1 << 8);   // initialize HRPWM extension
+      EPwm5Regs.CMPB.bit.CMPB = period / 2;   // set duty 50% initially
+      EPwm5Regs.CMPB.all |= 1;
+    //           (*ePWM[4]).TBPHS.all = 0;
+      EPwm5Regs.TBCTR = 0;
+
+      EPwm5Regs.TBCTL.bit.CTRMODE = TB_COUNT_UPDOWN; // Select up-down
+                                                               // count mode
+      EPwm5Regs.TBCTL.bit.SYNCOSEL = 0;
+      EPwm5Regs.TBCTL.bit.HSPCLKDIV = TB_DIV1;
+      EPwm5Regs.TBCTL.bit.CLKDIV = TB_DIV1;          // TBCLK = SYSCLKOUT
+      EPwm5Regs.TBCTL.bit.FREE_SOFT = 11;
+      EPwm5Regs.TBCTL.bit.PHSEN = 1;        // enable phase shift for ePWM2
+
+      EPwm5Regs.CMPCTL.bit.LOADAMODE = CC_CTR_ZERO;  // LOAD CMPA on CTR = 0
+      EPwm5Regs.CMPCTL.bit.LOADBMODE = CC_CTR_ZERO;
+      EPwm5Regs.CMPCTL.bit.SHDWAMODE = CC_SHADOW;
+      EPwm5Regs.CMPCTL.bit.SHDWBMODE = CC_SHADOW;
+
+      EPwm5Regs.AQCTLA.bit.CAU = AQ_CLEAR;// AQ_SET;             // PWM toggle high/low
+      EPwm5Regs.AQCTLA.bit.CAD = AQ_SET;//  AQ_CLEAR;
+      EPwm5Regs.AQCTLB.bit.CBU = AQ_SET;             // PWM toggle high/low
+      EPwm5Regs.AQCTLB.bit.CBD = AQ_CLEAR;
+
+       EPwm5Regs.HRCNFG.all = 0x0;
+       EPwm5Regs.HRCNFG.bit.EDGMODE = HR_BEP;          // MEP control on
+                                                                // both edges.
+       EPwm5Regs.HRCNFG.bit.CTLMODE = HR_CMP;          // CMPAHR and TBPRDHR
+                                                                // HR control.
+       EPwm5Regs.HRCNFG.bit.HRLOAD = HR_CTR_ZERO_PRD;  // load on CTR = 0
+                                                                // and CTR = TBPRD
+       EPwm5Regs.HRCNFG.bit.EDGMODEB = HR_BEP;         // MEP control on
+                                                                // both edges
+       EPwm5Regs.HRCNFG.bit.CTLMODEB = 1;         // CMPBHR and TBPRDHR
+                                                                // HR control
+       EPwm5Regs.HRCNFG.bit.HRLOADB = HR_CTR_ZERO_PRD; // load on CTR = 0
+                                                                // and CTR = TBPRD
+       EPwm5Regs.HRCNFG.bit.AUTOCONV = 1;        // Enable autoconversion for
+                                                          // HR period
+
+       EPwm5Regs.HRPCTL.bit.TBPHSHRLOADE = 1;    // Enable TBPHSHR sync
+                                                          // (required for updwn
+                                                          //  count HR control)
+       EPwm5Regs.HRPCTL.bit.HRPE = 1;            // Turn on high-resolution
+                                                          // period control.
+       EPwm5Regs.TBPHS.bit.TBPHS = 0; // 750 for  minimum voltage  phase shift 695=100
+       EPwm5Regs.TRREM.bit.TRREM = 0; // 750 for  minimum voltage  phase shift 695=100
+
+       CpuSysRegs.PCLKCR0.bit.TBCLKSYNC = 1;      // Enable TBCLK within
+                                                          // the EPWM
+       EPwm5Regs.TBCTL.bit.SWFSYNC = 1;          // Synchronize high
+                                                          // resolution phase to
+                                                          // start HR period
+
+
+
+       EPwm6Regs.TBCTL.bit.PRDLD = TB_SHADOW;  // set Shadow load
+              //     (*ePWM[k]).TBCTL2.bit.PRDLDSYNC = 0x2;  // set Shadow load
+          EPwm6Regs.TBPRD = period;               // PWM frequency = 1/(2*TBPRD)
+          EPwm6Regs.CMPA.bit.CMPA = period / 2;   // set duty 50% initially
+          EPwm6Regs.CMPA.bit.CMPAHR = (1 << 8);   // initialize HRPWM extension
+          EPwm6Regs.CMPB.bit.CMPB = period / 2;   // set duty 50% initially
+          EPwm6Regs.CMPB.all |= 1;
+        //           (*ePWM[4]).TBPHS.all = 0;
+          EPwm6Regs.TBCTR = 0;
+
+          EPwm6Regs.TBCTL.bit.CTRMODE = TB_COUNT_UPDOWN; // Select up-down
+                                                                   // count mode
+          EPwm6Regs.TBCTL.bit.SYNCOSEL = 0;
+          EPwm6Regs.TBCTL.bit.HSPCLKDIV = TB_DIV1;
+          EPwm6Regs.TBCTL.bit.CLKDIV = TB_DIV1;          // TBCLK = SYSCLKOUT
+          EPwm6Regs.TBCTL.bit.FREE_SOFT = 11;
+          EPwm6Regs.TBCTL.bit.PHSEN = 1;        // enable phase shift for ePWM2
+
+          EPwm6Regs.CMPCTL.bit.LOADAMODE = CC_CTR_ZERO;  // LOAD CMPA on CTR = 0
+          EPwm6Regs.CMPCTL.bit.LOADBMODE = CC_CTR_ZERO;
+          EPwm6Regs.CMPCTL.bit.SHDWAMODE = CC_SHADOW;
+          EPwm6Regs.CMPCTL.bit.SHDWBMODE = CC_SHADOW;
+
+          EPwm6Regs.AQCTLA.bit.CAU = AQ_CLEAR;// AQ_SET;             // PWM toggle high/low
+          EPwm6Regs.AQCTLA.bit.CAD = AQ_SET;//  AQ_CLEAR;
+          EPwm6Regs.AQCTLB.bit.CBU = AQ_SET;             // PWM toggle high/low
+          EPwm6Regs.AQCTLB.bit.CBD = AQ_CLEAR;
+
+           EALLOW;
+           EPwm6Regs.HRCNFG.all = 0x0;
+           EPwm6Regs.HRCNFG.bit.EDGMODE = HR_BEP;          // MEP control on
+                                                                    // both edges.
+           EPwm6Regs.HRCNFG.bit.CTLMODE = HR_CMP;          // CMPAHR and TBPRDHR
+                                                                    // HR control.
+           EPwm6Regs.HRCNFG.bit.HRLOAD = HR_CTR_ZERO_PRD;  // load on CTR = 0
+                                                                    // and CTR = TBPRD
+           EPwm6Regs.HRCNFG.bit.EDGMODEB = HR_BEP;         // MEP control on
+                                                                    // both edges
+           EPwm6Regs.HRCNFG.bit.CTLMODEB = 1;         // CMPBHR and TBPRDHR
+                                                                    // HR control
+           EPwm6Regs.HRCNFG.bit.HRLOADB = HR_CTR_ZERO_PRD; // load on CTR = 0
+                                                                    // and CTR = TBPRD
+           EPwm6Regs.HRCNFG.bit.AUTOCONV = 1;        // Enable autoconversion for
+                                                              // HR period
+
+           EPwm6Regs.HRPCTL.bit.TBPHSHRLOADE = 1;    // Enable TBPHSHR sync
+                                                              // (required for updwn
+                                                              //  count HR control)
+           EPwm6Regs.HRPCTL.bit.HRPE = 1;            // Turn on high-resolution
+                                                              // period control.
+           EPwm6Regs.TBPHS.bit.TBPHS = 0; // 750 for  minimum voltage  phase shift 695=100
+           EPwm6Regs.TRREM.bit.TRREM = 0; // 750 for  minimum voltage  phase shift 695=100
+
+           CpuSysRegs.PCLKCR0.bit.TBCLKSYNC = 1;      // Enable TBCLK within
+                                                              // the EPWM
+           EPwm6Regs.TBCTL.bit.SWFSYNC = 1;          // Synchronize high
+                                                              // resolution phase to
+                                                              // start HR period
+
+
+
+
+
+}
+
+//
+// End of File
+//
@@ -0,0 +1,94 @@
+//###########################################################################
+//
+// FILE:   bench_compensator.c
+//
+// TITLE:  Host timing of the COMPENSATOR.h kernels, one Run plus Update per
+//         sample, float32 against Q24.
+//
+//###########################################################################
+
+//
+// Included Files
+//
+#include "F28x_Project.h"
+#include "host_regs.h"
+#include "host_bench.h"
+#include "COMPENSATOR.h"
+
+//
+// Defines
+//
+#define RUNS                    10000000L
+
+//
+// Globals
+//
+volatile float sinkF;           // Keeps the outputs live
+volatile int32_t sinkQ;
+
+//
+// Main
+//
+int main(void)
+{
+    CNTL_2P2Z_F32 f2 = {0.5f, -0.4f, 0.1f, -1.2f, 0.3f};
+    CNTL_3P3Z_F32 f3 = {0.3f, -0.2f, 0.1f, 0.05f, -1.5f, 0.7f, -0.1f};
+    CNTL_PI_F32 fp = {0.5f, 0.01f};
+    CNTL_2P2Z_Q24 q2;
+    CNTL_3P3Z_Q24 q3;
+    CNTL_PI_Q24 qp;
+    float uf, ef;
+    int32_t uq, eq;
+
+    f2.outMin = f3.outMin = fp.outMin = 0.0f;
+    f2.outMax = f3.outMax = fp.outMax = 0.95f;
+    cntlReset2p2zF32(&f2);
+    cntlReset3p3zF32(&f3);
+    cntlResetPiF32(&fp);
+
+    q2.b0 = CNTL_Q24(0.5); q2.b1 = CNTL_Q24(-0.4); q2.b2 = CNTL_Q24(0.1);
+    q2.a1 = CNTL_Q24(-1.2); q2.a2 = CNTL_Q24(0.3);
+    q3.b0 = CNTL_Q24(0.3); q3.b1 = CNTL_Q24(-0.2);
+    q3.b2 = CNTL_Q24(0.1); q3.b3 = CNTL_Q24(0.05);
+    q3.a1 = CNTL_Q24(-1.5); q3.a2 = CNTL_Q24(0.7); q3.a3 = CNTL_Q24(-0.1);
+    qp.kp = CNTL_Q24(0.5); qp.ki = CNTL_Q24(0.01);
+    q2.outMin = q3.outMin = qp.outMin = 0;
+    q2.outMax = q3.outMax = qp.outMax = CNTL_Q24(0.95);
+    cntlReset2p2zQ24(&q2);
+    cntlReset3p3zQ24(&q3);
+    cntlResetPiQ24(&qp);
+
+    //
+    // The error alternates sign so the outputs stay off the limits
+    //
+    HOST_BENCH("2p2z float32", RUNS,
+               ef = (i_ & 64) ? 0.1f : -0.1f;
+               uf = cntlRun2p2zF32(&f2, ef);
+               cntlUpdate2p2zF32(&f2, ef, uf); sinkF = uf);
+    HOST_BENCH("2p2z Q24", RUNS,
+               eq = (i_ & 64) ? CNTL_Q24(0.1) : CNTL_Q24(-0.1);
+               uq = cntlRun2p2zQ24(&q2, eq);
+               cntlUpdate2p2zQ24(&q2, eq, uq); sinkQ = uq);
+    HOST_BENCH("3p3z float32", RUNS,
+               ef = (i_ & 64) ? 0.1f : -0.1f;
+               uf = cntlRun3p3zF32(&f3, ef);
+               cntlUpdate3p3zF32(&f3, ef, uf); sinkF = uf);
+    HOST_BENCH("3p3z Q24", RUNS,
+               eq = (i_ & 64) ? CNTL_Q24(0.1) : CNTL_Q24(-0.1);
+               uq = cntlRun3p3zQ24(&q3, eq);
+               cntlUpdate3p3zQ24(&q3, eq, uq); sinkQ = uq);
+    HOST_BENCH("PI float32", RUNS,
+               ef = (i_ & 64) ? 0.1f : -0.1f;
+               uf = cntlRunPiF32(&fp, ef);
+               cntlUpdatePiF32(&fp, ef); sinkF = uf);
+    HOST_BENCH("PI Q24", RUNS,
+               eq = (i_ & 64) ? CNTL_Q24(0.1) : CNTL_Q24(-0.1);
+               uq = cntlRunPiQ24(&qp, eq);
+               cntlUpdatePiQ24(&qp, eq); sinkQ = uq);
+
+    return(0);
+}
+
+//
+// End of File
+//
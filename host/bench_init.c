@@ -0,0 +1,45 @@
+//###########################################################################
+//
+// FILE:   bench_init.c
+//
+// TITLE:  Host timing of the DC board configuration and ADCA INT1 paths.
+//
+//###########################################################################
+
+//
+// Included Files
+//
+#include "F28x_Project.h"
+#include "host_regs.h"
+#include "host_bench.h"
+
+//
+// Application functions (hrpwm_ex2_prdupdown_sfo_v9_noman_dc_board_test.c)
+//
+extern void configHRPWM(uint16_t period);
+extern void initADCSOC(void);
+extern void initADCSequencer(const uint16_t *a, uint16_t na,
+                             const uint16_t *b, uint16_t nb);
+extern __interrupt void adcA1ISR(void);
+extern const uint16_t adcChannelsA[];
+
+//
+// Main
+//
+int main(void)
+{
+    hostReset();
+    InitPieCtrl();
+    initADCSOC();
+    initADCSequencer(adcChannelsA, 1, 0, 0);
+
+    HOST_BENCH("configHRPWM", 100000, configHRPWM(500));
+    HOST_BENCH("adcA1ISR", 1000000,
+               AdcaResultRegs.ADCRESULT0 = i_ & 0xFFF; adcA1ISR());
+
+    return(0);
+}
+
+//
+// End of File
+//
@@ -0,0 +1,277 @@
+//###########################################################################
+//
+// FILE:   dma_sim.c
+//
+// TITLE:  DMA channel model for the host build (see dma_sim.h).
+//
+// Per channel, as the F28004x DMA does:
+//
+//   - A CONTROL.RUN write starts the channel: the active addresses load
+//     from the shadows, the counts from the sizes, and with CHINTMODE = 0
+//     the channel interrupt fires. HALT stops it; SOFTRESET stops it and
+//     clears the counts. RUNSTS and TRANSFERSTS follow.
+//   - Each peripheral trigger, with PERINTE set, moves one burst of
+//     BURST_SIZE + 1 words (or the whole transfer with ONESHOT), stepping
+//     both addresses by the burst step between words.
+//   - After a burst that is not the last of the transfer, each address
+//     either wraps, when its wrap count has run out, to the begin address
+//     plus the wrap step, or moves by the transfer step; a wrap count
+//     reloads from the wrap size, so it wraps every WRAP_SIZE + 1 bursts.
+//   - After the last burst, the interrupt fires with CHINTMODE = 1; with
+//     CONTINUOUS the next transfer starts at once as on RUN, otherwise
+//     the channel stops.
+//
+// The address registers hold host addresses, which the application
+// writes as (uint32_t)&x the same way as on the target. Host addresses
+// count bytes and device addresses count 16-bit words, so every step is
+// taken in units of sizeof(uint16_t). DATASIZE = 1 moves 32 bits per
+// word slot, and the steps stay in 16-bit words. Arbitration, the
+// overflow flag and the trigger source selection are not modelled: the
+// caller names the channel each trigger goes to.
+//
+//###########################################################################
+
+//
+// Included Files
+//
+#include "f28004x_device.h"
+#include "f28004x_examples.h"
+#include "dma_sim.h"
+
+//
+// Globals
+//
+DMA_SIM_CHANNEL dmaSim[DMA_SIM_CHANNELS];
+
+//
+// simChannel - Register frame of channel ch (1-6)
+//
+static volatile struct CH_REGS *simChannel(uint16_t ch)
+{
+    return(&DmaRegs.CH1 + (ch - 1));
+}
+
+//
+// simInterrupt - Channel interrupt of channel ch
+//
+static void simInterrupt(uint16_t ch)
+{
+    volatile struct CH_REGS *c = simChannel(ch);
+
+    if(!c->MODE.bit.CHINTE)
+    {
+        return;
+    }
+
+    dmaSim[ch - 1].interrupts++;
+    if((ch == 1) && (PieVectTable.DMA_CH1_INT != NULL))
+    {
+        PieVectTable.DMA_CH1_INT();
+    }
+}
+
+//
+// simStart - Start a transfer on channel ch
+//
+static void simStart(uint16_t ch)
+{
+    volatile struct CH_REGS *c = simChannel(ch);
+
+    c->SRC_BEG_ADDR_ACTIVE = c->SRC_BEG_ADDR_SHADOW;
+    c->SRC_ADDR_ACTIVE = c->SRC_ADDR_SHADOW;
+    c->DST_BEG_ADDR_ACTIVE = c->DST_BEG_ADDR_SHADOW;
+    c->DST_ADDR_ACTIVE = c->DST_ADDR_SHADOW;
+    c->TRANSFER_COUNT = c->TRANSFER_SIZE;
+    c->SRC_WRAP_COUNT = c->SRC_WRAP_SIZE;
+    c->DST_WRAP_COUNT = c->DST_WRAP_SIZE;
+    c->CONTROL.bit.RUNSTS = 1;
+    c->CONTROL.bit.TRANSFERSTS = 1;
+
+    if(!c->MODE.bit.CHINTMODE)
+    {
+        simInterrupt(ch);
+    }
+}
+
+//
+// simStep - Address a stepped by step 16-bit words
+//
+static uint32_t simStep(uint32_t a, int16_t step)
+{
+    return(a + (int32_t)step * (int32_t)sizeof(uint16_t));
+}
+
+//
+// simBurst - Move one burst on channel ch; 1 if it ended the transfer
+//
+static uint16_t simBurst(uint16_t ch)
+{
+    volatile struct CH_REGS *c = simChannel(ch);
+    uint16_t n;
+
+    c->BURST_COUNT = c->BURST_SIZE;
+    for(;;)
+    {
+        if(c->MODE.bit.DATASIZE)
+        {
+            *(volatile uint32_t *)(uintptr_t)c->DST_ADDR_ACTIVE =
+                *(volatile uint32_t *)(uintptr_t)c->SRC_ADDR_ACTIVE;
+        }
+        else
+        {
+            *(volatile uint16_t *)(uintptr_t)c->DST_ADDR_ACTIVE =
+                *(volatile uint16_t *)(uintptr_t)c->SRC_ADDR_ACTIVE;
+        }
+
+        if(c->BURST_COUNT == 0)
+        {
+            break;
+        }
+        c->BURST_COUNT--;
+        c->SRC_ADDR_ACTIVE = simStep(c->SRC_ADDR_ACTIVE, c->SRC_BURST_STEP);
+        c->DST_ADDR_ACTIVE = simStep(c->DST_ADDR_ACTIVE, c->DST_BURST_STEP);
+    }
+    dmaSim[ch - 1].bursts++;
+
+    if(c->TRANSFER_COUNT == 0)
+    {
+        return(1);
+    }
+    c->TRANSFER_COUNT--;
+
+    //
+    // Source and destination wrap independently
+    //
+    n = c->SRC_WRAP_COUNT;
+    if(n == 0)
+    {
+        c->SRC_WRAP_COUNT = c->SRC_WRAP_SIZE;
+        c->SRC_BEG_ADDR_ACTIVE = simStep(c->SRC_BEG_ADDR_ACTIVE,
+                                         c->SRC_WRAP_STEP);
+        c->SRC_ADDR_ACTIVE = c->SRC_BEG_ADDR_ACTIVE;
+    }
+    else
+    {
+        c->SRC_WRAP_COUNT = n - 1;
+        c->SRC_ADDR_ACTIVE = simStep(c->SRC_ADDR_ACTIVE,
+                                     c->SRC_TRANSFER_STEP);
+    }
+
+    n = c->DST_WRAP_COUNT;
+    if(n == 0)
+    {
+        c->DST_WRAP_COUNT = c->DST_WRAP_SIZE;
+        c->DST_BEG_ADDR_ACTIVE = simStep(c->DST_BEG_ADDR_ACTIVE,
+                                         c->DST_WRAP_STEP);
+        c->DST_ADDR_ACTIVE = c->DST_BEG_ADDR_ACTIVE;
+    }
+    else
+    {
+        c->DST_WRAP_COUNT = n - 1;
+        c->DST_ADDR_ACTIVE = simStep(c->DST_ADDR_ACTIVE,
+                                     c->DST_TRANSFER_STEP);
+    }
+
+    return(0);
+}
+
+//
+// dmaSimReset - Clear the model's counters. Call after hostReset().
+//
+void dmaSimReset(void)
+{
+    memset(dmaSim, 0, sizeof(dmaSim));
+}
+
+//
+// dmaSimPoll - Act on the RUN, HALT and SOFTRESET strobes written since
+//              the last call, on every channel. The DMACTRL resets only
+//              clear: they come before the channel setup they would undo.
+//
+void dmaSimPoll(void)
+{
+    volatile struct CH_REGS *c;
+    uint16_t ch;
+
+    DmaRegs.DMACTRL.bit.HARDRESET = 0;
+    DmaRegs.DMACTRL.bit.PRIORITYRESET = 0;
+
+    for(ch = 1; ch <= DMA_SIM_CHANNELS; ch++)
+    {
+        c = simChannel(ch);
+
+        if(c->CONTROL.bit.SOFTRESET)
+        {
+            c->CONTROL.bit.SOFTRESET = 0;
+            c->CONTROL.bit.RUNSTS = 0;
+            c->CONTROL.bit.TRANSFERSTS = 0;
+            c->BURST_COUNT = 0;
+            c->TRANSFER_COUNT = 0;
+        }
+        if(c->CONTROL.bit.HALT)
+        {
+            c->CONTROL.bit.HALT = 0;
+            c->CONTROL.bit.RUNSTS = 0;
+        }
+        if(c->CONTROL.bit.RUN)
+        {
+            c->CONTROL.bit.RUN = 0;
+            if(c->CONTROL.bit.TRANSFERSTS)
+            {
+                c->CONTROL.bit.RUNSTS = 1;      // Resume after HALT
+            }
+            else
+            {
+                simStart(ch);
+            }
+        }
+        c->CONTROL.bit.PERINTCLR = 0;
+        c->CONTROL.bit.ERRCLR = 0;
+    }
+}
+
+//
+// dmaSimTrigger - One peripheral trigger on channel ch (1-6)
+//
+void dmaSimTrigger(uint16_t ch)
+{
+    volatile struct CH_REGS *c = simChannel(ch);
+    uint16_t done;
+
+    dmaSimPoll();
+
+    if(!c->MODE.bit.PERINTE || !c->CONTROL.bit.RUNSTS)
+    {
+        return;
+    }
+
+    do
+    {
+        done = simBurst(ch);
+    } while(!done && c->MODE.bit.ONESHOT);
+
+    if(!done)
+    {
+        return;
+    }
+
+    dmaSim[ch - 1].transfers++;
+    c->CONTROL.bit.TRANSFERSTS = 0;
+    if(c->MODE.bit.CHINTMODE)
+    {
+        simInterrupt(ch);
+    }
+
+    if(c->MODE.bit.CONTINUOUS)
+    {
+        simStart(ch);
+    }
+    else
+    {
+        c->CONTROL.bit.RUNSTS = 0;
+    }
+}
+
+//
+// End of File
+//
@@ -0,0 +1,964 @@
+//###########################################################################
+//
+// FILE:   epwm_sim.c
+//
+// TITLE:  ePWM/HRPWM output simulator for the host build (see epwm_sim.h).
+//
+// Every SYSCLK, each ePWM module whose TBCLK is due takes one step from
+// the register image in hostRegs, so the application configures and
+// updates it with its own code. Per TBCLK:
+//
+//   - Time base: TBCLK = SYSCLK / (CLKDIV * HSPCLKDIV), held while
+//     PCLKCR0.TBCLKSYNC = 0. Up, down and up-down counting. TBPRD loads at
+//     CTR = 0 unless PRDLD is set. A write to TBCTR is picked up on the
+//     next TBCLK; TBCTR and TBSTS.CTRDIR are written back.
+//   - Sync: the F28004x reset chain, ePWM1 -> 2 -> 3 and ePWM1 -> 4 -> 5
+//     -> 6. SYNCOSEL passes SYNCI (or SWFSYNC) through, or fires at
+//     CTR = 0 or CTR = CMPB; OSHTSYNCMODE lets one pulse out per OSHTSYNC.
+//     With PHSEN, TBPHS and PHSDIR load EPWM_SIM_SYNC_DELAY TBCLKs after
+//     the SYNCO that caused it, the delay HRPWM_MATH.h compensates.
+//   - Compare: CMPA:CMPAHR and CMPB:CMPBHR load per LOADxMODE unless
+//     SHDWxMODE is set. HRLOAD is taken to match LOADAMODE.
+//   - Global load: with GLDCTL.GLD, the registers selected in GLDCFG
+//     (TBPRD, CMPA, CMPB and AQCSFRC) load only on the GLDMODE event,
+//     and in OSHTMODE only once per GLDCTL2.OSHTLD strobe of the module
+//     or of the one its EPWMXLINK.GLDCTL2LINK points at. GFRCLD loads at
+//     once. GLDPRD is not modelled.
+//   - Action qualifier: the highest priority event with an action sets
+//     the output. AQCSFRC loads per AQSFRC.RLDCSF and, while it forces,
+//     holds the output against events and one-time forces; otherwise
+//     AQSFRC.OTSFx applies ACTSFx once.
+//   - MEP: with CTLMODE = HR_CMP, an edge the EDGMODE selects moves by
+//     the CMPxHR fraction, later on the up count and earlier on the down
+//     count. With HR_PHS, the TBPHSHR fraction latched at the last sync
+//     moves every selected edge: earlier after an up-count load, later
+//     after a down-count one. With AUTOCONV the fraction is converted to
+//     MEP steps with HRMSTEP, as the device does, and the steps to time
+//     with epwmSimMepSf, the true step count of the silicon; a stale
+//     HRMSTEP shows up as an edge placement error. TBPRDHR (HRPE) and
+//     TRREM are not modelled.
+//   - Dead band: RED delays rising and FED falling edges of the IN_MODE
+//     input by DBRED/DBFED TBCLKs, or half TBCLKs with HALFCYCLE; a pulse
+//     shorter than the delay is swallowed. POLSEL and OUT_MODE as on the
+//     device. OUTSWAP and the shadow modes are not modelled.
+//   - Trip zone: TZFLG.OST, set by a TZFRC.OST write and cleared by a
+//     TZCLR.OST write, drives the outputs per TZCTL.TZA/TZB. Digital
+//     compare: DCAH is the TRIPIN DCTRIPSEL.DCAHCOMPSEL selects, from the
+//     levels the harness puts in epwmSimTripIn; DCAEVT1 (TZDCSEL, DCAH
+//     conditions only) sets TZFLG.DCAEVT1 and, with TZSEL.DCAEVT1, trips
+//     OST again each SYSCLK it stays active. INT sets when OST does. The
+//     X-BAR and the DCAEVT1 filter/sync options are not modelled.
+//   - SOCA: per ETSEL.SOCASEL and ETPS.SOCAPRD; sets ETFLG.SOCA and calls
+//     epwmSimSocaHook, if set, with the module number.
+//
+// The registers the device clears on its own (SWFSYNC, OSHTSYNC, OSHTLD,
+// GFRCLD, OTSFx, TZFRC, TZCLR) are cleared here once acted on.
+//
+//###########################################################################
+
+//
+// Included Files
+//
+#include "f28004x_device.h"
+#include "f28004x_examples.h"
+#include "host_regs.h"
+#include "epwm_sim.h"
+
+//
+// Defines
+//
+#define SIM_NONE                0xFF    // No sync source
+
+//
+// Action qualifier events
+//
+#define SIM_ZRO                 0
+#define SIM_PRD                 1
+#define SIM_CAU                 2
+#define SIM_CAD                 3
+#define SIM_CBU                 4
+#define SIM_CBD                 5
+#define SIM_EVENTS              6
+
+//
+// Globals
+//
+EPWM_SIM_MODULE epwmSim[EPWM_SIM_MODULES];
+uint64_t epwmSimTime;
+uint16_t epwmSimMepSf = 60;
+void (*epwmSimSocaHook)(uint16_t module);
+uint16_t epwmSimTripIn;
+
+static EPWM_SIM_EDGE simEdges[EPWM_SIM_OUTPUTS][EPWM_SIM_MAX_EDGES];
+static uint32_t simEdgeCount[EPWM_SIM_OUTPUTS];
+static uint16_t simLevel[EPWM_SIM_OUTPUTS];
+
+static volatile struct EPWM_REGS *const simRegs[EPWM_SIM_MODULES] =
+{
+    &EPwm1Regs, &EPwm2Regs, &EPwm3Regs, &EPwm4Regs, &EPwm5Regs, &EPwm6Regs
+};
+
+//
+// SYNCI source of each module (SYNCSELECT reset values)
+//
+static const uint16_t simSyncSrc[EPWM_SIM_MODULES] =
+{
+    SIM_NONE, 0, 1, 0, 3, 4
+};
+
+//
+// Events by falling priority, when counting up and when counting down
+// (up-down count mode), and in up and down count mode
+//
+static const uint16_t simPrioUp[] = {SIM_ZRO, SIM_CBU, SIM_CAU, SIM_CBD,
+                                     SIM_CAD};
+static const uint16_t simPrioDown[] = {SIM_PRD, SIM_CBD, SIM_CAD, SIM_CBU,
+                                       SIM_CAU};
+static const uint16_t simPrioUpMode[] = {SIM_PRD, SIM_CBU, SIM_CAU, SIM_ZRO};
+static const uint16_t simPrioDownMode[] = {SIM_ZRO, SIM_CBD, SIM_CAD,
+                                           SIM_PRD};
+
+//
+// simTbclk - TBCLK period of module r in fs
+//
+static uint64_t simTbclk(volatile struct EPWM_REGS *r)
+{
+    uint16_t hsp = r->TBCTL.bit.HSPCLKDIV;
+
+    return(EPWM_SIM_SYSCLK_FS * (1U << r->TBCTL.bit.CLKDIV) *
+           (hsp ? 2U * hsp : 1U));
+}
+
+//
+// simMep - Edge displacement in fs of the fraction in the high byte of hr
+//
+static uint64_t simMep(volatile struct EPWM_REGS *r, uint16_t hr)
+{
+    uint32_t steps = hr >> 8;
+
+    if(r->HRCNFG.bit.AUTOCONV)
+    {
+        steps = (steps * EPwm1Regs.HRMSTEP.bit.HRMSTEP + 0x80) >> 8;
+    }
+
+    return(epwmSimMepSf ? steps * simTbclk(r) / epwmSimMepSf : 0);
+}
+
+//
+// simEdge - Record output o at level from time t on
+//
+static void simEdge(uint16_t o, uint64_t t, uint16_t level)
+{
+    uint32_t n = simEdgeCount[o];
+
+    if(level == simLevel[o])
+    {
+        return;
+    }
+
+    simLevel[o] = level;
+
+    if(n < EPWM_SIM_MAX_EDGES)
+    {
+        //
+        // A MEP advance can place an edge before one recorded in the
+        // previous TBCLK; keep the list in time order
+        //
+        if((n > 0) && (t < simEdges[o][n - 1].t))
+        {
+            t = simEdges[o][n - 1].t;
+        }
+
+        simEdges[o][n].t = t;
+        simEdges[o][n].level = level;
+        simEdgeCount[o] = n + 1;
+    }
+}
+
+//
+// simTrip - Level of a pin with raw output level after trip action tz
+//
+static uint16_t simTrip(uint16_t tz, uint16_t level)
+{
+    switch(tz)
+    {
+        case 0:  return(EPWM_SIM_Z);
+        case 1:  return(1);
+        case 2:  return(0);
+        default: return(level);
+    }
+}
+
+//
+// simOutput - Update the pins of module m at time t
+//
+static void simOutput(uint16_t m, uint64_t t)
+{
+    EPWM_SIM_MODULE *s = &epwmSim[m];
+    volatile struct EPWM_REGS *r = simRegs[m];
+    uint16_t mode = r->DBCTL.bit.OUT_MODE;
+    uint16_t pol = r->DBCTL.bit.POLSEL;
+    uint16_t a, b;
+
+    s->raw[0] = (mode & 2) ? s->red.out ^ (pol & 1) : s->aq[0];
+    s->raw[1] = (mode & 1) ? s->fed.out ^ (pol >> 1) : s->aq[1];
+
+    a = s->raw[0];
+    b = s->raw[1];
+    if(r->TZFLG.bit.OST)
+    {
+        a = simTrip(r->TZCTL.bit.TZA, a);
+        b = simTrip(r->TZCTL.bit.TZB, b);
+    }
+
+    simEdge(2 * m, t, a);
+    simEdge(2 * m + 1, t, b);
+}
+
+//
+// simFlush - Take the dead-band edges of module m due by time t
+//
+static void simFlush(uint16_t m, uint64_t t)
+{
+    EPWM_SIM_MODULE *s = &epwmSim[m];
+    EPWM_SIM_DB_PATH *p;
+
+    for(;;)
+    {
+        p = NULL;
+        if(s->red.pending && (s->red.t <= t))
+        {
+            p = &s->red;
+        }
+        if(s->fed.pending && (s->fed.t <= t) && ((p == NULL) ||
+           (s->fed.t < p->t)))
+        {
+            p = &s->fed;
+        }
+        if(p == NULL)
+        {
+            return;
+        }
+
+        p->pending = 0;
+        p->out = p->in;
+        simOutput(m, p->t);
+    }
+}
+
+//
+// simPath - Drive dead-band path p to level at time t; the edge towards
+//           delayed (1 for RED, 0 for FED) comes out delay fs later
+//
+static void simPath(EPWM_SIM_DB_PATH *p, uint16_t level, uint64_t t,
+                    uint64_t delay, uint16_t delayed)
+{
+    if(level == p->in)
+    {
+        return;
+    }
+
+    p->in = level;
+    if((level == delayed) && (delay != 0))
+    {
+        p->pending = 1;
+        p->t = t + delay;
+    }
+    else
+    {
+        p->pending = 0;             // Swallows a pulse still in the delay
+        p->out = level;
+    }
+}
+
+//
+// simAq - Set AQ output ch of module m to level at time t
+//
+static void simAq(uint16_t m, uint16_t ch, uint16_t level, uint64_t t)
+{
+    EPWM_SIM_MODULE *s = &epwmSim[m];
+    volatile struct EPWM_REGS *r = simRegs[m];
+    uint64_t unit = simTbclk(r) >> r->DBCTL.bit.HALFCYCLE;
+    uint16_t in = r->DBCTL.bit.IN_MODE;
+
+    if(s->aq[ch] == level)
+    {
+        return;
+    }
+
+    simFlush(m, t);
+    s->aq[ch] = level;
+    simPath(&s->red, s->aq[in & 1], t, r->DBRED * unit, 1);
+    simPath(&s->fed, s->aq[in >> 1], t, r->DBFED * unit, 0);
+    simOutput(m, t);
+}
+
+//
+// simForce - Level after software force action act (AQ_xxx) on level
+//
+static uint16_t simForce(uint16_t act, uint16_t level)
+{
+    switch(act)
+    {
+        case 1:  return(0);
+        case 2:  return(1);
+        case 3:  return(level ^ 1);
+        default: return(level);
+    }
+}
+
+//
+// simShift - MEP displacement in fs of an edge of channel ch to level,
+//            caused by event ev
+//
+static int64_t simShift(uint16_t m, uint16_t ch, uint16_t ev,
+                        uint16_t level)
+{
+    EPWM_SIM_MODULE *s = &epwmSim[m];
+    volatile struct EPWM_REGS *r = simRegs[m];
+    uint16_t edgmode, ctlmode, up, down;
+    uint16_t hr;
+
+    if(ch == 0)
+    {
+        edgmode = r->HRCNFG.bit.EDGMODE;
+        ctlmode = r->HRCNFG.bit.CTLMODE;
+        up = SIM_CAU;
+        down = SIM_CAD;
+        hr = s->cmpa & 0xFFFF;
+    }
+    else
+    {
+        edgmode = r->HRCNFG.bit.EDGMODEB;
+        ctlmode = r->HRCNFG.bit.CTLMODEB;
+        up = SIM_CBU;
+        down = SIM_CBD;
+        hr = s->cmpb & 0xFFFF;
+    }
+
+    if(!(edgmode & (level ? HR_REP : HR_FEP)))
+    {
+        return(0);
+    }
+
+    if(ctlmode == HR_PHS)
+    {
+        return(s->phsShift);
+    }
+
+    if(ev == up)
+    {
+        return((int64_t)simMep(r, hr));
+    }
+    if(ev == down)
+    {
+        return(-(int64_t)simMep(r, hr));
+    }
+
+    return(0);
+}
+
+//
+// simAction - Apply the winning action qualifier event of channel ch
+//
+static void simAction(uint16_t m, uint16_t ch, const uint16_t *ev,
+                      const uint16_t *prio, uint16_t n, uint64_t t)
+{
+    EPWM_SIM_MODULE *s = &epwmSim[m];
+    volatile struct EPWM_REGS *r = simRegs[m];
+    uint16_t aqctl = ch ? r->AQCTLB.all : r->AQCTLA.all;
+    uint16_t i, act, level;
+    int64_t shift;
+
+    for(i = 0; i < n; i++)
+    {
+        if(!ev[prio[i]])
+        {
+            continue;
+        }
+
+        act = (aqctl >> (2 * prio[i])) & 3;
+        if(act == 0)
+        {
+            continue;
+        }
+
+        level = simForce(act, s->aq[ch]);
+        if(level != s->aq[ch])
+        {
+            shift = simShift(m, ch, prio[i], level);
+            simAq(m, ch, level, (uint64_t)((int64_t)t + shift));
+        }
+        return;
+    }
+}
+
+//
+// simLoad - Active register loads of module m on events zro/prd; a
+//           register selected in GLDCFG loads only if gld
+//
+static void simLoad(uint16_t m, uint16_t zro, uint16_t prd, uint16_t gld)
+{
+    EPWM_SIM_MODULE *s = &epwmSim[m];
+    volatile struct EPWM_REGS *r = simRegs[m];
+    uint16_t cfg = r->GLDCTL.bit.GLD ? r->GLDCFG.all : 0;
+    uint16_t mode;
+
+    if((cfg & 0x0001) ? gld : (!r->TBCTL.bit.PRDLD && zro))
+    {
+        s->prd = r->TBPRD;
+    }
+
+    mode = r->CMPCTL.bit.LOADAMODE;
+    if((cfg & 0x0002) ? gld : (!r->CMPCTL.bit.SHDWAMODE &&
+       (((mode == 0) && zro) || ((mode == 1) && prd) ||
+        ((mode == 2) && (zro || prd)))))
+    {
+        s->cmpa = r->CMPA.all;
+    }
+
+    mode = r->CMPCTL.bit.LOADBMODE;
+    if((cfg & 0x0004) ? gld : (!r->CMPCTL.bit.SHDWBMODE &&
+       (((mode == 0) && zro) || ((mode == 1) && prd) ||
+        ((mode == 2) && (zro || prd)))))
+    {
+        s->cmpb = r->CMPB.all;
+    }
+
+    mode = r->AQSFRC.bit.RLDCSF;
+    if((cfg & 0x0400) ? gld : (((mode == 0) && zro) ||
+       ((mode == 1) && prd) || ((mode == 2) && (zro || prd))))
+    {
+        s->csf = r->AQCSFRC.all;
+    }
+}
+
+//
+// simImmediate - Loads of module m that take effect on every TBCLK
+//
+static void simImmediate(uint16_t m)
+{
+    EPWM_SIM_MODULE *s = &epwmSim[m];
+    volatile struct EPWM_REGS *r = simRegs[m];
+    uint16_t cfg = r->GLDCTL.bit.GLD ? r->GLDCFG.all : 0;
+
+    if(!(cfg & 0x0001) && r->TBCTL.bit.PRDLD)
+    {
+        s->prd = r->TBPRD;
+    }
+    if(!(cfg & 0x0002) && r->CMPCTL.bit.SHDWAMODE)
+    {
+        s->cmpa = r->CMPA.all;
+    }
+    if(!(cfg & 0x0004) && r->CMPCTL.bit.SHDWBMODE)
+    {
+        s->cmpb = r->CMPB.all;
+    }
+    if(!(cfg & 0x0400) && (r->AQSFRC.bit.RLDCSF == 3))
+    {
+        s->csf = r->AQCSFRC.all;
+    }
+}
+
+//
+// simDcaEvt1 - 1 while the DCAEVT1 condition of module r holds
+//
+static uint16_t simDcaEvt1(volatile struct EPWM_REGS *r)
+{
+    uint16_t sel = r->DCTRIPSEL.bit.DCAHCOMPSEL;
+    uint16_t dcah = (sel < 15) ? (epwmSimTripIn >> sel) & 1 : 0;
+
+    switch(r->TZDCSEL.bit.DCAEVT1)
+    {
+        case 1:  return(!dcah);         // DCAH low
+        case 2:  return(dcah);          // DCAH high
+        default: return(0);             // Disabled or on DCAL
+    }
+}
+
+//
+// simStrobes - Act on the self-clearing bits written since the last SYSCLK
+//
+static void simStrobes(void)
+{
+    volatile struct EPWM_REGS *r;
+    uint16_t m, n, link, trip;
+
+    for(m = 0; m < EPWM_SIM_MODULES; m++)
+    {
+        r = simRegs[m];
+
+        if(r->GLDCTL2.bit.OSHTLD || r->GLDCTL2.bit.GFRCLD)
+        {
+            link = r->EPWMXLINK.bit.GLDCTL2LINK;
+            for(n = 0; n < EPWM_SIM_MODULES; n++)
+            {
+                if((n != m) && (simRegs[n]->EPWMXLINK.bit.GLDCTL2LINK != m) &&
+                   (simRegs[n]->EPWMXLINK.bit.GLDCTL2LINK != link))
+                {
+                    continue;
+                }
+
+                if(r->GLDCTL2.bit.OSHTLD)
+                {
+                    epwmSim[n].gldArmed = 1;
+                }
+                if(r->GLDCTL2.bit.GFRCLD && simRegs[n]->GLDCTL.bit.GLD)
+                {
+                    simLoad(n, 0, 0, 1);
+                    epwmSim[n].globalLoads++;
+                }
+            }
+            r->GLDCTL2.all = 0;
+        }
+
+        if(r->TBCTL2.bit.OSHTSYNC)
+        {
+            r->TBCTL2.bit.OSHTSYNC = 0;
+            epwmSim[m].syncArmed = 1;
+        }
+
+        //
+        // TZCLR bits clear the TZFLG bits they line up with
+        //
+        if(r->TZCLR.all)
+        {
+            r->TZFLG.all &= ~r->TZCLR.all;
+            r->TZCLR.all = 0;
+        }
+
+        trip = r->TZFRC.bit.OST;
+        r->TZFRC.all = 0;
+        if(simDcaEvt1(r))
+        {
+            r->TZFLG.bit.DCAEVT1 = 1;
+            trip |= r->TZSEL.bit.DCAEVT1;
+        }
+        if(trip && !r->TZFLG.bit.OST)
+        {
+            r->TZFLG.bit.OST = 1;
+            r->TZFLG.bit.INT = 1;
+        }
+    }
+}
+
+//
+// simSoca - Count SOCA event of module m, pulsing SOCA every SOCAPRD
+//
+static void simSoca(uint16_t m, const uint16_t *ev)
+{
+    EPWM_SIM_MODULE *s = &epwmSim[m];
+    volatile struct EPWM_REGS *r = simRegs[m];
+    uint16_t hit;
+
+    if(!r->ETSEL.bit.SOCAEN || (r->ETPS.bit.SOCAPRD == 0))
+    {
+        return;
+    }
+
+    switch(r->ETSEL.bit.SOCASEL)
+    {
+        case 1:  hit = ev[SIM_ZRO]; break;
+        case 2:  hit = ev[SIM_PRD]; break;
+        case 3:  hit = ev[SIM_ZRO] || ev[SIM_PRD]; break;
+        case 4:  hit = ev[SIM_CAU]; break;
+        case 5:  hit = ev[SIM_CAD]; break;
+        case 6:  hit = ev[SIM_CBU]; break;
+        case 7:  hit = ev[SIM_CBD]; break;
+        default: hit = 0; break;
+    }
+
+    if(hit && (++s->socCount >= r->ETPS.bit.SOCAPRD))
+    {
+        s->socCount = 0;
+        s->socs++;
+        r->ETFLG.bit.SOCA = 1;
+        if(epwmSimSocaHook != NULL)
+        {
+            epwmSimSocaHook(m + 1);
+        }
+    }
+}
+
+//
+// simStart - Latch the active registers of module m as its TBCLK starts
+//
+static void simStart(uint16_t m)
+{
+    EPWM_SIM_MODULE *s = &epwmSim[m];
+    volatile struct EPWM_REGS *r = simRegs[m];
+
+    s->started = 1;
+    s->prescale = 0;
+    s->ctr = r->TBCTR;
+    s->ctrImage = s->ctr;
+    s->up = (r->TBCTL.bit.CTRMODE != TB_COUNT_DOWN);
+    s->prd = r->TBPRD;
+    s->cmpa = r->CMPA.all;
+    s->cmpb = r->CMPB.all;
+    s->csf = r->AQCSFRC.all;
+}
+
+//
+// simTick - One TBCLK of module m at time t
+//
+static void simTick(uint16_t m, uint64_t t)
+{
+    EPWM_SIM_MODULE *s = &epwmSim[m];
+    volatile struct EPWM_REGS *r = simRegs[m];
+    uint16_t mode = r->TBCTL.bit.CTRMODE;
+    uint16_t ev[SIM_EVENTS];
+    uint16_t swf, syncIn, syncOut, gld, ch, level, force;
+    uint16_t cmpa, cmpb;
+    const uint16_t *prio;
+    uint16_t n;
+    uint32_t i;
+
+    simFlush(m, t);
+
+    if(r->TBCTR != s->ctrImage)
+    {
+        s->ctr = r->TBCTR;              // Written by the application
+    }
+
+    //
+    // TBPHS load, EPWM_SIM_SYNC_DELAY TBCLKs after SYNCI
+    //
+    if(s->syncDelay && (--s->syncDelay == 0))
+    {
+        s->ctr = r->TBPHS.bit.TBPHS;
+        if(mode == TB_COUNT_UPDOWN)
+        {
+            s->up = r->TBCTL.bit.PHSDIR;
+        }
+
+        s->phsShift = 0;
+        if(r->HRPCTL.bit.TBPHSHRLOADE)
+        {
+            s->phsShift = (int64_t)simMep(r, r->TBPHS.bit.TBPHSHR);
+            if(s->up)
+            {
+                s->phsShift = -s->phsShift;
+            }
+        }
+        s->syncs++;
+    }
+
+    simImmediate(m);
+
+    //
+    // Events
+    //
+    if(mode == TB_COUNT_UPDOWN)
+    {
+        if(s->ctr == 0)
+        {
+            s->up = 1;
+        }
+        else if(s->ctr >= s->prd)
+        {
+            s->up = 0;
+        }
+    }
+    else
+    {
+        s->up = (mode != TB_COUNT_DOWN);
+    }
+
+    cmpa = s->cmpa >> 16;
+    cmpb = s->cmpb >> 16;
+    ev[SIM_ZRO] = (s->ctr == 0);
+    ev[SIM_PRD] = (s->ctr == s->prd);
+    ev[SIM_CAU] = (s->ctr == cmpa) && s->up;
+    ev[SIM_CAD] = (s->ctr == cmpa) && !s->up;
+    ev[SIM_CBU] = (s->ctr == cmpb) && s->up;
+    ev[SIM_CBD] = (s->ctr == cmpb) && !s->up;
+
+    //
+    // Action qualifier, then the software forces
+    //
+    if(mode == TB_COUNT_UPDOWN)
+    {
+        prio = s->up ? simPrioUp : simPrioDown;
+        n = 5;
+    }
+    else
+    {
+        prio = s->up ? simPrioUpMode : simPrioDownMode;
+        n = 4;
+    }
+
+    for(ch = 0; ch < 2; ch++)
+    {
+        //
+        // A continuous force holds the output; events and one-time
+        // forces under it never reach the pin
+        //
+        force = (s->csf >> (2 * ch)) & 3;
+        if((force == 1) || (force == 2))
+        {
+            simAq(m, ch, force - 1, t);
+            continue;
+        }
+
+        if(mode != TB_FREEZE)
+        {
+            simAction(m, ch, ev, prio, n, t);
+        }
+
+        force = ch ? r->AQSFRC.bit.OTSFB : r->AQSFRC.bit.OTSFA;
+        if(force)
+        {
+            level = simForce(ch ? r->AQSFRC.bit.ACTSFB :
+                             r->AQSFRC.bit.ACTSFA, s->aq[ch]);
+            simAq(m, ch, level, t);
+        }
+    }
+    r->AQSFRC.bit.OTSFA = 0;
+    r->AQSFRC.bit.OTSFB = 0;
+
+    simOutput(m, t);                    // Trip zone changes
+    simSoca(m, ev);
+
+    //
+    // Shadow to active loads
+    //
+    gld = 0;
+    if(r->GLDCTL.bit.GLD)
+    {
+        switch(r->GLDCTL.bit.GLDMODE)
+        {
+            case 1:  gld = ev[SIM_PRD]; break;
+            case 2:  gld = ev[SIM_ZRO] || ev[SIM_PRD]; break;
+            default: gld = ev[SIM_ZRO]; break;
+        }
+
+        if(r->GLDCTL.bit.OSHTMODE)
+        {
+            gld = gld && s->gldArmed;
+        }
+        if(gld)
+        {
+            s->gldArmed = 0;
+            s->globalLoads++;
+        }
+    }
+    simLoad(m, ev[SIM_ZRO], ev[SIM_PRD], gld);
+
+    //
+    // Sync in and out
+    //
+    swf = r->TBCTL.bit.SWFSYNC;
+    r->TBCTL.bit.SWFSYNC = 0;
+    syncIn = s->syncIn || swf;
+    s->syncIn = 0;
+
+    if(syncIn)
+    {
+        r->TBSTS.bit.SYNCI = 1;
+        if(r->TBCTL.bit.PHSEN)
+        {
+            s->syncDelay = EPWM_SIM_SYNC_DELAY;
+        }
+    }
+
+    switch(r->TBCTL.bit.SYNCOSEL)
+    {
+        case 0:  syncOut = syncIn; break;
+        case 1:  syncOut = ev[SIM_ZRO]; break;
+        case 2:  syncOut = ev[SIM_CBU] || ev[SIM_CBD]; break;
+        default: syncOut = 0; break;
+    }
+
+    if(syncOut && r->TBCTL2.bit.OSHTSYNCMODE)
+    {
+        syncOut = s->syncArmed;
+        s->syncArmed = 0;
+    }
+
+    if(syncOut)
+    {
+        for(i = m + 1; i < EPWM_SIM_MODULES; i++)
+        {
+            if(simSyncSrc[i] == m)
+            {
+                epwmSim[i].syncIn = 1;
+            }
+        }
+    }
+
+    //
+    // Next count
+    //
+    switch(mode)
+    {
+        case TB_COUNT_UP:
+            s->ctr = (s->ctr >= s->prd) ? 0 : s->ctr + 1;
+            break;
+
+        case TB_COUNT_DOWN:
+            s->ctr = (s->ctr == 0) ? s->prd : s->ctr - 1;
+            break;
+
+        case TB_COUNT_UPDOWN:
+            if(s->up && (s->ctr >= s->prd))
+            {
+                s->up = 0;
+            }
+            else if(!s->up && (s->ctr == 0))
+            {
+                s->up = 1;
+            }
+            s->ctr = s->up ? s->ctr + 1 : s->ctr - 1;
+            break;
+
+        default:
+            break;
+    }
+
+    r->TBCTR = s->ctr;
+    r->TBSTS.bit.CTRDIR = s->up;
+    s->ctrImage = s->ctr;
+}
+
+//
+// epwmSimReset - Clear the simulator state and the recorded edges. Call
+//                after hostReset() and before the ePWMs are configured.
+//
+void epwmSimReset(void)
+{
+    memset(epwmSim, 0, sizeof(epwmSim));
+    memset(simEdgeCount, 0, sizeof(simEdgeCount));
+    memset(simLevel, 0, sizeof(simLevel));
+    epwmSimTime = 0;
+    epwmSimTripIn = 0;
+}
+
+//
+// epwmSimRun - Advance the ePWMs, and CPU Timer 1 with them, by sysclks
+//
+void epwmSimRun(uint32_t sysclks)
+{
+    uint32_t k;
+    uint16_t m;
+
+    for(k = 0; k < sysclks; k++)
+    {
+        simStrobes();
+
+        if(CpuSysRegs.PCLKCR0.bit.TBCLKSYNC)
+        {
+            for(m = 0; m < EPWM_SIM_MODULES; m++)
+            {
+                if(!epwmSim[m].started)
+                {
+                    simStart(m);
+                }
+
+                if(epwmSim[m].prescale == 0)
+                {
+                    simTick(m, epwmSimTime);
+                    epwmSim[m].prescale = simTbclk(simRegs[m]) /
+                                          EPWM_SIM_SYSCLK_FS;
+                }
+                epwmSim[m].prescale--;
+            }
+        }
+
+        epwmSimTime += EPWM_SIM_SYSCLK_FS;
+    }
+
+    hostTimerAdvance(sysclks);
+}
+
+//
+// epwmSimLevel - Current level of output o
+//
+uint16_t epwmSimLevel(uint16_t out)
+{
+    return(simLevel[out]);
+}
+
+//
+// epwmSimEdges - Edges of output o, oldest first; *count of them. Edges
+//                past EPWM_SIM_MAX_EDGES are not recorded.
+//
+const EPWM_SIM_EDGE *epwmSimEdges(uint16_t out, uint32_t *count)
+{
+    *count = simEdgeCount[out];
+    return(simEdges[out]);
+}
+
+//
+// epwmSimWriteVcd - Write the recorded edges of all outputs to path as a
+//                   value change dump (1 ps resolution). 0 on success.
+//
+int epwmSimWriteVcd(const char *path)
+{
+    static const char lv[] = {'0', '1', 'z'};
+    uint32_t next[EPWM_SIM_OUTPUTS];
+    uint64_t t, last;
+    uint16_t o, first;
+    FILE *f;
+
+    f = fopen(path, "w");
+    if(f == NULL)
+    {
+        return(-1);
+    }
+
+    fprintf(f, "$timescale 1ps $end\n$scope module epwm $end\n");
+    for(o = 0; o < EPWM_SIM_OUTPUTS; o++)
+    {
+        fprintf(f, "$var wire 1 %c EPWM%u%c $end\n", '!' + o, o / 2 + 1,
+                'A' + (o & 1));
+    }
+    fprintf(f, "$upscope $end\n$enddefinitions $end\n#0\n$dumpvars\n");
+    for(o = 0; o < EPWM_SIM_OUTPUTS; o++)
+    {
+        fprintf(f, "0%c\n", '!' + o);
+        next[o] = 0;
+    }
+    fprintf(f, "$end\n");
+
+    first = 1;
+    last = 0;
+    for(;;)
+    {
+        t = UINT64_MAX;
+        for(o = 0; o < EPWM_SIM_OUTPUTS; o++)
+        {
+            if((next[o] < simEdgeCount[o]) && (simEdges[o][next[o]].t < t))
+            {
+                t = simEdges[o][next[o]].t;
+            }
+        }
+        if(t == UINT64_MAX)
+        {
+            break;
+        }
+
+        if(first || (t / 1000 != last))
+        {
+            last = t / 1000;
+            first = 0;
+            fprintf(f, "#%llu\n", (unsigned long long)last);
+        }
+
+        for(o = 0; o < EPWM_SIM_OUTPUTS; o++)
+        {
+            if((next[o] < simEdgeCount[o]) && (simEdges[o][next[o]].t == t))
+            {
+                fprintf(f, "%c%c\n", lv[simEdges[o][next[o]].level],
+                        '!' + o);
+                next[o]++;
+            }
+        }
+    }
+
+    return(fclose(f));
+}
+
+//
+// End of File
+//
@@ -0,0 +1,129 @@
+//###########################################################################
+//
+// FILE:   host_regs.c
+//
+// TITLE:  Register image and device stubs for the host build.
+//
+// hostRegs replaces the peripheral frames the linker places on the target
+// (f28004x_headers_nonbios.cmd). hostReset() clears it and presets the
+// status bits the start-up code polls, as they read after a power-on reset
+// with the PLL, the message RAM init and the CLA done:
+//
+//   - CLKSRCCTL1.OSCCLKSRCSEL = XTAL and XTALCR.SE = 0, so InitSysPll()
+//     finds the oscillator already selected and does not poll X1CNT
+//   - SYSPLLSTS.LOCKS = 1
+//   - MSGxINITDONE = 1, MIRUN = 0 (initCLA())
+//   - CPU Timer 1 TIM = 0xFFFFFFFF, the count right after initTimebase()
+//
+// DCCSTATUS is plain RAM, not write-1-to-clear: the ERR and DONE clears in
+// IsPLLValid() leave both set, so the DCC check fails every retry and
+// InitSysPll() leaves the PLL bypassed (PLLCLKEN = 0) after PLL_RETRIES
+// attempts. The lock sequence itself still runs.
+//
+//###########################################################################
+
+//
+// Included Files
+//
+#include "f28004x_device.h"
+#include "f28004x_examples.h"
+#include "host_regs.h"
+
+//
+// Globals
+//
+volatile struct HOST_REGS hostRegs;
+
+volatile Uint16 IER;
+volatile Uint16 IFR;
+Uint16 hostIntm;
+Uint16 hostDbgm;
+Uint16 hostEallow;
+Uint32 hostEallowCount;
+Uint32 hostEstopCount;
+Uint32 hostDelayUs;
+Uint32 hostDelayLoops;
+Uint16 hostVref[3];                     // SetVREF() mode << 8 | ref, by ADC
+Uint16 hostDeviceCal;                   // # of Device_cal() calls
+Uint16 hostFailures;                    // # of failed HOST_CHECK()s
+
+//
+// hostReset - Power-on state of the register image and the CPU
+//
+void hostReset(void)
+{
+    memset((void *)&hostRegs, 0, sizeof(hostRegs));
+
+    ClkCfgRegs.CLKSRCCTL1.bit.OSCCLKSRCSEL = XTAL_OSC;
+    ClkCfgRegs.XTALCR.bit.SE = 0;
+    ClkCfgRegs.SYSPLLSTS.bit.LOCKS = 1;
+
+    MemCfgRegs.MSGxINITDONE.bit.INITDONE_CLA1TOCPU = 1;
+    MemCfgRegs.MSGxINITDONE.bit.INITDONE_CPUTOCLA1 = 1;
+
+    CpuTimer1Regs.TIM.all = 0xFFFFFFFF;
+
+    IER = 0;
+    IFR = 0;
+    hostIntm = 1;
+    hostDbgm = 1;
+    hostEallow = 0;
+    hostEallowCount = 0;
+    hostEstopCount = 0;
+    hostDelayUs = 0;
+    hostDelayLoops = 0;
+    memset(hostVref, 0, sizeof(hostVref));
+    hostDeviceCal = 0;
+}
+
+//
+// hostTimerAdvance - Let n SYSCLKs pass on the CPU Timer 1 timebase
+//
+void hostTimerAdvance(Uint32 n)
+{
+    CpuTimer1Regs.TIM.all -= n;
+}
+
+//
+// InitPieVectTable - Point every mapped vector at DEFAULT_ISR
+//
+void InitPieVectTable(void)
+{
+    PieVectTable.ADCA1_INT = &DEFAULT_ISR;
+    PieVectTable.TIMER0_INT = &DEFAULT_ISR;
+    PieVectTable.EPWM1_TZ_INT = &DEFAULT_ISR;
+    PieVectTable.EPWM1_INT = &DEFAULT_ISR;
+    PieVectTable.DMA_CH1_INT = &DEFAULT_ISR;
+    PieVectTable.SCIA_RX_INT = &DEFAULT_ISR;
+    PieVectTable.SCIA_TX_INT = &DEFAULT_ISR;
+
+    PieCtrlRegs.PIECTRL.bit.ENPIE = 1;
+}
+
+//
+// SetVREF - Record the reference selection of ADC module
+//
+void SetVREF(int module, int mode, int ref)
+{
+    hostVref[module] = (mode << 8) | ref;
+}
+
+//
+// F28x_usDelay - Record the loop count instead of spinning
+//
+void F28x_usDelay(long LoopCount)
+{
+    hostDelayLoops += LoopCount;
+}
+
+//
+// Device_cal - Boot ROM trim routine
+//
+void Device_cal(void)
+{
+    hostDeviceCal++;
+}
+
+//
+// End of File
+//
@@ -0,0 +1,60 @@
+//###########################################################################
+//
+// FILE:   host_sfo.c
+//
+// TITLE:  SFO library stand-in for the host build (see SFO_V8.h).
+//
+//###########################################################################
+
+//
+// Included Files
+//
+#include "f28004x_device.h"
+#include "SFO_V8.h"
+
+//
+// Globals
+//
+Uint16 hostSfoCalls = 4;
+int hostSfoScaleFactor = 60;
+int hostSfoResult;
+Uint32 hostSfoCount;
+void (*hostSfoHook)(void);              // Called on every SFO(), if set
+
+extern int MEP_ScaleFactor;             // Defined by the application
+
+//
+// SFO - One calibration step; completes every hostSfoCalls calls. The
+//       background loop calls it, so hostSfoHook can run time there.
+//
+int SFO(void)
+{
+    hostSfoCount++;
+
+    if(hostSfoHook != 0)
+    {
+        hostSfoHook();
+    }
+
+    if(hostSfoResult != 0)
+    {
+        return(hostSfoResult);
+    }
+
+    if((hostSfoCount % hostSfoCalls) != 0)
+    {
+        return(SFO_INCOMPLETE);
+    }
+
+    MEP_ScaleFactor = hostSfoScaleFactor;
+
+    EALLOW;
+    EPwm1Regs.HRMSTEP.bit.HRMSTEP = hostSfoScaleFactor;
+    EDIS;
+
+    return(SFO_COMPLETE);
+}
+
+//
+// End of File
+//
@@ -0,0 +1,16 @@
+//###########################################################################
+//
+// FILE:   F28x_Project.h
+//
+// TITLE:  F28x Project Headerfile and Examples Include File (host build)
+//
+//###########################################################################
+
+#ifndef F28X_PROJECT_H
+#define F28X_PROJECT_H
+
+#include "f28004x_cla_typedefs.h"   // f28004x CLA Type definitions
+#include "f28004x_device.h"         // f28004x Headerfile Include File
+#include "f28004x_examples.h"       // f28004x Examples Include File
+
+#endif  // F28X_PROJECT_H
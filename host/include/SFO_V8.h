@@ -0,0 +1,36 @@
+//###########################################################################
+//
+// FILE:   SFO_V8.h
+//
+// TITLE:  SFO library V8 interface (host build)
+//
+// host_sfo.c stands in for SFO_v8_fpu_lib_build_c28.lib: SFO() completes
+// after hostSfoCalls calls with MEP_ScaleFactor = hostSfoScaleFactor and
+// copies it to HRMSTEP, or returns hostSfoResult when that is nonzero.
+//
+//###########################################################################
+
+#ifndef SFO_V8_H
+#define SFO_V8_H
+
+//
+// Defines
+//
+#define SFO_INCOMPLETE          0
+#define SFO_COMPLETE            1
+#define SFO_ERROR               2
+
+//
+// Globals
+//
+extern Uint16 hostSfoCalls;             // SFO() calls per calibration
+extern int hostSfoScaleFactor;          // Result of a completed calibration
+extern int hostSfoResult;               // Forced return value, 0 = none
+extern Uint32 hostSfoCount;             // # of SFO() calls
+
+//
+// Function Prototypes
+//
+int SFO(void);
+
+#endif  // SFO_V8_H
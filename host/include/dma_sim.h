@@ -0,0 +1,48 @@
+//###########################################################################
+//
+// FILE:   dma_sim.h
+//
+// TITLE:  DMA channel model for the host build.
+//
+// Moves data for DMA CH1..6 as configured in DmaRegs, one burst per
+// dmaSimTrigger() call, with the address generator of the device: burst,
+// transfer and wrap steps, shadow to active loads at each transfer start
+// and the channel interrupt at transfer start or end (CHINTMODE). The
+// CH1 interrupt calls PieVectTable.DMA_CH1_INT. See dma_sim.c.
+//
+//   hostReset();
+//   dmaSimReset();
+//   initADCDMA(4);                    // application code, unchanged
+//   startADCDMA();
+//   dmaSimTrigger(1);                 // one ADCA INT1
+//
+//###########################################################################
+
+#ifndef DMA_SIM_H
+#define DMA_SIM_H
+
+//
+// Defines
+//
+#define DMA_SIM_CHANNELS        6
+
+typedef struct
+{
+    uint32_t bursts;            // # of bursts moved
+    uint32_t transfers;         // # of transfers completed
+    uint32_t interrupts;        // # of channel interrupts
+} DMA_SIM_CHANNEL;
+
+//
+// Globals
+//
+extern DMA_SIM_CHANNEL dmaSim[DMA_SIM_CHANNELS];
+
+//
+// Function Prototypes
+//
+void dmaSimReset(void);
+void dmaSimPoll(void);
+void dmaSimTrigger(uint16_t ch);
+
+#endif  // DMA_SIM_H
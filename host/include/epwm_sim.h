@@ -0,0 +1,99 @@
+//###########################################################################
+//
+// FILE:   epwm_sim.h
+//
+// TITLE:  ePWM/HRPWM output simulator for the host build.
+//
+// Runs ePWM1..6 from the register image the application configured, one
+// SYSCLK at a time, and records every edge of the 12 outputs with a
+// femtosecond timestamp. See epwm_sim.c for what is modelled.
+//
+//   hostReset();
+//   epwmSimReset();
+//   configHRPWM(500);                 // application code, unchanged
+//   epwmSimRun(2000);                 // 2000 SYSCLKs
+//   epwmSimEdges(EPWM_SIM_OUT(1, 'A'), &n);
+//   epwmSimWriteVcd("epwm.vcd");
+//
+//###########################################################################
+
+#ifndef EPWM_SIM_H
+#define EPWM_SIM_H
+
+//
+// Defines
+//
+#define EPWM_SIM_MODULES        6
+#define EPWM_SIM_OUTPUTS        (2 * EPWM_SIM_MODULES)
+#define EPWM_SIM_MAX_EDGES      8192            // Per output
+#define EPWM_SIM_SYSCLK_FS      10000000ULL     // 100 MHz
+#define EPWM_SIM_SYNC_DELAY     2               // TBCLKs, SYNCO to TBPHS load
+#define EPWM_SIM_Z              2               // Level of a tri-stated pin
+
+//
+// EPWM_SIM_OUT - Output index of ePWM<module><'A'|'B'>
+//
+#define EPWM_SIM_OUT(module, ab)    (2 * ((module) - 1) + ((ab) == 'B'))
+
+typedef struct
+{
+    uint64_t t;                 // fs since epwmSimReset()
+    uint16_t level;             // 0, 1 or EPWM_SIM_Z
+} EPWM_SIM_EDGE;
+
+//
+// Dead-band delay path (RED or FED)
+//
+typedef struct
+{
+    uint16_t in;                // Input level
+    uint16_t out;               // Delayed level, before POLSEL
+    uint16_t pending;           // 1 = delayed edge at t
+    uint64_t t;
+} EPWM_SIM_DB_PATH;
+
+typedef struct
+{
+    uint16_t started;           // Clock has run since epwmSimReset()
+    uint16_t prescale;          // SYSCLKs left to the next TBCLK
+    uint16_t ctr;               // TBCTR of the current TBCLK
+    uint16_t ctrImage;          // TBCTR last written back to the image
+    uint16_t up;                // 1 = counting up
+    uint16_t prd;               // Active TBPRD
+    uint32_t cmpa;              // Active CMPA:CMPAHR
+    uint32_t cmpb;              // Active CMPB:CMPBHR
+    uint16_t csf;               // Active AQCSFRC
+    int64_t phsShift;           // HR_PHS edge shift (fs), from the last sync
+    uint16_t syncIn;            // SYNCI seen since the last TBCLK
+    uint16_t syncDelay;         // TBCLKs to a pending TBPHS load, 0 = none
+    uint16_t syncArmed;         // One-shot sync armed by OSHTSYNC
+    uint16_t gldArmed;          // One-shot global load armed by OSHTLD
+    uint16_t socCount;          // SOCA events since the last SOCA
+    uint16_t aq[2];             // Action qualifier outputs A, B
+    EPWM_SIM_DB_PATH red;       // Rising-edge delay path
+    EPWM_SIM_DB_PATH fed;       // Falling-edge delay path
+    uint16_t raw[2];            // Outputs A, B before the trip zone
+    uint32_t syncs;             // # of TBPHS loads
+    uint32_t globalLoads;       // # of global load events taken
+    uint32_t socs;              // # of SOCA pulses
+} EPWM_SIM_MODULE;
+
+//
+// Globals
+//
+extern EPWM_SIM_MODULE epwmSim[EPWM_SIM_MODULES];
+extern uint64_t epwmSimTime;            // fs since epwmSimReset()
+extern uint16_t epwmSimMepSf;           // Silicon MEP steps per TBCLK
+extern void (*epwmSimSocaHook)(uint16_t module);
+extern uint16_t epwmSimTripIn;          // TRIPINn level in bit n - 1
+
+//
+// Function Prototypes
+//
+void epwmSimReset(void);
+void epwmSimRun(uint32_t sysclks);
+uint16_t epwmSimLevel(uint16_t out);
+const EPWM_SIM_EDGE *epwmSimEdges(uint16_t out, uint32_t *count);
+int epwmSimWriteVcd(const char *path);
+
+#endif  // EPWM_SIM_H
@@ -0,0 +1,25 @@
+//###########################################################################
+//
+// FILE:   f28004x_cla_typedefs.h
+//
+// TITLE:  f28004x CLA Type Definitions (host build)
+//
+// The CLA float min/max intrinsics, as plain C, so cla_control.cla builds
+// and runs on the host as a C file.
+//
+//###########################################################################
+
+#ifndef F28004X_CLA_TYPEDEFS_H
+#define F28004X_CLA_TYPEDEFS_H
+
+static inline float __mmaxf32(float a, float b)
+{
+    return((a > b) ? a : b);
+}
+
+static inline float __mminf32(float a, float b)
+{
+    return((a < b) ? a : b);
+}
+
+#endif  // F28004X_CLA_TYPEDEFS_H
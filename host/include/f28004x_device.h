@@ -0,0 +1,111 @@
+//###########################################################################
+//
+// FILE:   f28004x_device.h
+//
+// TITLE:  Host stand-in for the f28004x device header.
+//
+// Lets the application headers and the TI support sources compile and run
+// natively (see host/CMakeLists.txt). Every peripheral register block the
+// compiled sources touch lives in hostRegs (host_regs.c), plain RAM laid
+// out like the device: register N words into a block is N uint16_t into
+// the struct, so word offset arithmetic in the TI sources (the GPIO
+// register walks, the interleaved PIEIERx/PIEIFRx, ADCRESULTx and
+// ADCSOCxCTL indexing) lands on the same register as on the target.
+// Blocks and fields the compiled sources never use are left out.
+//
+// Nothing behind a register moves on its own: a bit the code polls only
+// changes if a test writes it. host_regs.c presets the few the start-up
+// code waits on.
+//
+// The intrinsics, the EALLOW/EDIS/EINT/DINT/ESTOP0 macros and DELAY_US()
+// (f28004x_examples.h) are stubs that record what they were asked to do in
+// host* variables for the tests.
+//
+//###########################################################################
+
+#ifndef F28004X_DEVICE_H
+#define F28004X_DEVICE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+//
+// Types
+//
+typedef int16_t     int16;
+typedef int32_t     int32;
+typedef int64_t     int64;
+typedef uint16_t    Uint16;
+typedef uint32_t    Uint32;
+typedef uint64_t    Uint64;
+typedef float       float32;
+typedef double      float64;
+
+//
+// Compiler keywords, pragmas and inline assembly
+//
+#define __interrupt
+#define interrupt
+#define __cregister
+#define asm(x)                  ((void)0)
+#define __asm(x)                ((void)0)
+
+//
+// CPU state the stubs below keep
+//
+extern volatile Uint16 IER;
+extern volatile Uint16 IFR;
+extern Uint16 hostIntm;                 // 1 = INTM set (DINT)
+extern Uint16 hostDbgm;                 // 1 = DBGM set
+extern Uint16 hostEallow;               // 1 = inside EALLOW .. EDIS
+extern Uint32 hostEallowCount;          // # of EALLOWs
+extern Uint32 hostEstopCount;           // # of ESTOP0s
+extern Uint32 hostDelayUs;              // Sum of all DELAY_US() requests
+extern Uint32 hostDelayLoops;           // Sum of all F28x_usDelay() counts
+
+#define EINT                    (hostIntm = 0)
+#define DINT                    (hostIntm = 1)
+#define ERTM                    (hostDbgm = 0)
+#define DRTM                    (hostDbgm = 1)
+#define EALLOW                  (hostEallow = 1, hostEallowCount++)
+#define EDIS                    (hostEallow = 0)
+#define ESTOP0                  (hostEstopCount++)
+
+static inline Uint16 __disable_interrupts(void)
+{
+    Uint16 intm = hostIntm;
+
+    hostIntm = 1;
+    return(intm);
+}
+
+static inline void __restore_interrupts(Uint16 intm)
+{
+    hostIntm = intm;
+}
+
+//
+// Interrupt masks
+//
+#define M_INT1                  0x0001
+#define M_INT2                  0x0002
+#define M_INT3                  0x0004
+#define M_INT4                  0x0008
+#define M_INT5                  0x0010
+#define M_INT6                  0x0020
+#define M_INT7                  0x0040
+#define M_INT8                  0x0080
+#define M_INT9                  0x0100
+#define M_INT10                 0x0200
+#define M_INT11                 0x0400
+#define M_INT12                 0x0800
+#define M_INT13                 0x1000
+#define M_INT14                 0x2000
+#define M_DLOG                  0x4000
+#define M_RTOS                  0x8000
+
+#include "f28004x_host_regs.h"
+
+#endif  // F28004X_DEVICE_H
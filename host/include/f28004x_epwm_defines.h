@@ -0,0 +1,103 @@
+//###########################################################################
+//
+// FILE:   f28004x_epwm_defines.h
+//
+// TITLE:  f28004x Device EPWM Register Field Values (host build)
+//
+//###########################################################################
+
+#ifndef F28004X_EPWM_DEFINES_H
+#define F28004X_EPWM_DEFINES_H
+
+//
+// TBCTL (Time-Base Control)
+//
+// CTRMODE bits
+#define TB_COUNT_UP             0x0
+#define TB_COUNT_DOWN           0x1
+#define TB_COUNT_UPDOWN         0x2
+#define TB_FREEZE               0x3
+// PHSEN bit
+#define TB_DISABLE              0x0
+#define TB_ENABLE               0x1
+// PRDLD bit
+#define TB_SHADOW               0x0
+#define TB_IMMEDIATE            0x1
+// SYNCOSEL bits
+#define TB_SYNC_IN              0x0
+#define TB_CTR_ZERO             0x1
+#define TB_CTR_CMPB             0x2
+#define TB_SYNC_DISABLE         0x3
+// HSPCLKDIV and CLKDIV bits
+#define TB_DIV1                 0x0
+#define TB_DIV2                 0x1
+#define TB_DIV4                 0x2
+// PHSDIR bit
+#define TB_DOWN                 0x0
+#define TB_UP                   0x1
+
+//
+// CMPCTL (Compare Control)
+//
+// LOADAMODE and LOADBMODE bits
+#define CC_CTR_ZERO             0x0
+#define CC_CTR_PRD              0x1
+#define CC_CTR_ZERO_PRD         0x2
+#define CC_LD_DISABLE           0x3
+// SHDWAMODE and SHDWBMODE bits
+#define CC_SHADOW               0x0
+#define CC_IMMEDIATE            0x1
+
+//
+// AQCTLA and AQCTLB (Action Qualifier Control)
+//
+#define AQ_NO_ACTION            0x0
+#define AQ_CLEAR                0x1
+#define AQ_SET                  0x2
+#define AQ_TOGGLE               0x3
+
+//
+// DBCTL (Dead-Band Control)
+//
+// OUT MODE bits
+#define DB_DISABLE              0x0
+#define DBB_ENABLE              0x1
+#define DBA_ENABLE              0x2
+#define DB_FULL_ENABLE          0x3
+// POLSEL bits
+#define DB_ACTV_HI              0x0
+#define DB_ACTV_LOC             0x1
+#define DB_ACTV_HIC             0x2
+#define DB_ACTV_LO              0x3
+// IN MODE
+#define DBA_ALL                 0x0
+#define DBB_RED_DBA_FED         0x1
+#define DBA_RED_DBB_FED         0x2
+#define DBB_ALL                 0x3
+
+//
+// TZCTL (Trip Zone Control)
+//
+// TZA and TZB bits
+#define TZ_HIZ                  0x0
+#define TZ_FORCE_HI             0x1
+#define TZ_FORCE_LO             0x2
+#define TZ_NO_CHANGE            0x3
+
+//
+// HRCNFG (High Resolution Configuration)
+//
+// EDGMODE bits
+#define HR_DISABLE              0x0
+#define HR_REP                  0x1
+#define HR_FEP                  0x2
+#define HR_BEP                  0x3
+// CTLMODE bit
+#define HR_CMP                  0x0
+#define HR_PHS                  0x1
+// HRLOAD bits
+#define HR_CTR_ZERO             0x0
+#define HR_CTR_PRD              0x1
+#define HR_CTR_ZERO_PRD         0x2
+
+#endif  // F28004X_EPWM_DEFINES_H
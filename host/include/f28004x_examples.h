@@ -0,0 +1,172 @@
+//###########################################################################
+//
+// FILE:   f28004x_examples.h
+//
+// TITLE:  Host stand-in for the f28004x examples header.
+//
+// Constants, globals and prototypes of the TI support sources the host
+// build compiles (f28004x_sysctrl.c, f28004x_gpio.c, f28004x_piectrl.c,
+// f28004x_defaultisr.c). DELAY_US() does not wait: it adds the request to
+// hostDelayUs.
+//
+//###########################################################################
+
+#ifndef F28004X_EXAMPLES_H
+#define F28004X_EXAMPLES_H
+
+#include "f28004x_epwm_defines.h"
+
+//
+// Clock
+//
+#define CPU_FRQ_100MHZ          1
+#define CPU_RATE                10.00L  // for a 100MHz CPU clock speed
+
+#define INT_OSC2                0
+#define XTAL_OSC                1
+#define INT_OSC1                2
+#define XTAL_OSC_SE             5
+
+#define IMULT_10                10
+#define FMULT_0                 0
+#define FMULT_0pt25             1
+#define FMULT_0pt5              2
+#define FMULT_0pt75             3
+
+#define PLLCLK_BY_1             0
+#define PLLCLK_BY_2             1
+#define PLLCLK_BY_126           63
+
+#define LPM_IDLE                0
+#define LPM_HALT                2
+
+//
+// DELAY_US - Records the request instead of waiting
+//
+#define DELAY_US(A)             (hostDelayUs += (Uint32)(A))
+
+//
+// ADC
+//
+#define ADC_ADCA                0
+#define ADC_ADCB                1
+#define ADC_ADCC                2
+#define ADC_INTERNAL            0
+#define ADC_EXTERNAL            1
+#define ADC_VREF3P3             0
+#define ADC_VREF2P5             1
+
+//
+// PIE acknowledge
+//
+#define PIEACK_GROUP1           0x0001
+#define PIEACK_GROUP2           0x0002
+#define PIEACK_GROUP3           0x0004
+#define PIEACK_GROUP4           0x0008
+#define PIEACK_GROUP5           0x0010
+#define PIEACK_GROUP6           0x0020
+#define PIEACK_GROUP7           0x0040
+#define PIEACK_GROUP8           0x0080
+#define PIEACK_GROUP9           0x0100
+#define PIEACK_GROUP10          0x0200
+#define PIEACK_GROUP11          0x0400
+#define PIEACK_GROUP12          0x0800
+
+//
+// GPIO. Offsets are in Uint32 steps from a port's first register.
+//
+#define GPIO_MUX_CPU1           0x0
+#define GPIO_MUX_CPU1CLA        0x1
+
+#define GPIO_INPUT              0
+#define GPIO_OUTPUT             1
+
+#define GPIO_PUSHPULL           0
+#define GPIO_PULLUP             (1 << 0)
+#define GPIO_INVERT             (1 << 1)
+#define GPIO_OPENDRAIN          (1 << 2)
+
+#define GPIO_SYNC               (0x0 << 4)
+#define GPIO_QUAL3              (0x1 << 4)
+#define GPIO_QUAL6              (0x2 << 4)
+#define GPIO_ASYNC              (0x3 << 4)
+
+#define GPIO_UNLOCK             0
+#define GPIO_LOCK               1
+
+#define GPY_CTRL_OFFSET         (0x40/2)
+#define GPY_DATA_OFFSET         (0x8/2)
+
+#define GPYQSEL                 (0x2/2)
+#define GPYMUX                  (0x6/2)
+#define GPYDIR                  (0xA/2)
+#define GPYPUD                  (0xC/2)
+#define GPYINV                  (0x10/2)
+#define GPYODR                  (0x12/2)
+#define GPYGMUX                 (0x20/2)
+#define GPYCSEL                 (0x28/2)
+#define GPYLOCK                 (0x3C/2)
+
+#define GPYDAT                  0
+#define GPYSET                  1
+#define GPYCLEAR                2
+#define GPYTOGGLE               3
+
+//
+// Globals
+//
+extern struct CPUTIMER_VARS CpuTimer0;
+extern struct CPUTIMER_VARS CpuTimer1;
+extern struct CPUTIMER_VARS CpuTimer2;
+
+//
+// Prototypes - f28004x_sysctrl.c
+//
+extern void InitSysCtrl(void);
+extern void InitPeripheralClocks(void);
+extern void DisablePeripheralClocks(void);
+extern void InitFlash(void);
+extern void FlashOff(void);
+extern void ServiceDog(void);
+extern void DisableDog(void);
+extern void InitSysPll(Uint16 clock_source, Uint16 imult, Uint16 fmult,
+                       Uint16 divsel);
+extern bool IsPLLValid(Uint16 oscSource, Uint16 imult, Uint16 fmult);
+extern Uint16 CsmUnlock(void);
+extern void SysIntOsc1Sel(void);
+extern void SysIntOsc2Sel(void);
+extern void SysXtalOscSel(void);
+extern void SysXtalOscSESel(void);
+extern void IDLE(void);
+extern void HALT(void);
+
+//
+// Prototypes - f28004x_gpio.c
+//
+extern void InitGpio(void);
+extern void GPIO_SetupPinMux(Uint16 gpioNumber, Uint16 cpu,
+                             Uint16 muxPosition);
+extern void GPIO_SetupPinOptions(Uint16 gpioNumber, Uint16 output,
+                                 Uint16 flags);
+extern void GPIO_SetupLock(Uint16 gpioNumber, Uint16 flags);
+extern Uint16 GPIO_ReadPin(Uint16 gpioNumber);
+extern void GPIO_WritePin(Uint16 gpioNumber, Uint16 outVal);
+
+//
+// Prototypes - f28004x_piectrl.c, f28004x_defaultisr.c
+//
+extern void InitPieCtrl(void);
+extern void EnableInterrupts(void);
+extern interrupt void DEFAULT_ISR(void);
+extern interrupt void EMPTY_ISR(void);
+
+//
+// Prototypes - host_regs.c (f28004x_pievect.c, f28004x_adc.c,
+// f28004x_usdelay.asm and the boot ROM on the target)
+//
+extern void InitPieVectTable(void);
+extern void SetVREF(int module, int mode, int ref);
+extern void F28x_usDelay(long LoopCount);
+extern void Device_cal(void);
+
+#endif  // F28004X_EXAMPLES_H
@@ -0,0 +1,2062 @@
+//###########################################################################
+//
+// FILE:   f28004x_host_regs.h
+//
+// TITLE:  Register layouts for the host build.
+//
+// Field order and widths follow the f28004x bitfield headers. Word
+// offsets are given where code depends on them; elsewhere only the order
+// matters. 32-bit registers sit at even word offsets, as on the device.
+//
+//###########################################################################
+
+#ifndef F28004X_HOST_REGS_H
+#define F28004X_HOST_REGS_H
+
+//
+// ePWM
+//
+struct TBCTL_BITS {                     // bits description
+    Uint16 CTRMODE:2;                   // 1:0 Counter Mode
+    Uint16 PHSEN:1;                     // 2 Phase Load Enable
+    Uint16 PRDLD:1;                     // 3 Active Period Load
+    Uint16 SYNCOSEL:2;                  // 5:4 Sync Output Select
+    Uint16 SWFSYNC:1;                   // 6 Software Force Sync Pulse
+    Uint16 HSPCLKDIV:3;                 // 9:7 High Speed TBCLK Pre-scaler
+    Uint16 CLKDIV:3;                    // 12:10 Time Base Clock Pre-scaler
+    Uint16 PHSDIR:1;                    // 13 Phase Direction Bit
+    Uint16 FREE_SOFT:2;                 // 15:14 Emulation Mode Bits
+};
+
+union TBCTL_REG {
+    Uint16 all;
+    struct TBCTL_BITS bit;
+};
+
+struct TBCTL2_BITS {                    // bits description
+    Uint16 rsvd1:6;                     // 5:0 Reserved
+    Uint16 OSHTSYNCMODE:1;              // 6 Oneshot sync mode
+    Uint16 OSHTSYNC:1;                  // 7 Oneshot sync bit
+    Uint16 rsvd2:4;                     // 11:8 Reserved
+    Uint16 SYNCOSELX:2;                 // 13:12 Syncout selection
+    Uint16 PRDLDSYNC:2;                 // 15:14 PRD Shadow to Active Load
+};
+
+union TBCTL2_REG {
+    Uint16 all;
+    struct TBCTL2_BITS bit;
+};
+
+struct TBSTS_BITS {                     // bits description
+    Uint16 CTRDIR:1;                    // 0 Time Base Counter Direction
+    Uint16 SYNCI:1;                     // 1 External Input Sync Status
+    Uint16 CTRMAX:1;                    // 2 Counter Max Latched Status
+    Uint16 rsvd1:13;                    // 15:3 Reserved
+};
+
+union TBSTS_REG {
+    Uint16 all;
+    struct TBSTS_BITS bit;
+};
+
+struct CMPCTL_BITS {                    // bits description
+    Uint16 LOADAMODE:2;                 // 1:0 Active Compare A Load
+    Uint16 LOADBMODE:2;                 // 3:2 Active Compare B Load
+    Uint16 SHDWAMODE:1;                 // 4 Compare A Register Block Operating
+    Uint16 rsvd1:1;                     // 5 Reserved
+    Uint16 SHDWBMODE:1;                 // 6 Compare B Register Block Operating
+    Uint16 rsvd2:1;                     // 7 Reserved
+    Uint16 SHDWAFULL:1;                 // 8 Compare A Shadow Register Full
+    Uint16 SHDWBFULL:1;                 // 9 Compare B Shadow Register Full
+    Uint16 LOADASYNC:2;                 // 11:10 Active Compare A Load on SYNC
+    Uint16 LOADBSYNC:2;                 // 13:12 Active Compare B Load on SYNC
+    Uint16 rsvd3:2;                     // 15:14 Reserved
+};
+
+union CMPCTL_REG {
+    Uint16 all;
+    struct CMPCTL_BITS bit;
+};
+
+struct DBCTL_BITS {                     // bits description
+    Uint16 OUT_MODE:2;                  // 1:0 Dead Band Output Mode Control
+    Uint16 POLSEL:2;                    // 3:2 Polarity Select Control
+    Uint16 IN_MODE:2;                   // 5:4 Dead Band Input Select Mode
+    Uint16 LOADREDMODE:2;               // 7:6 Active DBRED Load Mode
+    Uint16 LOADFEDMODE:2;               // 9:8 Active DBFED Load Mode
+    Uint16 SHDWDBREDMODE:1;             // 10 DBRED Block Operating Mode
+    Uint16 SHDWDBFEDMODE:1;             // 11 DBFED Block Operating Mode
+    Uint16 OUTSWAP:2;                   // 13:12 Dead Band Output Swap Control
+    Uint16 DEDB_MODE:1;                 // 14 Dead Band Dual-Edge B Mode
+    Uint16 HALFCYCLE:1;                 // 15 Half Cycle Clocking Enable
+};
+
+union DBCTL_REG {
+    Uint16 all;
+    struct DBCTL_BITS bit;
+};
+
+struct HRCNFG_BITS {                    // bits description
+    Uint16 EDGMODE:2;                   // 1:0 ePWMxA Edge Mode Select Bits
+    Uint16 CTLMODE:1;                   // 2 ePWMxA Control Mode Select Bits
+    Uint16 HRLOAD:2;                    // 4:3 ePWMxA Shadow Mode Select Bits
+    Uint16 SELOUTB:1;                   // 5 EPWMB Output Selection Bit
+    Uint16 AUTOCONV:1;                  // 6 Autoconversion Bit
+    Uint16 SWAPAB:1;                    // 7 Swap EPWMA and EPWMB Outputs Bit
+    Uint16 EDGMODEB:2;                  // 9:8 ePWMxB Edge Mode Select Bits
+    Uint16 CTLMODEB:1;                  // 10 ePWMxB Control Mode Select Bits
+    Uint16 HRLOADB:2;                   // 12:11 ePWMxB Shadow Mode Select Bits
+    Uint16 rsvd1:3;                     // 15:13 Reserved
+};
+
+union HRCNFG_REG {
+    Uint16 all;
+    struct HRCNFG_BITS bit;
+};
+
+struct HRMSTEP_BITS {                   // bits description
+    Uint16 HRMSTEP:8;                   // 7:0 High Resolution Micro Step Value
+    Uint16 rsvd1:8;                     // 15:8 Reserved
+};
+
+union HRMSTEP_REG {
+    Uint16 all;
+    struct HRMSTEP_BITS bit;
+};
+
+struct HRPCTL_BITS {                    // bits description
+    Uint16 HRPE:1;                      // 0 High Resolution Period Enable
+    Uint16 PWMSYNCSEL:1;                // 1 PWMSYNC Source Select Bit
+    Uint16 TBPHSHRLOADE:1;              // 2 TBPHSHR Load Enable
+    Uint16 rsvd1:1;                     // 3 Reserved
+    Uint16 PWMSYNCSELX:3;               // 6:4 PWMSYNCX Source Select Bit
+    Uint16 rsvd2:9;                     // 15:7 Reserved
+};
+
+union HRPCTL_REG {
+    Uint16 all;
+    struct HRPCTL_BITS bit;
+};
+
+struct TRREM_BITS {                     // bits description
+    Uint16 TRREM:11;                    // 10:0 Translator Remainder Bits
+    Uint16 rsvd1:5;                     // 15:11 Reserved
+};
+
+union TRREM_REG {
+    Uint16 all;
+    struct TRREM_BITS bit;
+};
+
+struct GLDCTL_BITS {                    // bits description
+    Uint16 GLD:1;                       // 0 Global Shadow to Active load event
+    Uint16 GLDMODE:4;                   // 4:1 Shadow to Active Global Load
+    Uint16 OSHTMODE:1;                  // 5 One Shot Load mode control bit
+    Uint16 rsvd1:1;                     // 6 Reserved
+    Uint16 GLDPRD:3;                    // 9:7 Global Load Strobe Period
+    Uint16 GLDCNT:3;                    // 12:10 Global Load Strobe Counter
+    Uint16 rsvd2:3;                     // 15:13 Reserved
+};
+
+union GLDCTL_REG {
+    Uint16 all;
+    struct GLDCTL_BITS bit;
+};
+
+struct GLDCFG_BITS {                    // bits description
+    Uint16 TBPRD_TBPRDHR:1;             // 0 Global load event configuration
+    Uint16 CMPA_CMPAHR:1;               // 1 Global load event configuration
+    Uint16 CMPB_CMPBHR:1;               // 2 Global load event configuration
+    Uint16 CMPC:1;                      // 3 Global load event configuration
+    Uint16 CMPD:1;                      // 4 Global load event configuration
+    Uint16 DBRED_DBREDHR:1;             // 5 Global load event configuration
+    Uint16 DBFED_DBFEDHR:1;             // 6 Global load event configuration
+    Uint16 DBCTL:1;                     // 7 Global load event configuration
+    Uint16 AQCTLA_AQCTLA2:1;            // 8 Global load event configuration
+    Uint16 AQCTLB_AQCTLB2:1;            // 9 Global load event configuration
+    Uint16 AQCSFRC:1;                   // 10 Global load event configuration
+    Uint16 rsvd1:5;                     // 15:11 Reserved
+};
+
+union GLDCFG_REG {
+    Uint16 all;
+    struct GLDCFG_BITS bit;
+};
+
+struct EPWMXLINK_BITS {                 // bits description
+    Uint32 TBPRDLINK:4;                 // 3:0 TBPRD:TBPRDHR Link
+    Uint32 CMPALINK:4;                  // 7:4 CMPA:CMPAHR Link
+    Uint32 CMPBLINK:4;                  // 11:8 CMPB:CMPBHR Link
+    Uint32 CMPCLINK:4;                  // 15:12 CMPC Link
+    Uint32 CMPDLINK:4;                  // 19:16 CMPD Link
+    Uint32 rsvd1:8;                     // 27:20 Reserved
+    Uint32 GLDCTL2LINK:4;               // 31:28 GLDCTL2 Link
+};
+
+union EPWMXLINK_REG {
+    Uint32 all;
+    struct EPWMXLINK_BITS bit;
+};
+
+struct AQCTLA_BITS {                    // bits description
+    Uint16 ZRO:2;                       // 1:0 Action Counter = Zero
+    Uint16 PRD:2;                       // 3:2 Action Counter = Period
+    Uint16 CAU:2;                       // 5:4 Action Counter = Compare A Up
+    Uint16 CAD:2;                       // 7:6 Action Counter = Compare A Down
+    Uint16 CBU:2;                       // 9:8 Action Counter = Compare B Up
+    Uint16 CBD:2;                       // 11:10 Action Counter = Compare B Down
+    Uint16 rsvd1:4;                     // 15:12 Reserved
+};
+
+union AQCTLA_REG {
+    Uint16 all;
+    struct AQCTLA_BITS bit;
+};
+
+union AQCTLB_REG {
+    Uint16 all;
+    struct AQCTLA_BITS bit;
+};
+
+struct AQSFRC_BITS {                    // bits description
+    Uint16 ACTSFA:2;                    // 1:0 Action when One-time SW Force A
+    Uint16 OTSFA:1;                     // 2 One-time SW Force A Output
+    Uint16 ACTSFB:2;                    // 4:3 Action when One-time SW Force B
+    Uint16 OTSFB:1;                     // 5 One-time SW Force A Output
+    Uint16 RLDCSF:2;                    // 7:6 Reload from Shadow Options
+    Uint16 rsvd1:8;                     // 15:8 Reserved
+};
+
+union AQSFRC_REG {
+    Uint16 all;
+    struct AQSFRC_BITS bit;
+};
+
+struct AQCSFRC_BITS {                   // bits description
+    Uint16 CSFA:2;                      // 1:0 Continuous Software Force on A
+    Uint16 CSFB:2;                      // 3:2 Continuous Software Force on B
+    Uint16 rsvd1:12;                    // 15:4 Reserved
+};
+
+union AQCSFRC_REG {
+    Uint16 all;
+    struct AQCSFRC_BITS bit;
+};
+
+struct TBPHS_BITS {                     // bits description
+    Uint16 TBPHSHR:16;                  // 15:0 Extension Register for HRPWM
+    Uint16 TBPHS:16;                    // 31:16 Phase Offset Register
+};
+
+union TBPHS_REG {
+    Uint32 all;
+    struct TBPHS_BITS bit;
+};
+
+struct CMPA_BITS {                      // bits description
+    Uint16 CMPAHR:16;                   // 15:0 Compare A HRPWM Extension
+    Uint16 CMPA:16;                     // 31:16 Compare A Register
+};
+
+union CMPA_REG {
+    Uint32 all;
+    struct CMPA_BITS bit;
+};
+
+struct CMPB_BITS {                      // bits description
+    Uint16 CMPBHR:16;                   // 15:0 Compare B High Resolution Bits
+    Uint16 CMPB:16;                     // 31:16 Compare B Register
+};
+
+union CMPB_REG {
+    Uint32 all;
+    struct CMPB_BITS bit;
+};
+
+struct GLDCTL2_BITS {                   // bits description
+    Uint16 OSHTLD:1;                    // 0 Enable reload event in one shot
+    Uint16 GFRCLD:1;                    // 1 Force reload event in one shot
+    Uint16 rsvd1:14;                    // 15:2 Reserved
+};
+
+union GLDCTL2_REG {
+    Uint16 all;
+    struct GLDCTL2_BITS bit;
+};
+
+struct TZSEL_BITS {                     // bits description
+    Uint16 CBC1:1;                      // 0 TZ1 CBC select
+    Uint16 CBC2:1;                      // 1 TZ2 CBC select
+    Uint16 CBC3:1;                      // 2 TZ3 CBC select
+    Uint16 CBC4:1;                      // 3 TZ4 CBC select
+    Uint16 CBC5:1;                      // 4 TZ5 CBC select
+    Uint16 CBC6:1;                      // 5 TZ6 CBC select
+    Uint16 DCAEVT2:1;                   // 6 DCAEVT2 CBC select
+    Uint16 DCBEVT2:1;                   // 7 DCBEVT2 CBC select
+    Uint16 OSHT1:1;                     // 8 One-shot TZ1 select
+    Uint16 OSHT2:1;                     // 9 One-shot TZ2 select
+    Uint16 OSHT3:1;                     // 10 One-shot TZ3 select
+    Uint16 OSHT4:1;                     // 11 One-shot TZ4 select
+    Uint16 OSHT5:1;                     // 12 One-shot TZ5 select
+    Uint16 OSHT6:1;                     // 13 One-shot TZ6 select
+    Uint16 DCAEVT1:1;                   // 14 One-shot DCAEVT1 select
+    Uint16 DCBEVT1:1;                   // 15 One-shot DCBEVT1 select
+};
+
+union TZSEL_REG {
+    Uint16 all;
+    struct TZSEL_BITS bit;
+};
+
+struct TZCTL_BITS {                     // bits description
+    Uint16 TZA:2;                       // 1:0 TZ1 to TZ6 Trip Action On EPWMxA
+    Uint16 TZB:2;                       // 3:2 TZ1 to TZ6 Trip Action On EPWMxB
+    Uint16 DCAEVT1:2;                   // 5:4 EPWMxA action on DCAEVT1
+    Uint16 DCAEVT2:2;                   // 7:6 EPWMxA action on DCAEVT2
+    Uint16 DCBEVT1:2;                   // 9:8 EPWMxB action on DCBEVT1
+    Uint16 DCBEVT2:2;                   // 11:10 EPWMxB action on DCBEVT2
+    Uint16 rsvd1:4;                     // 15:12 Reserved
+};
+
+union TZCTL_REG {
+    Uint16 all;
+    struct TZCTL_BITS bit;
+};
+
+struct TZFLG_BITS {                     // bits description
+    Uint16 INT:1;                       // 0 Global Int Status Flag
+    Uint16 CBC:1;                       // 1 Trip Zones Cycle By Cycle Flag
+    Uint16 OST:1;                       // 2 Trip Zones One Shot Flag
+    Uint16 DCAEVT1:1;                   // 3 Digital Compare Output A Event 1
+    Uint16 DCAEVT2:1;                   // 4 Digital Compare Output A Event 2
+    Uint16 DCBEVT1:1;                   // 5 Digital Compare Output B Event 1
+    Uint16 DCBEVT2:1;                   // 6 Digital Compare Output B Event 2
+    Uint16 rsvd1:9;                     // 15:7 Reserved
+};
+
+union TZFLG_REG {
+    Uint16 all;
+    struct TZFLG_BITS bit;
+};
+
+struct TZDCSEL_BITS {                   // bits description
+    Uint16 DCAEVT1:3;                   // 2:0 Digital Compare Output A Event 1
+    Uint16 DCAEVT2:3;                   // 5:3 Digital Compare Output A Event 2
+    Uint16 DCBEVT1:3;                   // 8:6 Digital Compare Output B Event 1
+    Uint16 DCBEVT2:3;                   // 11:9 Digital Compare Output B Event 2
+    Uint16 rsvd1:4;                     // 15:12 Reserved
+};
+
+union TZDCSEL_REG {
+    Uint16 all;
+    struct TZDCSEL_BITS bit;
+};
+
+struct ETSEL_BITS {                     // bits description
+    Uint16 INTSEL:3;                    // 2:0 EPWMxINTn Select
+    Uint16 INTEN:1;                     // 3 EPWMxINTn Enable
+    Uint16 SOCASELCMP:1;                // 4 EPWMxSOCA Compare Select
+    Uint16 SOCBSELCMP:1;                // 5 EPWMxSOCB Compare Select
+    Uint16 INTSELCMP:1;                 // 6 EPWMxINT Compare Select
+    Uint16 rsvd1:1;                     // 7 Reserved
+    Uint16 SOCASEL:3;                   // 10:8 Start of Conversion A Select
+    Uint16 SOCAEN:1;                    // 11 Start of Conversion A Enable
+    Uint16 SOCBSEL:3;                   // 14:12 Start of Conversion B Select
+    Uint16 SOCBEN:1;                    // 15 Start of Conversion B Enable
+};
+
+union ETSEL_REG {
+    Uint16 all;
+    struct ETSEL_BITS bit;
+};
+
+struct ETPS_BITS {                      // bits description
+    Uint16 INTPRD:2;                    // 1:0 EPWMxINTn Period Select
+    Uint16 INTCNT:2;                    // 3:2 EPWMxINTn Counter Register
+    Uint16 INTPSSEL:1;                  // 4 EPWMxINTn Pre-Scale Selection Bits
+    Uint16 SOCPSSEL:1;                  // 5 EPWMxSOC A/B Pre-Scale Selection
+    Uint16 rsvd1:2;                     // 7:6 Reserved
+    Uint16 SOCAPRD:2;                   // 9:8 EPWMxSOCA Period Select
+    Uint16 SOCACNT:2;                   // 11:10 EPWMxSOCA Counter Register
+    Uint16 SOCBPRD:2;                   // 13:12 EPWMxSOCB Period Select
+    Uint16 SOCBCNT:2;                   // 15:14 EPWMxSOCB Counter Register
+};
+
+union ETPS_REG {
+    Uint16 all;
+    struct ETPS_BITS bit;
+};
+
+struct ETFLG_BITS {                     // bits description
+    Uint16 INT:1;                       // 0 EPWMxINTn Flag
+    Uint16 rsvd1:1;                     // 1 Reserved
+    Uint16 SOCA:1;                      // 2 EPWMxSOCA Flag
+    Uint16 SOCB:1;                      // 3 EPWMxSOCB Flag
+    Uint16 rsvd2:12;                    // 15:4 Reserved
+};
+
+union ETFLG_REG {
+    Uint16 all;
+    struct ETFLG_BITS bit;
+};
+
+struct DCTRIPSEL_BITS {                 // bits description
+    Uint16 DCAHCOMPSEL:4;               // 3:0 Digital Compare A High COMP Input
+    Uint16 DCALCOMPSEL:4;               // 7:4 Digital Compare A Low COMP Input
+    Uint16 DCBHCOMPSEL:4;               // 11:8 Digital Compare B High COMP Input
+    Uint16 DCBLCOMPSEL:4;               // 15:12 Digital Compare B Low COMP Input
+};
+
+union DCTRIPSEL_REG {
+    Uint16 all;
+    struct DCTRIPSEL_BITS bit;
+};
+
+struct DCACTL_BITS {                    // bits description
+    Uint16 EVT1SRCSEL:1;                // 0 DCAEVT1 Source Signal
+    Uint16 EVT1FRCSYNCSEL:1;            // 1 DCAEVT1 Force Sync Signal
+    Uint16 EVT1SOCE:1;                  // 2 DCAEVT1 SOC Enable
+    Uint16 EVT1SYNCE:1;                 // 3 DCAEVT1 SYNC Enable
+    Uint16 rsvd1:4;                     // 7:4 Reserved
+    Uint16 EVT2SRCSEL:1;                // 8 DCAEVT2 Source Signal
+    Uint16 EVT2FRCSYNCSEL:1;            // 9 DCAEVT2 Force Sync Signal
+    Uint16 rsvd2:6;                     // 15:10 Reserved
+};
+
+union DCACTL_REG {
+    Uint16 all;
+    struct DCACTL_BITS bit;
+};
+
+struct EPWM_REGS {
+    union   TBCTL_REG       TBCTL;          // 0x0 Time Base Control
+    union   TBCTL2_REG      TBCTL2;         // 0x1 Time Base Control 2
+    Uint16  rsvd1[2];                       // 0x2 Reserved
+    Uint16  TBCTR;                          // 0x4 Time Base Counter
+    union   TBSTS_REG       TBSTS;          // 0x5 Time Base Status
+    Uint16  rsvd2[2];                       // 0x6 Reserved
+    union   CMPCTL_REG      CMPCTL;         // 0x8 Counter Compare Control
+    Uint16  CMPCTL2;                        // 0x9 Counter Compare Control 2
+    Uint16  rsvd3[2];                       // 0xA Reserved
+    union   DBCTL_REG       DBCTL;          // 0xC Dead-Band Generator Control
+    Uint16  DBCTL2;                         // 0xD Dead-Band Generator Control 2
+    Uint16  rsvd4[2];                       // 0xE Reserved
+    Uint32  AQCTL;                          // 0x10 Action Qualifier Control
+    Uint16  rsvd5[14];                      // 0x12 Reserved
+    union   HRCNFG_REG      HRCNFG;         // 0x20 HRPWM Configuration
+    Uint16  HRPWR;                          // 0x21 HRPWM Power
+    Uint16  rsvd6[4];                       // 0x22 Reserved
+    union   HRMSTEP_REG     HRMSTEP;        // 0x26 HRPWM MEP Step
+    Uint16  HRCNFG2;                        // 0x27 HRPWM Configuration 2
+    Uint16  rsvd7[5];                       // 0x28 Reserved
+    union   HRPCTL_REG      HRPCTL;         // 0x2D High Resolution Period Ctrl
+    union   TRREM_REG       TRREM;          // 0x2E Translator Remainder
+    Uint16  rsvd8[5];                       // 0x2F Reserved
+    union   GLDCTL_REG      GLDCTL;         // 0x34 Global PWM Load Control
+    union   GLDCFG_REG      GLDCFG;         // 0x35 Global PWM Load Config
+    Uint16  rsvd9[2];                       // 0x36 Reserved
+    union   EPWMXLINK_REG   EPWMXLINK;      // 0x38 EPWMx Link
+    Uint16  rsvd10[6];                      // 0x3A Reserved
+    union   AQCTLA_REG      AQCTLA;         // 0x40 Action Qualifier Control A
+    Uint16  AQCTLA2;                        // 0x41 Additional AQ Control A
+    union   AQCTLB_REG      AQCTLB;         // 0x42 Action Qualifier Control B
+    Uint16  AQCTLB2;                        // 0x43 Additional AQ Control B
+    Uint16  rsvd11[3];                      // 0x44 Reserved
+    union   AQSFRC_REG      AQSFRC;         // 0x47 AQ Software Force
+    Uint16  rsvd12;                         // 0x48 Reserved
+    union   AQCSFRC_REG     AQCSFRC;        // 0x49 AQ Continuous S/W Force
+    Uint16  rsvd13[6];                      // 0x4A Reserved
+    Uint16  DBREDHR;                        // 0x50 Dead-Band Rising Edge HR
+    Uint16  DBRED;                          // 0x51 Dead-Band Rising Edge Delay
+    Uint16  DBFEDHR;                        // 0x52 Dead-Band Falling Edge HR
+    Uint16  DBFED;                          // 0x53 Dead-Band Falling Edge Delay
+    Uint16  rsvd14[12];                     // 0x54 Reserved
+    union   TBPHS_REG       TBPHS;          // 0x60 Time Base Phase High
+    Uint16  TBPRDHR;                        // 0x62 Time Base Period HR
+    Uint16  TBPRD;                          // 0x63 Time Base Period
+    Uint16  rsvd15[6];                      // 0x64 Reserved
+    union   CMPA_REG        CMPA;           // 0x6A Counter Compare A
+    union   CMPB_REG        CMPB;           // 0x6C Counter Compare B
+    Uint16  rsvd16;                         // 0x6E Reserved
+    Uint16  CMPC;                           // 0x6F Counter Compare C
+    Uint16  rsvd17;                         // 0x70 Reserved
+    Uint16  CMPD;                           // 0x71 Counter Compare D
+    Uint16  rsvd18[2];                      // 0x72 Reserved
+    union   GLDCTL2_REG     GLDCTL2;        // 0x74 Global PWM Load Control 2
+    Uint16  rsvd19[11];                     // 0x75 Reserved
+    union   TZSEL_REG       TZSEL;          // 0x80 Trip Zone Select
+    Uint16  rsvd20;                         // 0x81 Reserved
+    union   TZDCSEL_REG     TZDCSEL;        // 0x82 Trip Zone Digital Comp Sel
+    Uint16  rsvd21;                         // 0x83 Reserved
+    union   TZCTL_REG       TZCTL;          // 0x84 Trip Zone Control
+    Uint16  TZCTL2;                         // 0x85 Additional Trip Zone Control
+    Uint16  TZCTLDCA;                       // 0x86 Trip Zone Control DCA
+    Uint16  TZCTLDCB;                       // 0x87 Trip Zone Control DCB
+    Uint16  rsvd22[5];                      // 0x88 Reserved
+    union   TZFLG_REG       TZEINT;         // 0x8D Trip Zone Enable Interrupt
+    Uint16  rsvd23[5];                      // 0x8E Reserved
+    union   TZFLG_REG       TZFLG;          // 0x93 Trip Zone Flag
+    Uint16  TZCBCFLG;                       // 0x94 Trip Zone CBC Flag
+    Uint16  TZOSTFLG;                       // 0x95 Trip Zone OST Flag
+    Uint16  rsvd24;                         // 0x96 Reserved
+    union   TZFLG_REG       TZCLR;          // 0x97 Trip Zone Clear
+    Uint16  TZCBCCLR;                       // 0x98 Trip Zone CBC Clear
+    Uint16  TZOSTCLR;                       // 0x99 Trip Zone OST Clear
+    Uint16  rsvd25;                         // 0x9A Reserved
+    union   TZFLG_REG       TZFRC;          // 0x9B Trip Zone Force
+    Uint16  rsvd26[8];                      // 0x9C Reserved
+    union   ETSEL_REG       ETSEL;          // 0xA4 Event Trigger Selection
+    Uint16  rsvd27;                         // 0xA5 Reserved
+    union   ETPS_REG        ETPS;           // 0xA6 Event Trigger Pre-Scale
+    Uint16  rsvd28;                         // 0xA7 Reserved
+    union   ETFLG_REG       ETFLG;          // 0xA8 Event Trigger Flag
+    Uint16  rsvd29;                         // 0xA9 Reserved
+    union   ETFLG_REG       ETCLR;          // 0xAA Event Trigger Clear
+    Uint16  rsvd30;                         // 0xAB Reserved
+    union   ETFLG_REG       ETFRC;          // 0xAC Event Trigger Force
+    Uint16  rsvd31[0x13];                   // 0xAD Reserved
+    union   DCTRIPSEL_REG   DCTRIPSEL;      // 0xC0 Digital Compare Trip Select
+    Uint16  rsvd32[2];                      // 0xC1 Reserved
+    union   DCACTL_REG      DCACTL;         // 0xC3 Digital Compare A Control
+    Uint16  DCBCTL;                         // 0xC4 Digital Compare B Control
+    Uint16  rsvd33[0x3B];                   // 0xC5 Reserved
+};
+
+//
+// ADC
+//
+struct ADCCTL1_BITS {                   // bits description
+    Uint16 rsvd1:2;                     // 1:0 Reserved
+    Uint16 INTPULSEPOS:1;               // 2 ADC Interrupt Pulse Position
+    Uint16 rsvd2:4;                     // 6:3 Reserved
+    Uint16 ADCPWDNZ:1;                  // 7 ADC Power Down
+    Uint16 ADCBSYCHN:4;                 // 11:8 ADC Busy Channel
+    Uint16 rsvd3:1;                     // 12 Reserved
+    Uint16 ADCBSY:1;                    // 13 ADC Busy
+    Uint16 rsvd4:2;                     // 15:14 Reserved
+};
+
+union ADCCTL1_REG {
+    Uint16 all;
+    struct ADCCTL1_BITS bit;
+};
+
+struct ADCCTL2_BITS {                   // bits description
+    Uint16 PRESCALE:4;                  // 3:0 ADC Clock Prescaler
+    Uint16 rsvd1:12;                    // 15:4 Reserved
+};
+
+union ADCCTL2_REG {
+    Uint16 all;
+    struct ADCCTL2_BITS bit;
+};
+
+struct ADCINTFLG_BITS {                 // bits description
+    Uint16 ADCINT1:1;                   // 0 ADC Interrupt 1 Flag
+    Uint16 ADCINT2:1;                   // 1 ADC Interrupt 2 Flag
+    Uint16 ADCINT3:1;                   // 2 ADC Interrupt 3 Flag
+    Uint16 ADCINT4:1;                   // 3 ADC Interrupt 4 Flag
+    Uint16 rsvd1:12;                    // 15:4 Reserved
+};
+
+union ADCINTFLG_REG {
+    Uint16 all;
+    struct ADCINTFLG_BITS bit;
+};
+
+struct ADCINTSEL1N2_BITS {              // bits description
+    Uint16 INT1SEL:5;                   // 4:0 ADCINT1 EOC Source Select
+    Uint16 INT1E:1;                     // 5 ADCINT1 Interrupt Enable
+    Uint16 INT1CONT:1;                  // 6 ADCINT1 Continue to Interrupt Mode
+    Uint16 rsvd1:1;                     // 7 Reserved
+    Uint16 INT2SEL:5;                   // 12:8 ADCINT2 EOC Source Select
+    Uint16 INT2E:1;                     // 13 ADCINT2 Interrupt Enable
+    Uint16 INT2CONT:1;                  // 14 ADCINT2 Continue to Interrupt Mode
+    Uint16 rsvd2:1;                     // 15 Reserved
+};
+
+union ADCINTSEL1N2_REG {
+    Uint16 all;
+    struct ADCINTSEL1N2_BITS bit;
+};
+
+struct ADCSOC_BITS {                    // bits description
+    Uint32 ACQPS:9;                     // 8:0 SOC Acquisition Prescale
+    Uint32 rsvd1:6;                     // 14:9 Reserved
+    Uint32 CHSEL:4;                     // 18:15 SOC Channel Select
+    Uint32 rsvd2:1;                     // 19 Reserved
+    Uint32 TRIGSEL:5;                   // 24:20 SOC Trigger Source Select
+    Uint32 rsvd3:7;                     // 31:25 Reserved
+};
+
+union ADCSOC_REG {
+    Uint32 all;
+    struct ADCSOC_BITS bit;
+};
+
+struct ADC_REGS {
+    union   ADCCTL1_REG         ADCCTL1;        // 0x0 ADC Control 1
+    union   ADCCTL2_REG         ADCCTL2;        // 0x1 ADC Control 2
+    Uint16  ADCBURSTCTL;                        // 0x2 ADC Burst Control
+    union   ADCINTFLG_REG       ADCINTFLG;      // 0x3 ADC Interrupt Flag
+    union   ADCINTFLG_REG       ADCINTFLGCLR;   // 0x4 ADC Interrupt Flag Clear
+    union   ADCINTFLG_REG       ADCINTOVF;      // 0x5 ADC Interrupt Overflow
+    union   ADCINTFLG_REG       ADCINTOVFCLR;   // 0x6 ADC Int Overflow Clear
+    union   ADCINTSEL1N2_REG    ADCINTSEL1N2;   // 0x7 ADC Interrupt 1 and 2 Sel
+    Uint16  ADCINTSEL3N4;                       // 0x8 ADC Interrupt 3 and 4 Sel
+    Uint16  ADCSOCPRICTL;                       // 0x9 ADC SOC Priority Control
+    Uint16  ADCINTSOCSEL1;                      // 0xA ADC Int SOC Select 1
+    Uint16  ADCINTSOCSEL2;                      // 0xB ADC Int SOC Select 2
+    Uint16  ADCSOCFLG1;                         // 0xC ADC SOC Flag 1
+    Uint16  ADCSOCFRC1;                         // 0xD ADC SOC Force 1
+    Uint16  ADCSOCOVF1;                         // 0xE ADC SOC Overflow 1
+    Uint16  ADCSOCOVFCLR1;                      // 0xF ADC SOC Overflow Clear 1
+    union   ADCSOC_REG          ADCSOC0CTL;     // 0x10 ADC SOC0 Control
+    union   ADCSOC_REG          ADCSOC1CTL;     // 0x12 ADC SOC1 Control
+    union   ADCSOC_REG          ADCSOC2CTL;     // 0x14 ADC SOC2 Control
+    union   ADCSOC_REG          ADCSOC3CTL;     // 0x16 ADC SOC3 Control
+    union   ADCSOC_REG          ADCSOC4CTL;     // 0x18 ADC SOC4 Control
+    union   ADCSOC_REG          ADCSOC5CTL;     // 0x1A ADC SOC5 Control
+    union   ADCSOC_REG          ADCSOC6CTL;     // 0x1C ADC SOC6 Control
+    union   ADCSOC_REG          ADCSOC7CTL;     // 0x1E ADC SOC7 Control
+    union   ADCSOC_REG          ADCSOC8CTL;     // 0x20 ADC SOC8 Control
+    union   ADCSOC_REG          ADCSOC9CTL;     // 0x22 ADC SOC9 Control
+    union   ADCSOC_REG          ADCSOC10CTL;    // 0x24 ADC SOC10 Control
+    union   ADCSOC_REG          ADCSOC11CTL;    // 0x26 ADC SOC11 Control
+    union   ADCSOC_REG          ADCSOC12CTL;    // 0x28 ADC SOC12 Control
+    union   ADCSOC_REG          ADCSOC13CTL;    // 0x2A ADC SOC13 Control
+    union   ADCSOC_REG          ADCSOC14CTL;    // 0x2C ADC SOC14 Control
+    union   ADCSOC_REG          ADCSOC15CTL;    // 0x2E ADC SOC15 Control
+    Uint16  rsvd1[0x50];                        // 0x30 Reserved
+};
+
+struct ADC_RESULT_REGS {
+    Uint16  ADCRESULT0;                         // 0x0 ADC Result 0
+    Uint16  ADCRESULT1;                         // 0x1 ADC Result 1
+    Uint16  ADCRESULT2;                         // 0x2 ADC Result 2
+    Uint16  ADCRESULT3;                         // 0x3 ADC Result 3
+    Uint16  ADCRESULT4;                         // 0x4 ADC Result 4
+    Uint16  ADCRESULT5;                         // 0x5 ADC Result 5
+    Uint16  ADCRESULT6;                         // 0x6 ADC Result 6
+    Uint16  ADCRESULT7;                         // 0x7 ADC Result 7
+    Uint16  ADCRESULT8;                         // 0x8 ADC Result 8
+    Uint16  ADCRESULT9;                         // 0x9 ADC Result 9
+    Uint16  ADCRESULT10;                        // 0xA ADC Result 10
+    Uint16  ADCRESULT11;                        // 0xB ADC Result 11
+    Uint16  ADCRESULT12;                        // 0xC ADC Result 12
+    Uint16  ADCRESULT13;                        // 0xD ADC Result 13
+    Uint16  ADCRESULT14;                        // 0xE ADC Result 14
+    Uint16  ADCRESULT15;                        // 0xF ADC Result 15
+    Uint16  rsvd1[0x10];                        // 0x10 Reserved
+};
+
+//
+// GPIO. Each port is a 0x40-word group; the TI sources walk them as
+// Uint32 arrays (GPY_CTRL_OFFSET, GPY_DATA_OFFSET in f28004x_examples.h).
+//
+struct GPA_BITS {                       // bits description
+    Uint32 GPIO0:1;                     // 0 GPIO0
+    Uint32 GPIO1:1;                     // 1 GPIO1
+    Uint32 GPIO2:1;                     // 2 GPIO2
+    Uint32 GPIO3:1;                     // 3 GPIO3
+    Uint32 GPIO4:1;                     // 4 GPIO4
+    Uint32 GPIO5:1;                     // 5 GPIO5
+    Uint32 GPIO6:1;                     // 6 GPIO6
+    Uint32 GPIO7:1;                     // 7 GPIO7
+    Uint32 GPIO8:1;                     // 8 GPIO8
+    Uint32 GPIO9:1;                     // 9 GPIO9
+    Uint32 GPIO10:1;                    // 10 GPIO10
+    Uint32 GPIO11:1;                    // 11 GPIO11
+    Uint32 GPIO12:1;                    // 12 GPIO12
+    Uint32 GPIO13:1;                    // 13 GPIO13
+    Uint32 GPIO14:1;                    // 14 GPIO14
+    Uint32 GPIO15:1;                    // 15 GPIO15
+    Uint32 GPIO16:1;                    // 16 GPIO16
+    Uint32 GPIO17:1;                    // 17 GPIO17
+    Uint32 GPIO18:1;                    // 18 GPIO18
+    Uint32 GPIO19:1;                    // 19 GPIO19
+    Uint32 GPIO20:1;                    // 20 GPIO20
+    Uint32 GPIO21:1;                    // 21 GPIO21
+    Uint32 GPIO22:1;                    // 22 GPIO22
+    Uint32 GPIO23:1;                    // 23 GPIO23
+    Uint32 GPIO24:1;                    // 24 GPIO24
+    Uint32 GPIO25:1;                    // 25 GPIO25
+    Uint32 GPIO26:1;                    // 26 GPIO26
+    Uint32 GPIO27:1;                    // 27 GPIO27
+    Uint32 GPIO28:1;                    // 28 GPIO28
+    Uint32 GPIO29:1;                    // 29 GPIO29
+    Uint32 GPIO30:1;                    // 30 GPIO30
+    Uint32 GPIO31:1;                    // 31 GPIO31
+};
+
+union GPA_REG {
+    Uint32 all;
+    struct GPA_BITS bit;
+};
+
+struct GPAMUX1_BITS {                   // bits description
+    Uint32 GPIO0:2;                     // 1:0 Defines pin-muxing selection
+    Uint32 GPIO1:2;                     // 3:2 Defines pin-muxing selection
+    Uint32 GPIO2:2;                     // 5:4 Defines pin-muxing selection
+    Uint32 GPIO3:2;                     // 7:6 Defines pin-muxing selection
+    Uint32 GPIO4:2;                     // 9:8 Defines pin-muxing selection
+    Uint32 GPIO5:2;                     // 11:10 Defines pin-muxing selection
+    Uint32 GPIO6:2;                     // 13:12 Defines pin-muxing selection
+    Uint32 GPIO7:2;                     // 15:14 Defines pin-muxing selection
+    Uint32 GPIO8:2;                     // 17:16 Defines pin-muxing selection
+    Uint32 GPIO9:2;                     // 19:18 Defines pin-muxing selection
+    Uint32 GPIO10:2;                    // 21:20 Defines pin-muxing selection
+    Uint32 GPIO11:2;                    // 23:22 Defines pin-muxing selection
+    Uint32 GPIO12:2;                    // 25:24 Defines pin-muxing selection
+    Uint32 GPIO13:2;                    // 27:26 Defines pin-muxing selection
+    Uint32 GPIO14:2;                    // 29:28 Defines pin-muxing selection
+    Uint32 GPIO15:2;                    // 31:30 Defines pin-muxing selection
+};
+
+union GPAMUX1_REG {
+    Uint32 all;
+    struct GPAMUX1_BITS bit;
+};
+
+struct GPIO_CTRL_REGS {
+    Uint32  GPACTRL;                    // 0x0 GPA Qualification Sampling
+    Uint32  GPAQSEL1;                   // 0x2 GPA Qualifier Select 1
+    Uint32  GPAQSEL2;                   // 0x4 GPA Qualifier Select 2
+    union   GPAMUX1_REG GPAMUX1;        // 0x6 GPA Mux 1
+    Uint32  GPAMUX2;                    // 0x8 GPA Mux 2
+    union   GPA_REG GPADIR;             // 0xA GPA Direction
+    union   GPA_REG GPAPUD;             // 0xC GPA Pull Up Disable
+    Uint32  rsvd1;                      // 0xE Reserved
+    Uint32  GPAINV;                     // 0x10 GPA Input Polarity Invert
+    Uint32  GPAODR;                     // 0x12 GPA Open Drain Output
+    Uint32  GPAAMSEL;                   // 0x14 GPA Analog Mode Select
+    Uint32  rsvd2[5];                   // 0x16 Reserved
+    Uint32  GPAGMUX1;                   // 0x20 GPA Peripheral Group Mux 1
+    Uint32  GPAGMUX2;                   // 0x22 GPA Peripheral Group Mux 2
+    Uint32  rsvd3[2];                   // 0x24 Reserved
+    Uint32  GPACSEL1;                   // 0x28 GPA Core Select 1
+    Uint32  GPACSEL2;                   // 0x2A GPA Core Select 2
+    Uint32  GPACSEL3;                   // 0x2C GPA Core Select 3
+    Uint32  GPACSEL4;                   // 0x2E GPA Core Select 4
+    Uint32  rsvd4[6];                   // 0x30 Reserved
+    union   GPA_REG GPALOCK;            // 0x3C GPA Lock Configuration
+    Uint32  GPACR;                      // 0x3E GPA Lock Commit
+    Uint32  GPBCTRL;                    // 0x40 GPB Qualification Sampling
+    Uint32  GPBQSEL1;                   // 0x42 GPB Qualifier Select 1
+    Uint32  GPBQSEL2;                   // 0x44 GPB Qualifier Select 2
+    union   GPAMUX1_REG GPBMUX1;        // 0x46 GPB Mux 1
+    Uint32  GPBMUX2;                    // 0x48 GPB Mux 2
+    union   GPA_REG GPBDIR;             // 0x4A GPB Direction
+    union   GPA_REG GPBPUD;             // 0x4C GPB Pull Up Disable
+    Uint32  rsvd5;                      // 0x4E Reserved
+    Uint32  GPBINV;                     // 0x50 GPB Input Polarity Invert
+    Uint32  GPBODR;                     // 0x52 GPB Open Drain Output
+    Uint32  GPBAMSEL;                   // 0x54 GPB Analog Mode Select
+    Uint32  rsvd6[5];                   // 0x56 Reserved
+    Uint32  GPBGMUX1;                   // 0x60 GPB Peripheral Group Mux 1
+    Uint32  GPBGMUX2;                   // 0x62 GPB Peripheral Group Mux 2
+    Uint32  rsvd7[2];                   // 0x64 Reserved
+    Uint32  GPBCSEL1;                   // 0x68 GPB Core Select 1
+    Uint32  GPBCSEL2;                   // 0x6A GPB Core Select 2
+    Uint32  GPBCSEL3;                   // 0x6C GPB Core Select 3
+    Uint32  GPBCSEL4;                   // 0x6E GPB Core Select 4
+    Uint32  rsvd8[6];                   // 0x70 Reserved
+    union   GPA_REG GPBLOCK;            // 0x7C GPB Lock Configuration
+    Uint32  GPBCR;                      // 0x7E GPB Lock Commit
+    Uint32  rsvd9[0xA0];                // 0x80 Ports C..G, not on F28004x
+    Uint32  GPHCTRL;                    // 0x1C0 GPH Qualification Sampling
+    Uint32  GPHQSEL1;                   // 0x1C2 GPH Qualifier Select 1
+    Uint32  GPHQSEL2;                   // 0x1C4 GPH Qualifier Select 2
+    union   GPAMUX1_REG GPHMUX1;        // 0x1C6 GPH Mux 1
+    Uint32  GPHMUX2;                    // 0x1C8 GPH Mux 2
+    union   GPA_REG GPHDIR;             // 0x1CA GPH Direction
+    union   GPA_REG GPHPUD;             // 0x1CC GPH Pull Up Disable
+    Uint32  rsvd10;                     // 0x1CE Reserved
+    Uint32  GPHINV;                     // 0x1D0 GPH Input Polarity Invert
+    Uint32  GPHODR;                     // 0x1D2 GPH Open Drain Output
+    Uint32  GPHAMSEL;                   // 0x1D4 GPH Analog Mode Select
+    Uint32  rsvd11[5];                  // 0x1D6 Reserved
+    Uint32  GPHGMUX1;                   // 0x1E0 GPH Peripheral Group Mux 1
+    Uint32  GPHGMUX2;                   // 0x1E2 GPH Peripheral Group Mux 2
+    Uint32  rsvd12[2];                  // 0x1E4 Reserved
+    Uint32  GPHCSEL1;                   // 0x1E8 GPH Core Select 1
+    Uint32  GPHCSEL2;                   // 0x1EA GPH Core Select 2
+    Uint32  GPHCSEL3;                   // 0x1EC GPH Core Select 3
+    Uint32  GPHCSEL4;                   // 0x1EE GPH Core Select 4
+    Uint32  rsvd13[6];                  // 0x1F0 Reserved
+    union   GPA_REG GPHLOCK;            // 0x1FC GPH Lock Configuration
+    Uint32  GPHCR;                      // 0x1FE GPH Lock Commit
+};
+
+struct GPIO_DATA_REGS {
+    union   GPA_REG GPADAT;             // 0x0 GPA Data
+    union   GPA_REG GPASET;             // 0x2 GPA Data Set
+    union   GPA_REG GPACLEAR;           // 0x4 GPA Data Clear
+    union   GPA_REG GPATOGGLE;          // 0x6 GPA Data Toggle
+    union   GPA_REG GPBDAT;             // 0x8 GPB Data
+    union   GPA_REG GPBSET;             // 0xA GPB Data Set
+    union   GPA_REG GPBCLEAR;           // 0xC GPB Data Clear
+    union   GPA_REG GPBTOGGLE;          // 0xE GPB Data Toggle
+    Uint32  rsvd1[0x14];                // 0x10 Ports C..G, not on F28004x
+    union   GPA_REG GPHDAT;             // 0x38 GPH Data
+    union   GPA_REG GPHSET;             // 0x3A GPH Data Set
+    union   GPA_REG GPHCLEAR;           // 0x3C GPH Data Clear
+    union   GPA_REG GPHTOGGLE;          // 0x3E GPH Data Toggle
+};
+
+//
+// CPU timers
+//
+struct TCR_BITS {                       // bits description
+    Uint16 rsvd1:4;                     // 3:0 Reserved
+    Uint16 TSS:1;                       // 4 CPU-Timer stop status bit.
+    Uint16 TRB:1;                       // 5 Timer reload
+    Uint16 rsvd2:4;                     // 9:6 Reserved
+    Uint16 SOFT:1;                      // 10 Emulation modes
+    Uint16 FREE:1;                      // 11 Emulation modes
+    Uint16 rsvd3:2;                     // 13:12 Reserved
+    Uint16 TIE:1;                       // 14 CPU-Timer Interrupt Enable.
+    Uint16 TIF:1;                       // 15 CPU-Timer Interrupt Flag.
+};
+
+union TCR_REG {
+    Uint16 all;
+    struct TCR_BITS bit;
+};
+
+union TIM_REG {
+    Uint32 all;
+};
+
+union PRD_REG {
+    Uint32 all;
+};
+
+union TPR_REG {
+    Uint16 all;
+};
+
+union TPRH_REG {
+    Uint16 all;
+};
+
+struct CPUTIMER_REGS {
+    union   TIM_REG     TIM;                    // 0x0 CPU-Timer Counter
+    union   PRD_REG     PRD;                    // 0x2 CPU-Timer Period
+    union   TCR_REG     TCR;                    // 0x4 CPU-Timer Control
+    Uint16  rsvd1;                              // 0x5 Reserved
+    union   TPR_REG     TPR;                    // 0x6 CPU-Timer Prescale Low
+    union   TPRH_REG    TPRH;                   // 0x7 CPU-Timer Prescale High
+};
+
+struct CPUTIMER_VARS {
+    volatile struct CPUTIMER_REGS *RegsAddr;
+    Uint32 InterruptCount;
+    float CPUFreqInMHz;
+    float PeriodInUSec;
+};
+
+//
+// PIE. PIEIERx and PIEIFRx are interleaved from 0x2 on; the default ISR
+// walks them that way.
+//
+struct PIECTRL_BITS {                   // bits description
+    Uint16 ENPIE:1;                     // 0 PIE Enable
+    Uint16 PIEVECT:15;                  // 15:1 PIE Vector Address
+};
+
+union PIECTRL_REG {
+    Uint16 all;
+    struct PIECTRL_BITS bit;
+};
+
+struct PIEIER_BITS {                    // bits description
+    Uint16 INTx1:1;                     // 0 Enable for Interrupt 1
+    Uint16 INTx2:1;                     // 1 Enable for Interrupt 2
+    Uint16 INTx3:1;                     // 2 Enable for Interrupt 3
+    Uint16 INTx4:1;                     // 3 Enable for Interrupt 4
+    Uint16 INTx5:1;                     // 4 Enable for Interrupt 5
+    Uint16 INTx6:1;                     // 5 Enable for Interrupt 6
+    Uint16 INTx7:1;                     // 6 Enable for Interrupt 7
+    Uint16 INTx8:1;                     // 7 Enable for Interrupt 8
+    Uint16 INTx9:1;                     // 8 Enable for Interrupt 9
+    Uint16 INTx10:1;                    // 9 Enable for Interrupt 10
+    Uint16 INTx11:1;                    // 10 Enable for Interrupt 11
+    Uint16 INTx12:1;                    // 11 Enable for Interrupt 12
+    Uint16 INTx13:1;                    // 12 Enable for Interrupt 13
+    Uint16 INTx14:1;                    // 13 Enable for Interrupt 14
+    Uint16 INTx15:1;                    // 14 Enable for Interrupt 15
+    Uint16 INTx16:1;                    // 15 Enable for Interrupt 16
+};
+
+union PIEIER_REG {
+    Uint16 all;
+    struct PIEIER_BITS bit;
+};
+
+struct PIE_CTRL_REGS {
+    union   PIECTRL_REG     PIECTRL;        // 0x0 PIE Control
+    union   PIEIER_REG      PIEACK;         // 0x1 Interrupt Acknowledge
+    union   PIEIER_REG      PIEIER1;        // 0x2 Interrupt Group 1 Enable
+    union   PIEIER_REG      PIEIFR1;        // 0x3 Interrupt Group 1 Flag
+    union   PIEIER_REG      PIEIER2;        // 0x4 Interrupt Group 2 Enable
+    union   PIEIER_REG      PIEIFR2;        // 0x5 Interrupt Group 2 Flag
+    union   PIEIER_REG      PIEIER3;        // 0x6 Interrupt Group 3 Enable
+    union   PIEIER_REG      PIEIFR3;        // 0x7 Interrupt Group 3 Flag
+    union   PIEIER_REG      PIEIER4;        // 0x8 Interrupt Group 4 Enable
+    union   PIEIER_REG      PIEIFR4;        // 0x9 Interrupt Group 4 Flag
+    union   PIEIER_REG      PIEIER5;        // 0xA Interrupt Group 5 Enable
+    union   PIEIER_REG      PIEIFR5;        // 0xB Interrupt Group 5 Flag
+    union   PIEIER_REG      PIEIER6;        // 0xC Interrupt Group 6 Enable
+    union   PIEIER_REG      PIEIFR6;        // 0xD Interrupt Group 6 Flag
+    union   PIEIER_REG      PIEIER7;        // 0xE Interrupt Group 7 Enable
+    union   PIEIER_REG      PIEIFR7;        // 0xF Interrupt Group 7 Flag
+    union   PIEIER_REG      PIEIER8;        // 0x10 Interrupt Group 8 Enable
+    union   PIEIER_REG      PIEIFR8;        // 0x11 Interrupt Group 8 Flag
+    union   PIEIER_REG      PIEIER9;        // 0x12 Interrupt Group 9 Enable
+    union   PIEIER_REG      PIEIFR9;        // 0x13 Interrupt Group 9 Flag
+    union   PIEIER_REG      PIEIER10;       // 0x14 Interrupt Group 10 Enable
+    union   PIEIER_REG      PIEIFR10;       // 0x15 Interrupt Group 10 Flag
+    union   PIEIER_REG      PIEIER11;       // 0x16 Interrupt Group 11 Enable
+    union   PIEIER_REG      PIEIFR11;       // 0x17 Interrupt Group 11 Flag
+    union   PIEIER_REG      PIEIER12;       // 0x18 Interrupt Group 12 Enable
+    union   PIEIER_REG      PIEIFR12;       // 0x19 Interrupt Group 12 Flag
+};
+
+typedef interrupt void (*PINT)(void);
+
+//
+// Only the vectors the applications map; InitPieVectTable() points them
+// all at DEFAULT_ISR
+//
+struct PIE_VECT_TABLE {
+    PINT    ADCA1_INT;                      // 1.1 ADCA interrupt 1
+    PINT    TIMER0_INT;                     // 1.7 CPU Timer 0
+    PINT    EPWM1_TZ_INT;                   // 2.1 ePWM1 trip zone
+    PINT    EPWM1_INT;                      // 3.1 ePWM1
+    PINT    DMA_CH1_INT;                    // 7.1 DMA channel 1
+    PINT    SCIA_RX_INT;                    // 9.1 SCIA receive
+    PINT    SCIA_TX_INT;                    // 9.2 SCIA transmit
+};
+
+//
+// System control
+//
+struct PCLKCR0_BITS {                   // bits description
+    Uint32 CLA1:1;                      // 0 CLA1 Clock Enable Bit
+    Uint32 rsvd1:1;                     // 1 Reserved
+    Uint32 DMA:1;                       // 2 DMA Clock Enable bit
+    Uint32 CPUTIMER0:1;                 // 3 CPUTIMER0 Clock Enable bit
+    Uint32 CPUTIMER1:1;                 // 4 CPUTIMER1 Clock Enable bit
+    Uint32 CPUTIMER2:1;                 // 5 CPUTIMER2 Clock Enable bit
+    Uint32 rsvd2:10;                    // 15:6 Reserved
+    Uint32 HRPWM:1;                     // 16 HRPWM Clock Enable Bit
+    Uint32 rsvd3:1;                     // 17 Reserved
+    Uint32 TBCLKSYNC:1;                 // 18 EPWM Time Base Clock sync
+    Uint32 rsvd4:13;                    // 31:19 Reserved
+};
+
+union PCLKCR0_REG {
+    Uint32 all;
+    struct PCLKCR0_BITS bit;
+};
+
+struct PCLKCR2_BITS {                   // bits description
+    Uint32 EPWM1:1;                     // 0 EPWM1 Clock Enable bit
+    Uint32 EPWM2:1;                     // 1 EPWM2 Clock Enable bit
+    Uint32 EPWM3:1;                     // 2 EPWM3 Clock Enable bit
+    Uint32 EPWM4:1;                     // 3 EPWM4 Clock Enable bit
+    Uint32 EPWM5:1;                     // 4 EPWM5 Clock Enable bit
+    Uint32 EPWM6:1;                     // 5 EPWM6 Clock Enable bit
+    Uint32 EPWM7:1;                     // 6 EPWM7 Clock Enable bit
+    Uint32 EPWM8:1;                     // 7 EPWM8 Clock Enable bit
+    Uint32 rsvd1:24;                    // 31:8 Reserved
+};
+
+union PCLKCR2_REG {
+    Uint32 all;
+    struct PCLKCR2_BITS bit;
+};
+
+struct PCLKCR3_BITS {                   // bits description
+    Uint32 ECAP1:1;                     // 0 ECAP1 Clock Enable bit
+    Uint32 ECAP2:1;                     // 1 ECAP2 Clock Enable bit
+    Uint32 ECAP3:1;                     // 2 ECAP3 Clock Enable bit
+    Uint32 ECAP4:1;                     // 3 ECAP4 Clock Enable bit
+    Uint32 ECAP5:1;                     // 4 ECAP5 Clock Enable bit
+    Uint32 ECAP6:1;                     // 5 ECAP6 Clock Enable bit
+    Uint32 ECAP7:1;                     // 6 ECAP7 Clock Enable bit
+    Uint32 rsvd1:25;                    // 31:7 Reserved
+};
+
+union PCLKCR3_REG {
+    Uint32 all;
+    struct PCLKCR3_BITS bit;
+};
+
+struct PCLKCR4_BITS {                   // bits description
+    Uint32 EQEP1:1;                     // 0 EQEP1 Clock Enable bit
+    Uint32 EQEP2:1;                     // 1 EQEP2 Clock Enable bit
+    Uint32 rsvd1:30;                    // 31:2 Reserved
+};
+
+union PCLKCR4_REG {
+    Uint32 all;
+    struct PCLKCR4_BITS bit;
+};
+
+struct PCLKCR6_BITS {                   // bits description
+    Uint32 SD1:1;                       // 0 SD1 Clock Enable bit
+    Uint32 rsvd1:31;                    // 31:1 Reserved
+};
+
+union PCLKCR6_REG {
+    Uint32 all;
+    struct PCLKCR6_BITS bit;
+};
+
+struct PCLKCR7_BITS {                   // bits description
+    Uint32 SCI_A:1;                     // 0 SCI_A Clock Enable bit
+    Uint32 SCI_B:1;                     // 1 SCI_B Clock Enable bit
+    Uint32 rsvd1:30;                    // 31:2 Reserved
+};
+
+union PCLKCR7_REG {
+    Uint32 all;
+    struct PCLKCR7_BITS bit;
+};
+
+struct PCLKCR8_BITS {                   // bits description
+    Uint32 SPI_A:1;                     // 0 SPI_A Clock Enable bit
+    Uint32 SPI_B:1;                     // 1 SPI_B Clock Enable bit
+    Uint32 rsvd1:30;                    // 31:2 Reserved
+};
+
+union PCLKCR8_REG {
+    Uint32 all;
+    struct PCLKCR8_BITS bit;
+};
+
+struct PCLKCR9_BITS {                   // bits description
+    Uint32 I2C_A:1;                     // 0 I2C_A Clock Enable bit
+    Uint32 rsvd1:31;                    // 31:1 Reserved
+};
+
+union PCLKCR9_REG {
+    Uint32 all;
+    struct PCLKCR9_BITS bit;
+};
+
+struct PCLKCR10_BITS {                  // bits description
+    Uint32 CAN_A:1;                     // 0 CAN_A Clock Enable bit
+    Uint32 CAN_B:1;                     // 1 CAN_B Clock Enable bit
+    Uint32 rsvd1:30;                    // 31:2 Reserved
+};
+
+union PCLKCR10_REG {
+    Uint32 all;
+    struct PCLKCR10_BITS bit;
+};
+
+struct PCLKCR13_BITS {                  // bits description
+    Uint32 ADC_A:1;                     // 0 ADC_A Clock Enable bit
+    Uint32 ADC_B:1;                     // 1 ADC_B Clock Enable bit
+    Uint32 ADC_C:1;                     // 2 ADC_C Clock Enable bit
+    Uint32 rsvd1:29;                    // 31:3 Reserved
+};
+
+union PCLKCR13_REG {
+    Uint32 all;
+    struct PCLKCR13_BITS bit;
+};
+
+struct PCLKCR14_BITS {                  // bits description
+    Uint32 CMPSS1:1;                    // 0 CMPSS1 Clock Enable bit
+    Uint32 CMPSS2:1;                    // 1 CMPSS2 Clock Enable bit
+    Uint32 CMPSS3:1;                    // 2 CMPSS3 Clock Enable bit
+    Uint32 CMPSS4:1;                    // 3 CMPSS4 Clock Enable bit
+    Uint32 CMPSS5:1;                    // 4 CMPSS5 Clock Enable bit
+    Uint32 CMPSS6:1;                    // 5 CMPSS6 Clock Enable bit
+    Uint32 CMPSS7:1;                    // 6 CMPSS7 Clock Enable bit
+    Uint32 rsvd1:25;                    // 31:7 Reserved
+};
+
+union PCLKCR14_REG {
+    Uint32 all;
+    struct PCLKCR14_BITS bit;
+};
+
+struct PCLKCR15_BITS {                  // bits description
+    Uint32 PGA1:1;                      // 0 PGA1 Clock Enable bit
+    Uint32 PGA2:1;                      // 1 PGA2 Clock Enable bit
+    Uint32 PGA3:1;                      // 2 PGA3 Clock Enable bit
+    Uint32 PGA4:1;                      // 3 PGA4 Clock Enable bit
+    Uint32 PGA5:1;                      // 4 PGA5 Clock Enable bit
+    Uint32 PGA6:1;                      // 5 PGA6 Clock Enable bit
+    Uint32 PGA7:1;                      // 6 PGA7 Clock Enable bit
+    Uint32 rsvd1:25;                    // 31:7 Reserved
+};
+
+union PCLKCR15_REG {
+    Uint32 all;
+    struct PCLKCR15_BITS bit;
+};
+
+struct PCLKCR16_BITS {                  // bits description
+    Uint32 rsvd1:16;                    // 15:0 Reserved
+    Uint32 DAC_A:1;                     // 16 Buffered_DAC_A Clock Enable Bit
+    Uint32 DAC_B:1;                     // 17 Buffered_DAC_B Clock Enable Bit
+    Uint32 rsvd2:14;                    // 31:18 Reserved
+};
+
+union PCLKCR16_REG {
+    Uint32 all;
+    struct PCLKCR16_BITS bit;
+};
+
+struct PCLKCR18_BITS {                  // bits description
+    Uint32 FSITX_A:1;                   // 0 FSITX_A Clock Enable bit
+    Uint32 rsvd1:15;                    // 15:1 Reserved
+    Uint32 FSIRX_A:1;                   // 16 FSIRX_A Clock Enable bit
+    Uint32 rsvd2:15;                    // 31:17 Reserved
+};
+
+union PCLKCR18_REG {
+    Uint32 all;
+    struct PCLKCR18_BITS bit;
+};
+
+struct PCLKCR19_BITS {                  // bits description
+    Uint32 LIN_A:1;                     // 0 LIN_A Clock Enable bit
+    Uint32 rsvd1:31;                    // 31:1 Reserved
+};
+
+union PCLKCR19_REG {
+    Uint32 all;
+    struct PCLKCR19_BITS bit;
+};
+
+struct PCLKCR20_BITS {                  // bits description
+    Uint32 PMBUS_A:1;                   // 0 PMBUS_A Clock Enable bit
+    Uint32 rsvd1:31;                    // 31:1 Reserved
+};
+
+union PCLKCR20_REG {
+    Uint32 all;
+    struct PCLKCR20_BITS bit;
+};
+
+struct PCLKCR21_BITS {                  // bits description
+    Uint32 DCC_0:1;                     // 0 DCC Module 0 Clock Enable Bit
+    Uint32 rsvd1:31;                    // 31:1 Reserved
+};
+
+union PCLKCR21_REG {
+    Uint32 all;
+    struct PCLKCR21_BITS bit;
+};
+
+struct LPMCR_BITS {                     // bits description
+    Uint32 LPM:2;                       // 1:0 Low Power Mode setting
+    Uint32 rsvd1:30;                    // 31:2 Reserved
+};
+
+union LPMCR_REG {
+    Uint32 all;
+    struct LPMCR_BITS bit;
+};
+
+struct CPU_SYS_REGS {
+    Uint16  rsvd1[0x22];                        // 0x0 Reserved
+    union   PCLKCR0_REG     PCLKCR0;            // 0x22 Peripheral Clock Gating 0
+    Uint32  PCLKCR1;                            // 0x24 Peripheral Clock Gating 1
+    union   PCLKCR2_REG     PCLKCR2;            // 0x26 Peripheral Clock Gating 2
+    union   PCLKCR3_REG     PCLKCR3;            // 0x28 Peripheral Clock Gating 3
+    union   PCLKCR4_REG     PCLKCR4;            // 0x2A Peripheral Clock Gating 4
+    Uint32  PCLKCR5;                            // 0x2C Peripheral Clock Gating 5
+    union   PCLKCR6_REG     PCLKCR6;            // 0x2E Peripheral Clock Gating 6
+    union   PCLKCR7_REG     PCLKCR7;            // 0x30 Peripheral Clock Gating 7
+    union   PCLKCR8_REG     PCLKCR8;            // 0x32 Peripheral Clock Gating 8
+    union   PCLKCR9_REG     PCLKCR9;            // 0x34 Peripheral Clock Gating 9
+    union   PCLKCR10_REG    PCLKCR10;           // 0x36 Peripheral Clock Gating 10
+    Uint32  PCLKCR11;                           // 0x38 Peripheral Clock Gating 11
+    Uint32  PCLKCR12;                           // 0x3A Peripheral Clock Gating 12
+    union   PCLKCR13_REG    PCLKCR13;           // 0x3C Peripheral Clock Gating 13
+    union   PCLKCR14_REG    PCLKCR14;           // 0x3E Peripheral Clock Gating 14
+    union   PCLKCR15_REG    PCLKCR15;           // 0x40 Peripheral Clock Gating 15
+    union   PCLKCR16_REG    PCLKCR16;           // 0x42 Peripheral Clock Gating 16
+    Uint32  PCLKCR17;                           // 0x44 Peripheral Clock Gating 17
+    union   PCLKCR18_REG    PCLKCR18;           // 0x46 Peripheral Clock Gating 18
+    union   PCLKCR19_REG    PCLKCR19;           // 0x48 Peripheral Clock Gating 19
+    union   PCLKCR20_REG    PCLKCR20;           // 0x4A Peripheral Clock Gating 20
+    union   PCLKCR21_REG    PCLKCR21;           // 0x4C Peripheral Clock Gating 21
+    Uint16  rsvd2[0x28];                        // 0x4E Reserved
+    union   LPMCR_REG       LPMCR;              // 0x76 Low Power Mode Control
+    Uint16  rsvd3[0x88];                        // 0x78 Reserved
+};
+
+struct CLKSRCCTL1_BITS {                // bits description
+    Uint32 OSCCLKSRCSEL:2;              // 1:0 OSCCLK Source Select Bit
+    Uint32 rsvd1:1;                     // 2 Reserved
+    Uint32 INTOSC2OFF:1;                // 3 Internal Oscillator 2 Off Bit
+    Uint32 rsvd2:1;                     // 4 Reserved
+    Uint32 WDHALTI:1;                   // 5 Watchdog HALT Mode Ignore Bit
+    Uint32 rsvd3:26;                    // 31:6 Reserved
+};
+
+union CLKSRCCTL1_REG {
+    Uint32 all;
+    struct CLKSRCCTL1_BITS bit;
+};
+
+struct SYSPLLCTL1_BITS {                // bits description
+    Uint32 PLLEN:1;                     // 0 SYSPLL enable/disable bit
+    Uint32 PLLCLKEN:1;                  // 1 SYSPLL bypassed or included
+    Uint32 rsvd1:30;                    // 31:2 Reserved
+};
+
+union SYSPLLCTL1_REG {
+    Uint32 all;
+    struct SYSPLLCTL1_BITS bit;
+};
+
+struct SYSPLLMULT_BITS {                // bits description
+    Uint32 IMULT:7;                     // 6:0 SYSPLL Integer Multiplier
+    Uint32 rsvd1:1;                     // 7 Reserved
+    Uint32 FMULT:2;                     // 9:8 SYSPLL Fractional Multiplier
+    Uint32 rsvd2:22;                    // 31:10 Reserved
+};
+
+union SYSPLLMULT_REG {
+    Uint32 all;
+    struct SYSPLLMULT_BITS bit;
+};
+
+struct SYSPLLSTS_BITS {                 // bits description
+    Uint32 LOCKS:1;                     // 0 SYSPLL Lock Status Bit
+    Uint32 SLIPS:1;                     // 1 SYSPLL Slip Status Bit
+    Uint32 rsvd1:30;                    // 31:2 Reserved
+};
+
+union SYSPLLSTS_REG {
+    Uint32 all;
+    struct SYSPLLSTS_BITS bit;
+};
+
+struct SYSCLKDIVSEL_BITS {              // bits description
+    Uint32 PLLSYSCLKDIV:6;              // 5:0 PLLSYSCLK Divide Select
+    Uint32 rsvd1:26;                    // 31:6 Reserved
+};
+
+union SYSCLKDIVSEL_REG {
+    Uint32 all;
+    struct SYSCLKDIVSEL_BITS bit;
+};
+
+struct MCDCR_BITS {                     // bits description
+    Uint32 MCLKSTS:1;                   // 0 Missing Clock Status Bit
+    Uint32 MCLKCLR:1;                   // 1 Missing Clock Clear Bit
+    Uint32 MCLKOFF:1;                   // 2 Missing Clock Detect Off Bit
+    Uint32 OSCOFF:1;                    // 3 Oscillator Clock Off Bit
+    Uint32 rsvd1:28;                    // 31:4 Reserved
+};
+
+union MCDCR_REG {
+    Uint32 all;
+    struct MCDCR_BITS bit;
+};
+
+struct X1CNT_BITS {                     // bits description
+    Uint32 X1CNT:10;                    // 9:0 X1 Counter
+    Uint32 rsvd1:6;                     // 15:10 Reserved
+    Uint32 CLR:1;                       // 16 X1 Counter Clear
+    Uint32 rsvd2:15;                    // 31:17 Reserved
+};
+
+union X1CNT_REG {
+    Uint32 all;
+    struct X1CNT_BITS bit;
+};
+
+struct XTALCR_BITS {                    // bits description
+    Uint32 OSCOFF:1;                    // 0 XTAL Oscillator powered-down
+    Uint32 SE:1;                        // 1 XTAL Oscilator in Single-Ended
+    Uint32 rsvd1:30;                    // 31:2 Reserved
+};
+
+union XTALCR_REG {
+    Uint32 all;
+    struct XTALCR_BITS bit;
+};
+
+struct CLK_CFG_REGS {
+    Uint16  rsvd1[8];                           // 0x0 Reserved
+    union   CLKSRCCTL1_REG      CLKSRCCTL1;     // 0x8 Clock Source Control 1
+    Uint32  CLKSRCCTL2;                         // 0xA Clock Source Control 2
+    Uint32  CLKSRCCTL3;                         // 0xC Clock Source Control 3
+    union   SYSPLLCTL1_REG      SYSPLLCTL1;     // 0xE SYSPLL Control 1
+    Uint16  rsvd2[4];                           // 0x10 Reserved
+    union   SYSPLLMULT_REG      SYSPLLMULT;     // 0x14 SYSPLL Multiplier
+    union   SYSPLLSTS_REG       SYSPLLSTS;      // 0x16 SYSPLL Status
+    Uint16  rsvd3[0xA];                         // 0x18 Reserved
+    union   SYSCLKDIVSEL_REG    SYSCLKDIVSEL;   // 0x22 System Clock Divider
+    Uint16  rsvd4[0xA];                         // 0x24 Reserved
+    Uint32  LOSPCP;                             // 0x2E Low Speed Clock
+    union   MCDCR_REG           MCDCR;          // 0x30 Missing Clock Detect
+    Uint32  XCLKOUTDIVSEL;                      // 0x32 XCLKOUT Divider
+    Uint16  rsvd5[4];                           // 0x34 Reserved
+    union   X1CNT_REG           X1CNT;          // 0x38 X1 Counter
+    union   XTALCR_REG          XTALCR;         // 0x3A XTAL Oscillator Control
+    Uint16  rsvd6[4];                           // 0x3C Reserved
+};
+
+struct DCCGCTRL_BITS {                  // bits description
+    Uint32 DCCENA:4;                    // 3:0 DCC Enable
+    Uint32 ERRENA:4;                    // 7:4 Error Enable
+    Uint32 SINGLESHOT:4;                // 11:8 Single-Shot Enable
+    Uint32 DONEENA:4;                   // 15:12 DONE Enable
+    Uint32 rsvd1:16;                    // 31:16 Reserved
+};
+
+union DCCGCTRL_REG {
+    Uint32 all;
+    struct DCCGCTRL_BITS bit;
+};
+
+struct DCCCNTSEED0_BITS {               // bits description
+    Uint32 COUNTSEED0:20;               // 19:0 Seed Value for Counter 0
+    Uint32 rsvd1:12;                    // 31:20 Reserved
+};
+
+union DCCCNTSEED0_REG {
+    Uint32 all;
+    struct DCCCNTSEED0_BITS bit;
+};
+
+struct DCCVALIDSEED0_BITS {             // bits description
+    Uint32 VALIDSEED:16;                // 15:0 Seed Value for Valid Duration
+    Uint32 rsvd1:16;                    // 31:16 Reserved
+};
+
+union DCCVALIDSEED0_REG {
+    Uint32 all;
+    struct DCCVALIDSEED0_BITS bit;
+};
+
+struct DCCCNTSEED1_BITS {               // bits description
+    Uint32 COUNTSEED1:20;               // 19:0 Seed Value for Counter 1
+    Uint32 rsvd1:12;                    // 31:20 Reserved
+};
+
+union DCCCNTSEED1_REG {
+    Uint32 all;
+    struct DCCCNTSEED1_BITS bit;
+};
+
+struct DCCSTATUS_BITS {                 // bits description
+    Uint32 ERR:1;                       // 0 Error Flag
+    Uint32 DONE:1;                      // 1 Single-Shot Done Flag
+    Uint32 rsvd1:30;                    // 31:2 Reserved
+};
+
+union DCCSTATUS_REG {
+    Uint32 all;
+    struct DCCSTATUS_BITS bit;
+};
+
+struct DCCCLKSRC1_BITS {                // bits description
+    Uint32 CLKSRC1:4;                   // 3:0 Clock Source Select for Counter 1
+    Uint32 rsvd1:8;                     // 11:4 Reserved
+    Uint32 KEY:4;                       // 15:12 Enables or Disables Clock Source
+    Uint32 rsvd2:16;                    // 31:16 Reserved
+};
+
+union DCCCLKSRC1_REG {
+    Uint32 all;
+    struct DCCCLKSRC1_BITS bit;
+};
+
+struct DCCCLKSRC0_BITS {                // bits description
+    Uint32 CLKSRC0:4;                   // 3:0 Clock Source Select for Counter 0
+    Uint32 rsvd1:8;                     // 11:4 Reserved
+    Uint32 KEY:4;                       // 15:12 Enables or Disables Clock Source
+    Uint32 rsvd2:16;                    // 31:16 Reserved
+};
+
+union DCCCLKSRC0_REG {
+    Uint32 all;
+    struct DCCCLKSRC0_BITS bit;
+};
+
+struct DCC_REGS {
+    union   DCCGCTRL_REG        DCCGCTRL;       // 0x0 Starts / stops the counters
+    Uint16  rsvd1[2];                           // 0x2 Reserved
+    union   DCCCNTSEED0_REG     DCCCNTSEED0;    // 0x4 Counter 0 seed value
+    union   DCCVALIDSEED0_REG   DCCVALIDSEED0;  // 0x6 Valid window seed value
+    union   DCCCNTSEED1_REG     DCCCNTSEED1;    // 0x8 Counter 1 seed value
+    union   DCCSTATUS_REG       DCCSTATUS;      // 0xA Error and done flags
+    Uint32  DCCCNT0;                            // 0xC Counter 0 value
+    Uint32  DCCVALID0;                          // 0xE Valid counter value
+    Uint32  DCCCNT1;                            // 0x10 Counter 1 value
+    union   DCCCLKSRC1_REG      DCCCLKSRC1;     // 0x12 Counter 1 clock source
+    union   DCCCLKSRC0_REG      DCCCLKSRC0;     // 0x14 Counter 0 clock source
+    Uint16  rsvd2[0xA];                         // 0x16 Reserved
+};
+
+//
+// Flash, watchdog and code security
+//
+struct FRDCNTL_BITS {                   // bits description
+    Uint32 rsvd1:8;                     // 7:0 Reserved
+    Uint32 RWAIT:4;                     // 11:8 Random Read Waitstate
+    Uint32 rsvd2:20;                    // 31:12 Reserved
+};
+
+union FRDCNTL_REG {
+    Uint32 all;
+    struct FRDCNTL_BITS bit;
+};
+
+struct FBFALLBACK_BITS {                // bits description
+    Uint32 BNKPWR0:2;                   // 1:0 Bank Power Mode of BANK0
+    Uint32 BNKPWR1:2;                   // 3:2 Bank Power Mode of BANK1
+    Uint32 rsvd1:28;                    // 31:4 Reserved
+};
+
+union FBFALLBACK_REG {
+    Uint32 all;
+    struct FBFALLBACK_BITS bit;
+};
+
+struct FPAC1_BITS {                     // bits description
+    Uint32 PMPPWR:1;                    // 0 Charge Pump Fallback Power Mode
+    Uint32 rsvd1:15;                    // 15:1 Reserved
+    Uint32 PSLEEP:12;                   // 27:16 Pump Sleep Down Count
+    Uint32 rsvd2:4;                     // 31:28 Reserved
+};
+
+union FPAC1_REG {
+    Uint32 all;
+    struct FPAC1_BITS bit;
+};
+
+struct FRD_INTF_CTRL_BITS {             // bits description
+    Uint32 PREFETCH_EN:1;               // 0 Prefetch Enable
+    Uint32 DATA_CACHE_EN:1;             // 1 Data Cache Enable
+    Uint32 rsvd1:30;                    // 31:2 Reserved
+};
+
+union FRD_INTF_CTRL_REG {
+    Uint32 all;
+    struct FRD_INTF_CTRL_BITS bit;
+};
+
+struct FLASH_CTRL_REGS {
+    union   FRDCNTL_REG         FRDCNTL;        // 0x0 Flash Read Control
+    Uint16  rsvd1[0x3E];                        // 0x2 Reserved
+    union   FBFALLBACK_REG      FBFALLBACK;     // 0x40 Flash Bank Fallback Power
+    Uint16  rsvd2[0x1C];                        // 0x42 Reserved
+    union   FPAC1_REG           FPAC1;          // 0x5E Flash Pump Access Control 1
+    Uint16  rsvd3[0x2A0];                       // 0x60 Reserved
+    union   FRD_INTF_CTRL_REG   FRD_INTF_CTRL;  // 0x300 Flash Read Interface
+};
+
+struct ECC_ENABLE_BITS {                // bits description
+    Uint32 ENABLE:4;                    // 3:0 Enable ECC
+    Uint32 rsvd1:28;                    // 31:4 Reserved
+};
+
+union ECC_ENABLE_REG {
+    Uint32 all;
+    struct ECC_ENABLE_BITS bit;
+};
+
+struct FLASH_ECC_REGS {
+    union   ECC_ENABLE_REG      ECC_ENABLE;     // 0x0 ECC Enable
+    Uint16  rsvd1[0x3E];                        // 0x2 Reserved
+};
+
+struct WDKEY_BITS {                     // bits description
+    Uint16 WDKEY:8;                     // 7:0 Watchdog Reset Key
+    Uint16 rsvd1:8;                     // 15:8 Reserved
+};
+
+union WDKEY_REG {
+    Uint16 all;
+    struct WDKEY_BITS bit;
+};
+
+union WDCR_REG {
+    Uint16 all;
+};
+
+struct WD_REGS {
+    Uint16  rsvd1[0x22];                        // 0x0 Reserved
+    Uint16  SCSR;                               // 0x22 System Control & Status
+    Uint16  WDCNTR;                             // 0x23 Watchdog Counter
+    Uint16  rsvd2;                              // 0x24 Reserved
+    union   WDKEY_REG           WDKEY;          // 0x25 Watchdog Reset Key
+    Uint16  rsvd3[3];                           // 0x26 Reserved
+    union   WDCR_REG            WDCR;           // 0x29 Watchdog Control
+    Uint16  rsvd4[6];                           // 0x2A Reserved
+};
+
+struct DCSM_Z1_REGS {
+    Uint16  rsvd1[0x10];                        // 0x0 Reserved
+    Uint32  Z1_CSMKEY0;                         // 0x10 Zone 1 CSM Key 0
+    Uint32  Z1_CSMKEY1;                         // 0x12 Zone 1 CSM Key 1
+    Uint32  Z1_CSMKEY2;                         // 0x14 Zone 1 CSM Key 2
+    Uint32  Z1_CSMKEY3;                         // 0x16 Zone 1 CSM Key 3
+    Uint16  rsvd2[0x28];                        // 0x18 Reserved
+};
+
+struct DCSM_Z2_REGS {
+    Uint16  rsvd1[0x10];                        // 0x0 Reserved
+    Uint32  Z2_CSMKEY0;                         // 0x10 Zone 2 CSM Key 0
+    Uint32  Z2_CSMKEY1;                         // 0x12 Zone 2 CSM Key 1
+    Uint32  Z2_CSMKEY2;                         // 0x14 Zone 2 CSM Key 2
+    Uint32  Z2_CSMKEY3;                         // 0x16 Zone 2 CSM Key 3
+    Uint16  rsvd2[0x28];                        // 0x18 Reserved
+};
+
+//
+// DMA
+//
+struct DMACTRL_BITS {                   // bits description
+    Uint16 HARDRESET:1;                 // 0 Hard Reset Bit
+    Uint16 PRIORITYRESET:1;             // 1 Priority Reset Bit
+    Uint16 rsvd1:14;                    // 15:2 Reserved
+};
+
+union DMACTRL_REG {
+    Uint16 all;
+    struct DMACTRL_BITS bit;
+};
+
+struct DEBUGCTRL_BITS {                 // bits description
+    Uint16 rsvd1:15;                    // 14:0 Reserved
+    Uint16 FREE:1;                      // 15 Debug Mode Bit
+};
+
+union DEBUGCTRL_REG {
+    Uint16 all;
+    struct DEBUGCTRL_BITS bit;
+};
+
+struct MODE_BITS {                      // bits description
+    Uint16 PERINTSEL:5;                 // 4:0 Peripheral Interrupt Select
+    Uint16 rsvd1:2;                     // 6:5 Reserved
+    Uint16 OVRINTE:1;                   // 7 Overflow Interrupt Enable
+    Uint16 PERINTE:1;                   // 8 Peripheral Interrupt Enable
+    Uint16 CHINTMODE:1;                 // 9 Channel Interrupt Mode
+    Uint16 ONESHOT:1;                   // 10 One Shot Mode Bit
+    Uint16 CONTINUOUS:1;                // 11 Continuous Mode Bit
+    Uint16 rsvd2:2;                     // 13:12 Reserved
+    Uint16 DATASIZE:1;                  // 14 Data Size Mode Bit
+    Uint16 CHINTE:1;                    // 15 Channel Interrupt Enable Bit
+};
+
+union MODE_REG {
+    Uint16 all;
+    struct MODE_BITS bit;
+};
+
+struct CONTROL_BITS {                   // bits description
+    Uint16 RUN:1;                       // 0 Run Bit
+    Uint16 HALT:1;                      // 1 Halt Bit
+    Uint16 SOFTRESET:1;                 // 2 Soft Reset Bit
+    Uint16 PERINTFRC:1;                 // 3 Interrupt Force Bit
+    Uint16 PERINTCLR:1;                 // 4 Interrupt Clear Bit
+    Uint16 rsvd1:2;                     // 6:5 Reserved
+    Uint16 ERRCLR:1;                    // 7 Error Clear Bit
+    Uint16 PERINTFLG:1;                 // 8 Interrupt Flag Bit
+    Uint16 rsvd2:2;                     // 10:9 Reserved
+    Uint16 TRANSFERSTS:1;               // 11 Transfer Status Bit
+    Uint16 BURSTSTS:1;                  // 12 Burst Status Bit
+    Uint16 RUNSTS:1;                    // 13 Run Status Bit
+    Uint16 OVRFLG:1;                    // 14 Overflow Flag Bit
+    Uint16 rsvd3:1;                     // 15 Reserved
+};
+
+union CONTROL_REG {
+    Uint16 all;
+    struct CONTROL_BITS bit;
+};
+
+struct CH_REGS {
+    union   MODE_REG        MODE;               // 0x0 Mode
+    union   CONTROL_REG     CONTROL;            // 0x1 Control
+    Uint16  BURST_SIZE;                         // 0x2 Burst Size
+    Uint16  BURST_COUNT;                        // 0x3 Burst Count
+    int16   SRC_BURST_STEP;                     // 0x4 Source Burst Step
+    int16   DST_BURST_STEP;                     // 0x5 Destination Burst Step
+    Uint16  TRANSFER_SIZE;                      // 0x6 Transfer Size
+    Uint16  TRANSFER_COUNT;                     // 0x7 Transfer Count
+    int16   SRC_TRANSFER_STEP;                  // 0x8 Source Transfer Step
+    int16   DST_TRANSFER_STEP;                  // 0x9 Destination Transfer Step
+    Uint16  SRC_WRAP_SIZE;                      // 0xA Source Wrap Size
+    Uint16  SRC_WRAP_COUNT;                     // 0xB Source Wrap Count
+    int16   SRC_WRAP_STEP;                      // 0xC Source Wrap Step
+    Uint16  DST_WRAP_SIZE;                      // 0xD Destination Wrap Size
+    Uint16  DST_WRAP_COUNT;                     // 0xE Destination Wrap Count
+    int16   DST_WRAP_STEP;                      // 0xF Destination Wrap Step
+    Uint32  SRC_BEG_ADDR_SHADOW;                // 0x10 Source Begin Shadow
+    Uint32  SRC_ADDR_SHADOW;                    // 0x12 Source Address Shadow
+    Uint32  SRC_BEG_ADDR_ACTIVE;                // 0x14 Source Begin Active
+    Uint32  SRC_ADDR_ACTIVE;                    // 0x16 Source Address Active
+    Uint32  DST_BEG_ADDR_SHADOW;                // 0x18 Destination Begin Shadow
+    Uint32  DST_ADDR_SHADOW;                    // 0x1A Destination Shadow
+    Uint32  DST_BEG_ADDR_ACTIVE;                // 0x1C Destination Begin Active
+    Uint32  DST_ADDR_ACTIVE;                    // 0x1E Destination Active
+};
+
+struct DMA_REGS {
+    union   DMACTRL_REG     DMACTRL;            // 0x0 DMA Control
+    union   DEBUGCTRL_REG   DEBUGCTRL;          // 0x1 Debug Control
+    Uint16  rsvd1[2];                           // 0x2 Reserved
+    Uint16  PRIORITYCTRL1;                      // 0x4 Priority Control 1
+    Uint16  rsvd2;                              // 0x5 Reserved
+    Uint16  PRIORITYSTAT;                       // 0x6 Priority Status
+    Uint16  rsvd3[0x19];                        // 0x7 Reserved
+    struct  CH_REGS         CH1;                // 0x20 DMA Channel 1
+    struct  CH_REGS         CH2;                // 0x40 DMA Channel 2
+    struct  CH_REGS         CH3;                // 0x60 DMA Channel 3
+    struct  CH_REGS         CH4;                // 0x80 DMA Channel 4
+    struct  CH_REGS         CH5;                // 0xA0 DMA Channel 5
+    struct  CH_REGS         CH6;                // 0xC0 DMA Channel 6
+};
+
+struct DMACHSRCSEL1_BITS {              // bits description
+    Uint32 CH1:8;                       // 7:0 DMA Channel 1 Trigger Select
+    Uint32 CH2:8;                       // 15:8 DMA Channel 2 Trigger Select
+    Uint32 CH3:8;                       // 23:16 DMA Channel 3 Trigger Select
+    Uint32 CH4:8;                       // 31:24 DMA Channel 4 Trigger Select
+};
+
+union DMACHSRCSEL1_REG {
+    Uint32 all;
+    struct DMACHSRCSEL1_BITS bit;
+};
+
+struct CLA1TASKSRCSEL1_BITS {           // bits description
+    Uint32 TASK1:8;                     // 7:0 Task 1 Peripheral Interrupt
+    Uint32 TASK2:8;                     // 15:8 Task 2 Peripheral Interrupt
+    Uint32 TASK3:8;                     // 23:16 Task 3 Peripheral Interrupt
+    Uint32 TASK4:8;                     // 31:24 Task 4 Peripheral Interrupt
+};
+
+union CLA1TASKSRCSEL1_REG {
+    Uint32 all;
+    struct CLA1TASKSRCSEL1_BITS bit;
+};
+
+struct DMA_CLA_SRC_SEL_REGS {
+    Uint32  CLA1TASKSRCSELLOCK;                 // 0x0 CLA1 Trigger Select Lock
+    Uint16  rsvd1[4];                           // 0x2 Reserved
+    union   CLA1TASKSRCSEL1_REG CLA1TASKSRCSEL1;    // 0x6 CLA1 Task 1-4 Trigger
+    Uint32  CLA1TASKSRCSEL2;                    // 0x8 CLA1 Task 5-8 Trigger
+    Uint16  rsvd2[0xC];                         // 0xA Reserved
+    Uint32  DMACHSRCSELLOCK;                    // 0x16 DMA Trigger Select Lock
+    union   DMACHSRCSEL1_REG    DMACHSRCSEL1;   // 0x18 DMA Channel 1-4 Trigger
+    Uint32  DMACHSRCSEL2;                       // 0x1A DMA Channel 5-6 Trigger
+};
+
+//
+// CLA and memory configuration
+//
+struct MCTL_BITS {                      // bits description
+    Uint16 HARDRESET:1;                 // 0 Hard Reset
+    Uint16 SOFTRESET:1;                 // 1 Soft Reset
+    Uint16 IACKE:1;                     // 2 IACK enable
+    Uint16 rsvd1:13;                    // 15:3 Reserved
+};
+
+union MCTL_REG {
+    Uint16 all;
+    struct MCTL_BITS bit;
+};
+
+struct MIFR_BITS {                      // bits description
+    Uint16 INT1:1;                      // 0 Task 1
+    Uint16 INT2:1;                      // 1 Task 2
+    Uint16 INT3:1;                      // 2 Task 3
+    Uint16 INT4:1;                      // 3 Task 4
+    Uint16 INT5:1;                      // 4 Task 5
+    Uint16 INT6:1;                      // 5 Task 6
+    Uint16 INT7:1;                      // 6 Task 7
+    Uint16 INT8:1;                      // 7 Task 8
+    Uint16 rsvd1:8;                     // 15:8 Reserved
+};
+
+union MIFR_REG {
+    Uint16 all;
+    struct MIFR_BITS bit;
+};
+
+struct CLA_REGS {
+    Uint16  MVECT1;                             // 0x0 Task Interrupt Vector
+    Uint16  MVECT2;                             // 0x1 Task Interrupt Vector
+    Uint16  MVECT3;                             // 0x2 Task Interrupt Vector
+    Uint16  MVECT4;                             // 0x3 Task Interrupt Vector
+    Uint16  MVECT5;                             // 0x4 Task Interrupt Vector
+    Uint16  MVECT6;                             // 0x5 Task Interrupt Vector
+    Uint16  MVECT7;                             // 0x6 Task Interrupt Vector
+    Uint16  MVECT8;                             // 0x7 Task Interrupt Vector
+    Uint16  rsvd1[8];                           // 0x8 Reserved
+    union   MCTL_REG        MCTL;               // 0x10 Control Register
+    Uint16  rsvd2[0xF];                         // 0x11 Reserved
+    union   MIFR_REG        MIFR;               // 0x20 Interrupt Flag
+    union   MIFR_REG        MIOVF;              // 0x21 Interrupt Overflow Flag
+    union   MIFR_REG        MIFRC;              // 0x22 Interrupt Force
+    union   MIFR_REG        MICLR;              // 0x23 Interrupt Flag Clear
+    union   MIFR_REG        MICLROVF;           // 0x24 Interrupt Overflow Clear
+    union   MIFR_REG        MIER;               // 0x25 Interrupt Enable
+    union   MIFR_REG        MIRUN;              // 0x26 Interrupt Run Status
+    Uint16  rsvd3[9];                           // 0x27 Reserved
+};
+
+struct LSXMSEL_BITS {                   // bits description
+    Uint32 MSEL_LS0:2;                  // 1:0 Master Select for LS0 RAM
+    Uint32 MSEL_LS1:2;                  // 3:2 Master Select for LS1 RAM
+    Uint32 MSEL_LS2:2;                  // 5:4 Master Select for LS2 RAM
+    Uint32 MSEL_LS3:2;                  // 7:6 Master Select for LS3 RAM
+    Uint32 MSEL_LS4:2;                  // 9:8 Master Select for LS4 RAM
+    Uint32 MSEL_LS5:2;                  // 11:10 Master Select for LS5 RAM
+    Uint32 MSEL_LS6:2;                  // 13:12 Master Select for LS6 RAM
+    Uint32 MSEL_LS7:2;                  // 15:14 Master Select for LS7 RAM
+    Uint32 rsvd1:16;                    // 31:16 Reserved
+};
+
+union LSXMSEL_REG {
+    Uint32 all;
+    struct LSXMSEL_BITS bit;
+};
+
+struct LSXCLAPGM_BITS {                 // bits description
+    Uint32 CLAPGM_LS0:1;                // 0 Selects LS0 RAM as program vs data
+    Uint32 CLAPGM_LS1:1;                // 1 Selects LS1 RAM as program vs data
+    Uint32 CLAPGM_LS2:1;                // 2 Selects LS2 RAM as program vs data
+    Uint32 CLAPGM_LS3:1;                // 3 Selects LS3 RAM as program vs data
+    Uint32 CLAPGM_LS4:1;                // 4 Selects LS4 RAM as program vs data
+    Uint32 CLAPGM_LS5:1;                // 5 Selects LS5 RAM as program vs data
+    Uint32 CLAPGM_LS6:1;                // 6 Selects LS6 RAM as program vs data
+    Uint32 CLAPGM_LS7:1;                // 7 Selects LS7 RAM as program vs data
+    Uint32 rsvd1:24;                    // 31:8 Reserved
+};
+
+union LSXCLAPGM_REG {
+    Uint32 all;
+    struct LSXCLAPGM_BITS bit;
+};
+
+struct MSGXINIT_BITS {                  // bits description
+    Uint32 INIT_CLA1TOCPU:1;            // 0 Initialization control
+    Uint32 INIT_CPUTOCLA1:1;            // 1 Initialization control
+    Uint32 rsvd1:30;                    // 31:2 Reserved
+};
+
+union MSGXINIT_REG {
+    Uint32 all;
+    struct MSGXINIT_BITS bit;
+};
+
+struct MSGXINITDONE_BITS {              // bits description
+    Uint32 INITDONE_CLA1TOCPU:1;        // 0 Initialization status
+    Uint32 INITDONE_CPUTOCLA1:1;        // 1 Initialization status
+    Uint32 rsvd1:30;                    // 31:2 Reserved
+};
+
+union MSGXINITDONE_REG {
+    Uint32 all;
+    struct MSGXINITDONE_BITS bit;
+};
+
+struct MEM_CFG_REGS {
+    Uint16  rsvd1[0x20];                        // 0x0 Reserved
+    Uint32  LSxLOCK;                            // 0x20 LSx RAM Config Lock
+    Uint32  LSxCOMMIT;                          // 0x22 LSx RAM Config Commit
+    union   LSXMSEL_REG     LSxMSEL;            // 0x24 LSx RAM Master Select
+    union   LSXCLAPGM_REG   LSxCLAPGM;          // 0x26 LSx Program/Data Select
+    Uint16  rsvd2[0x38];                        // 0x28 Reserved
+    union   MSGXINIT_REG    MSGxINIT;           // 0x60 Message RAM Init
+    union   MSGXINITDONE_REG MSGxINITDONE;      // 0x62 Message RAM Init Done
+    Uint16  rsvd3[0x1C];                        // 0x64 Reserved
+};
+
+//
+// SCI
+//
+struct SCIFFTX_BITS {                   // bits description
+    Uint16 TXFFIL:5;                    // 4:0 Interrupt level
+    Uint16 TXFFIENA:1;                  // 5 Interrupt enable
+    Uint16 TXFFINTCLR:1;                // 6 Clear INT flag
+    Uint16 TXFFINT:1;                   // 7 INT flag
+    Uint16 TXFFST:5;                    // 12:8 FIFO status
+    Uint16 TXFIFORESET:1;               // 13 FIFO reset
+    Uint16 SCIFFENA:1;                  // 14 Enhancement enable
+    Uint16 SCIRST:1;                    // 15 SCI reset rx/tx channels
+};
+
+union SCIFFTX_REG {
+    Uint16 all;
+    struct SCIFFTX_BITS bit;
+};
+
+struct SCIFFRX_BITS {                   // bits description
+    Uint16 RXFFIL:5;                    // 4:0 Interrupt level
+    Uint16 RXFFIENA:1;                  // 5 Interrupt enable
+    Uint16 RXFFINTCLR:1;                // 6 Clear INT flag
+    Uint16 RXFFINT:1;                   // 7 INT flag
+    Uint16 RXFFST:5;                    // 12:8 FIFO status
+    Uint16 RXFIFORESET:1;               // 13 FIFO reset
+    Uint16 RXFFOVRCLR:1;                // 14 Clear overflow
+    Uint16 RXFFOVF:1;                   // 15 FIFO overflow
+};
+
+union SCIFFRX_REG {
+    Uint16 all;
+    struct SCIFFRX_BITS bit;
+};
+
+union SCI_REG {
+    Uint16 all;
+};
+
+struct SCI_REGS {
+    union   SCI_REG         SCICCR;             // 0x0 Communications control
+    union   SCI_REG         SCICTL1;            // 0x1 Control register 1
+    union   SCI_REG         SCIHBAUD;           // 0x2 Baud rate (high) register
+    union   SCI_REG         SCILBAUD;           // 0x3 Baud rate (low) register
+    union   SCI_REG         SCICTL2;            // 0x4 Control register 2
+    union   SCI_REG         SCIRXST;            // 0x5 Receive status register
+    union   SCI_REG         SCIRXEMU;           // 0x6 Receive emulation buffer
+    union   SCI_REG         SCIRXBUF;           // 0x7 Receive data buffer
+    Uint16  rsvd1;                              // 0x8 Reserved
+    union   SCI_REG         SCITXBUF;           // 0x9 Transmit data buffer
+    union   SCIFFTX_REG     SCIFFTX;            // 0xA FIFO transmit register
+    union   SCIFFRX_REG     SCIFFRX;            // 0xB FIFO receive register
+    union   SCI_REG         SCIFFCT;            // 0xC FIFO control register
+    Uint16  rsvd2[2];                           // 0xD Reserved
+    union   SCI_REG         SCIPRI;             // 0xF SCI Priority control
+};
+
+struct INPUT_XBAR_REGS {
+    Uint16  INPUT1SELECT;                       // 0x0 INPUT1 Input Select
+    Uint16  INPUT2SELECT;                       // 0x1 INPUT2 Input Select
+    Uint16  INPUT3SELECT;                       // 0x2 INPUT3 Input Select
+    Uint16  INPUT4SELECT;                       // 0x3 INPUT4 Input Select
+    Uint16  INPUT5SELECT;                       // 0x4 INPUT5 Input Select
+    Uint16  INPUT6SELECT;                       // 0x5 INPUT6 Input Select
+    Uint16  INPUT7SELECT;                       // 0x6 INPUT7 Input Select
+    Uint16  INPUT8SELECT;                       // 0x7 INPUT8 Input Select
+    Uint16  INPUT9SELECT;                       // 0x8 INPUT9 Input Select
+    Uint16  INPUT10SELECT;                      // 0x9 INPUT10 Input Select
+    Uint16  INPUT11SELECT;                      // 0xA INPUT11 Input Select
+    Uint16  INPUT12SELECT;                      // 0xB INPUT12 Input Select
+    Uint16  INPUT13SELECT;                      // 0xC INPUT13 Input Select
+    Uint16  INPUT14SELECT;                      // 0xD INPUT14 Input Select
+    Uint16  INPUT15SELECT;                      // 0xE INPUT15 Input Select
+    Uint16  INPUT16SELECT;                      // 0xF INPUT16 Input Select
+};
+
+//
+// CMPSS, ePWM X-BAR and the analog subsystem's comparator muxes
+//
+struct COMPCTL_BITS {                   // bits description
+    Uint16 COMPHSOURCE:1;               // 0 High Comparator Source Select
+    Uint16 COMPHINV:1;                  // 1 High Comparator Invert Select
+    Uint16 CTRIPHSEL:2;                 // 3:2 High Comparator Trip Select
+    Uint16 CTRIPOUTHSEL:2;              // 5:4 High Comparator Trip Output Select
+    Uint16 ASYNCHEN:1;                  // 6 High Comparator Asynchronous Path
+    Uint16 rsvd1:1;                     // 7 Reserved
+    Uint16 COMPLSOURCE:1;               // 8 Low Comparator Source Select
+    Uint16 COMPLINV:1;                  // 9 Low Comparator Invert Select
+    Uint16 CTRIPLSEL:2;                 // 11:10 Low Comparator Trip Select
+    Uint16 CTRIPOUTLSEL:2;              // 13:12 Low Comparator Trip Output Sel
+    Uint16 ASYNCLEN:1;                  // 14 Low Comparator Asynchronous Path
+    Uint16 COMPDACE:1;                  // 15 Comparator/DAC Enable
+};
+
+union COMPCTL_REG {
+    Uint16 all;
+    struct COMPCTL_BITS bit;
+};
+
+struct COMPHYSCTL_BITS {                // bits description
+    Uint16 COMPHYS:3;                   // 2:0 Comparator Hysteresis Trim
+    Uint16 rsvd1:13;                    // 15:3 Reserved
+};
+
+union COMPHYSCTL_REG {
+    Uint16 all;
+    struct COMPHYSCTL_BITS bit;
+};
+
+struct COMPSTS_BITS {                   // bits description
+    Uint16 COMPHSTS:1;                  // 0 High Comparator Status
+    Uint16 COMPHLATCH:1;                // 1 High Comparator Latched Status
+    Uint16 rsvd1:6;                     // 7:2 Reserved
+    Uint16 COMPLSTS:1;                  // 8 Low Comparator Status
+    Uint16 COMPLLATCH:1;                // 9 Low Comparator Latched Status
+    Uint16 rsvd2:6;                     // 15:10 Reserved
+};
+
+union COMPSTS_REG {
+    Uint16 all;
+    struct COMPSTS_BITS bit;
+};
+
+struct COMPDACCTL_BITS {                // bits description
+    Uint16 DACSOURCE:1;                 // 0 DAC Source Control
+    Uint16 RAMPSOURCE:4;                // 4:1 Ramp Generator Source Control
+    Uint16 SELREF:1;                    // 5 DAC Reference Select
+    Uint16 rsvd1:1;                     // 6 Reserved
+    Uint16 SWLOADSEL:1;                 // 7 Software Load Select
+    Uint16 BLANKSOURCE:4;               // 11:8 EPWMBLANK Source Select
+    Uint16 BLANKEN:1;                   // 12 EPWMBLANK Enable
+    Uint16 rsvd2:1;                     // 13 Reserved
+    Uint16 FREESOFT:2;                  // 15:14 Free/Soft Emulation Bits
+};
+
+union COMPDACCTL_REG {
+    Uint16 all;
+    struct COMPDACCTL_BITS bit;
+};
+
+struct DACVAL_BITS {                    // bits description
+    Uint16 DACVAL:12;                   // 11:0 DAC Value Control
+    Uint16 rsvd1:4;                     // 15:12 Reserved
+};
+
+union DACVAL_REG {
+    Uint16 all;
+    struct DACVAL_BITS bit;
+};
+
+struct CMPSS_REGS {
+    union   COMPCTL_REG     COMPCTL;        // 0x0 CMPSS Comparator Control
+    union   COMPHYSCTL_REG  COMPHYSCTL;     // 0x1 CMPSS Comparator Hysteresis
+    union   COMPSTS_REG     COMPSTS;        // 0x2 CMPSS Comparator Status
+    Uint16  COMPSTSCLR;                     // 0x3 CMPSS Comparator Status Clear
+    union   COMPDACCTL_REG  COMPDACCTL;     // 0x4 CMPSS DAC Control
+    Uint16  rsvd1;                          // 0x5 Reserved
+    union   DACVAL_REG      DACHVALS;       // 0x6 CMPSS High DAC Value Shadow
+    union   DACVAL_REG      DACHVALA;       // 0x7 CMPSS High DAC Value Active
+    Uint16  rsvd2[0x18];                    // 0x8 Reserved
+};
+
+union XBAR_32_REG {
+    Uint32 all;
+};
+
+struct EPWM_XBAR_REGS {
+    union   XBAR_32_REG     TRIP4MUX0TO15CFG;   // 0x0 TRIP4 Mux 0..15 Config
+    union   XBAR_32_REG     TRIP4MUX16TO31CFG;  // 0x2 TRIP4 Mux 16..31 Config
+    Uint16  rsvd1[0x1C];                        // 0x4 Reserved
+    union   XBAR_32_REG     TRIP4MUXENABLE;     // 0x20 TRIP4 Mux Enable
+};
+
+struct ANALOG_SUBSYS_REGS {
+    union   XBAR_32_REG     CMPHPMXSEL;     // 0x0 Comparator High Mux Select
+    union   XBAR_32_REG     CMPLPMXSEL;     // 0x2 Comparator Low Mux Select
+};
+
+//
+// All register blocks in one page-aligned image, so a test can snapshot,
+// compare or write-protect them as a whole (host_regs.c). The TI sources
+// zero GpioCtrlRegs/GpioDataRegs as sizeof()/2 Uint32 words, twice their
+// host size; the pad after each takes the excess.
+//
+struct HOST_REGS {
+    struct  EPWM_REGS           EPwm1Regs;
+    struct  EPWM_REGS           EPwm2Regs;
+    struct  EPWM_REGS           EPwm3Regs;
+    struct  EPWM_REGS           EPwm4Regs;
+    struct  EPWM_REGS           EPwm5Regs;
+    struct  EPWM_REGS           EPwm6Regs;
+    struct  EPWM_REGS           EPwm7Regs;
+    struct  EPWM_REGS           EPwm8Regs;
+    struct  ADC_REGS            AdcaRegs;
+    struct  ADC_REGS            AdcbRegs;
+    struct  ADC_RESULT_REGS     AdcaResultRegs;
+    struct  ADC_RESULT_REGS     AdcbResultRegs;
+    struct  GPIO_CTRL_REGS      GpioCtrlRegs;
+    struct  GPIO_CTRL_REGS      GpioCtrlPad;
+    struct  GPIO_DATA_REGS      GpioDataRegs;
+    struct  GPIO_DATA_REGS      GpioDataPad;
+    struct  CPUTIMER_REGS       CpuTimer0Regs;
+    struct  CPUTIMER_REGS       CpuTimer1Regs;
+    struct  CPUTIMER_REGS       CpuTimer2Regs;
+    struct  PIE_CTRL_REGS       PieCtrlRegs;
+    struct  PIE_VECT_TABLE      PieVectTable;
+    struct  CPU_SYS_REGS        CpuSysRegs;
+    struct  CLK_CFG_REGS        ClkCfgRegs;
+    struct  DCC_REGS            Dcc0Regs;
+    struct  FLASH_CTRL_REGS     Flash0CtrlRegs;
+    struct  FLASH_ECC_REGS      Flash0EccRegs;
+    struct  WD_REGS             WdRegs;
+    struct  DCSM_Z1_REGS        DcsmBank0Z1Regs;
+    struct  DCSM_Z2_REGS        DcsmBank0Z2Regs;
+    struct  DMA_REGS            DmaRegs;
+    struct  DMA_CLA_SRC_SEL_REGS DmaClaSrcSelRegs;
+    struct  CLA_REGS            Cla1Regs;
+    struct  MEM_CFG_REGS        MemCfgRegs;
+    struct  SCI_REGS            SciaRegs;
+    struct  INPUT_XBAR_REGS     InputXbarRegs;
+    struct  CMPSS_REGS          Cmpss1Regs;
+    struct  CMPSS_REGS          Cmpss2Regs;
+    struct  CMPSS_REGS          Cmpss3Regs;
+    struct  CMPSS_REGS          Cmpss4Regs;
+    struct  CMPSS_REGS          Cmpss5Regs;
+    struct  CMPSS_REGS          Cmpss6Regs;
+    struct  CMPSS_REGS          Cmpss7Regs;
+    struct  EPWM_XBAR_REGS      EPwmXbarRegs;
+    struct  ANALOG_SUBSYS_REGS  AnalogSubsysRegs;
+} __attribute__((aligned(4096)));
+
+extern volatile struct HOST_REGS hostRegs;
+
+#define EPwm1Regs               (hostRegs.EPwm1Regs)
+#define EPwm2Regs               (hostRegs.EPwm2Regs)
+#define EPwm3Regs               (hostRegs.EPwm3Regs)
+#define EPwm4Regs               (hostRegs.EPwm4Regs)
+#define EPwm5Regs               (hostRegs.EPwm5Regs)
+#define EPwm6Regs               (hostRegs.EPwm6Regs)
+#define EPwm7Regs               (hostRegs.EPwm7Regs)
+#define EPwm8Regs               (hostRegs.EPwm8Regs)
+#define AdcaRegs                (hostRegs.AdcaRegs)
+#define AdcbRegs                (hostRegs.AdcbRegs)
+#define AdcaResultRegs          (hostRegs.AdcaResultRegs)
+#define AdcbResultRegs          (hostRegs.AdcbResultRegs)
+#define GpioCtrlRegs            (hostRegs.GpioCtrlRegs)
+#define GpioDataRegs            (hostRegs.GpioDataRegs)
+#define CpuTimer0Regs           (hostRegs.CpuTimer0Regs)
+#define CpuTimer1Regs           (hostRegs.CpuTimer1Regs)
+#define CpuTimer2Regs           (hostRegs.CpuTimer2Regs)
+#define PieCtrlRegs             (hostRegs.PieCtrlRegs)
+#define PieVectTable            (hostRegs.PieVectTable)
+#define CpuSysRegs              (hostRegs.CpuSysRegs)
+#define ClkCfgRegs              (hostRegs.ClkCfgRegs)
+#define Dcc0Regs                (hostRegs.Dcc0Regs)
+#define Flash0CtrlRegs          (hostRegs.Flash0CtrlRegs)
+#define Flash0EccRegs           (hostRegs.Flash0EccRegs)
+#define WdRegs                  (hostRegs.WdRegs)
+#define DcsmBank0Z1Regs         (hostRegs.DcsmBank0Z1Regs)
+#define DcsmBank0Z2Regs         (hostRegs.DcsmBank0Z2Regs)
+#define DmaRegs                 (hostRegs.DmaRegs)
+#define DmaClaSrcSelRegs        (hostRegs.DmaClaSrcSelRegs)
+#define Cla1Regs                (hostRegs.Cla1Regs)
+#define MemCfgRegs              (hostRegs.MemCfgRegs)
+#define SciaRegs                (hostRegs.SciaRegs)
+#define InputXbarRegs           (hostRegs.InputXbarRegs)
+#define Cmpss1Regs              (hostRegs.Cmpss1Regs)
+#define Cmpss2Regs              (hostRegs.Cmpss2Regs)
+#define Cmpss3Regs              (hostRegs.Cmpss3Regs)
+#define Cmpss4Regs              (hostRegs.Cmpss4Regs)
+#define Cmpss5Regs              (hostRegs.Cmpss5Regs)
+#define Cmpss6Regs              (hostRegs.Cmpss6Regs)
+#define Cmpss7Regs              (hostRegs.Cmpss7Regs)
+#define EPwmXbarRegs            (hostRegs.EPwmXbarRegs)
+#define AnalogSubsysRegs        (hostRegs.AnalogSubsysRegs)
+
+#endif  // F28004X_HOST_REGS_H
@@ -0,0 +1,44 @@
+//###########################################################################
+//
+// FILE:   host_bench.h
+//
+// TITLE:  Wall-clock timing for the host benchmarks.
+//
+// Host nanoseconds say nothing about C28x cycles; the benchmarks compare
+// code paths against each other on the same machine.
+//
+//###########################################################################
+
+#ifndef HOST_BENCH_H
+#define HOST_BENCH_H
+
+#include <stdio.h>
+#include <time.h>
+
+//
+// hostNs - Monotonic time in nanoseconds
+//
+static inline double hostNs(void)
+{
+    struct timespec t;
+
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return(t.tv_sec * 1e9 + t.tv_nsec);
+}
+
+//
+// HOST_BENCH - Run stmt n times and print the mean time per run
+//
+#define HOST_BENCH(name, n, stmt)                                           \
+    do                                                                      \
+    {                                                                       \
+        double t0_ = hostNs();                                              \
+        long i_;                                                            \
+        for(i_ = 0; i_ < (n); i_++)                                         \
+        {                                                                   \
+            stmt;                                                           \
+        }                                                                   \
+        printf("%-24s %8.1f ns\n", name, (hostNs() - t0_) / (n));           \
+    } while(0)
+
+#endif  // HOST_BENCH_H
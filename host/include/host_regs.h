@@ -0,0 +1,41 @@
+//###########################################################################
+//
+// FILE:   host_regs.h
+//
+// TITLE:  Host build helpers for tests and benchmarks.
+//
+//###########################################################################
+
+#ifndef HOST_REGS_H
+#define HOST_REGS_H
+
+#include <stdio.h>
+
+//
+// Globals
+//
+extern Uint16 hostVref[3];
+extern Uint16 hostDeviceCal;
+
+//
+// Function Prototypes
+//
+void hostReset(void);
+void hostTimerAdvance(Uint32 n);
+
+//
+// HOST_CHECK - Fail the test with file and line if cond is false
+//
+extern Uint16 hostFailures;
+
+#define HOST_CHECK(cond)                                                    \
+    do                                                                      \
+    {                                                                       \
+        if(!(cond))                                                         \
+        {                                                                   \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            hostFailures++;                                                 \
+        }                                                                   \
+    } while(0)
+
+#endif  // HOST_REGS_H
@@ -0,0 +1,634 @@
+//###########################################################################
+//
+// FILE:   plant_sim.c
+//
+// TITLE:  DC board firmware in closed loop with a simulated power stage.
+//
+// The application's main() (appMain()) runs unchanged. Simulated time
+// passes in its background loop: every SFO() call (hostSfoHook) advances
+// the ePWMs (epwm_sim.c) and the plant by PLANT_SFO_SYSCLKS, in steps of
+// PLANT_STEP_SYSCLKS. Per step:
+//
+//   - Power stage: an interleaved boost, phase k switched by ePWM<k>A, a
+//     diode per phase that blocks reverse current, one output capacitor
+//     and a resistive load.
+//   - ADC: each ePWM1 SOCA converts the ADCA SOCs it triggers; A6 reads
+//     Vout over VOUT_FULL_SCALE. The SOC that ADCINTSEL1N2.INT1SEL
+//     selects raises ADCA INT1, for the PIE and for CLA task 1.
+//   - CMPSS1: the high comparator sees the same Vout code against
+//     DACHVALS on HP mux input 1 and drives TRIPIN4 through X-BAR mux 0.
+//   - CPU Timer 0 interrupts every PRD + 1 SYSCLKs.
+//   - Interrupts: ADCA1 (PIE 1.1), TIMER0 (1.7) and EPWM1_TZ (2.1, on
+//     TZFLG.INT) are taken between steps when INTM, IER and PIEIER let
+//     them, so the ISRs the application mapped run; CLA task 1 runs on
+//     ADCA INT1 when MIER and CLA1TASKSRCSEL1 let it, task 8 on MIFRC.
+//
+// As PWM_CONFIG.h stands, ePWM1A and ePWM2A only act on CTR = 0 and
+// CTR = PRD (AQCTLA 0x0009 / 0x0006), so the CMPA that Cla1Task1() writes
+// moves no edge: both builds run a fixed 50% duty, Vout sits near 2 Vin
+// and the scenarios expect just that.
+//
+// The scenario file sets plant parameters over time and what to expect:
+//
+//   # t (ms)  parameter  value
+//   0         rload      20
+//   20        vin        18
+//   60        end
+//   expect    final      47  49       # Vout at the end (V)
+//
+// Expectations: final, min and max (plant Vout, V), ovFault and claFault
+// (application flags at the end) and ovAt (ms when ovFault was first set,
+// -1 if never). Every run also checks that the firmware's Vout_DC agrees
+// with the plant at the end. Exits 1 if a check fails.
+//
+//   plant_sim scenarios/load_step.txt [--csv vout.csv]
+//
+//###########################################################################
+
+//
+// Included Files
+//
+#include <setjmp.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "F28x_Project.h"
+#include "host_regs.h"
+#include "epwm_sim.h"
+
+//
+// Mailbox types and task prototypes only, as cla_control.cla sees them;
+// the C28x side is defined in the application
+//
+#define __TMS320C28XX_CLA__
+#include "CLA_CONTROL.h"
+#undef __TMS320C28XX_CLA__
+
+//
+// Defines
+//
+#define PLANT_STEP_SYSCLKS      10      // Plant step (100 ns)
+#define PLANT_SFO_SYSCLKS       100     // Background time per SFO() call
+#define PLANT_STEP_S            (PLANT_STEP_SYSCLKS * 1e-8)
+#define PLANT_MAX_PHASES        EPWM_SIM_MODULES
+#define PLANT_MAX_EVENTS        64
+#define PLANT_MAX_EXPECTS       16
+#define PLANT_SENSE_TOL         0.5     // Vout_DC against the plant (V)
+#define PLANT_ADC_MAX           4095
+#define PLANT_VOUT_CHSEL        6       // A6 - Vout
+#define PLANT_VOUT_FULL_SCALE   (3.3 * 25)  // Vout at ADC full scale (V)
+#define PLANT_VOUT_HPMXSEL      1       // CMPSS1 HP mux input on Vout
+#define PLANT_TRIG_EPWM1_SOCA   5       // ADCSOCxCTL.TRIGSEL
+#define PLANT_TRIPIN4           3       // epwmSimTripIn bit
+
+typedef struct
+{
+    double t;                   // s
+    double *param;              // 0 = end of the run
+    double value;
+} PLANT_EVENT;
+
+typedef struct
+{
+    char name[16];
+    double lo;
+    double hi;
+} PLANT_EXPECT;
+
+//
+// Application globals and entry point
+//
+extern void appMain(void);
+extern int32_t Vout_DC;
+extern uint16_t claFault;
+extern volatile uint16_t ovFault;
+extern void (*hostSfoHook)(void);
+
+//
+// Globals
+//
+static struct
+{
+    double vin;                 // Input voltage (V)
+    double rload;               // Load (ohm)
+    double l;                   // Phase inductance (H)
+    double rl;                  // Phase winding resistance (ohm)
+    double c;                   // Output capacitance (F)
+    double phases;              // Phases wired, phase k on ePWM<k>A
+    double vout0;               // Vout at t = 0 (V)
+} plant = {24.0, 10.0, 22e-6, 0.02, 470e-6, 2, 48.0};
+
+static const struct
+{
+    const char *name;
+    double *value;
+} plantParams[] =
+{
+    {"vin", &plant.vin},
+    {"rload", &plant.rload},
+    {"l", &plant.l},
+    {"rl", &plant.rl},
+    {"c", &plant.c},
+    {"phases", &plant.phases},
+    {"vout0", &plant.vout0}
+};
+#define PLANT_PARAMS (sizeof(plantParams) / sizeof(plantParams[0]))
+
+static PLANT_EVENT plantEvents[PLANT_MAX_EVENTS];
+static uint16_t plantEventCount;
+static uint16_t plantNext;              // Next event due
+static PLANT_EXPECT plantExpects[PLANT_MAX_EXPECTS];
+static uint16_t plantExpectCount;
+
+static double plantT;                   // s
+static double plantVout;
+static double plantIl[PLANT_MAX_PHASES];
+static double plantMin, plantMax;
+static double plantOvAt, plantClaAt;    // ms of the first fault, -1 = none
+
+static uint16_t plantAdcPending;        // ADCA INT1 not yet taken
+static uint16_t plantClaPending;        // ADCA INT1 not yet seen by the CLA
+static uint16_t plantTzTaken;           // EPWM1_TZ taken for this TZFLG.INT
+static uint32_t plantTimer0;            // SYSCLKs since the last reload
+
+static FILE *plantCsv;
+static jmp_buf plantDone;
+
+//
+// plantCode - ADC code of Vout
+//
+static uint16_t plantCode(void)
+{
+    double code = plantVout / PLANT_VOUT_FULL_SCALE * PLANT_ADC_MAX + 0.5;
+
+    if(code < 0)
+    {
+        return(0);
+    }
+    if(code > PLANT_ADC_MAX)
+    {
+        return(PLANT_ADC_MAX);
+    }
+    return((uint16_t)code);
+}
+
+//
+// plantSoca - SOCA hook: convert the ADCA SOCs ePWM<module> SOCA triggers
+//
+static void plantSoca(uint16_t module)
+{
+    volatile union ADCSOC_REG *soc = &AdcaRegs.ADCSOC0CTL;
+    volatile Uint16 *result = &AdcaResultRegs.ADCRESULT0;
+    uint16_t i, hit = 0;
+
+    for(i = 0; i < 16; i++)
+    {
+        if(soc[i].bit.TRIGSEL != PLANT_TRIG_EPWM1_SOCA + 2 * (module - 1))
+        {
+            continue;
+        }
+
+        result[i] = (soc[i].bit.CHSEL == PLANT_VOUT_CHSEL) ? plantCode() : 0;
+        if(i == AdcaRegs.ADCINTSEL1N2.bit.INT1SEL)
+        {
+            hit = 1;
+        }
+    }
+
+    if(hit && AdcaRegs.ADCINTSEL1N2.bit.INT1E)
+    {
+        plantAdcPending = 1;
+        plantClaPending = 1;
+    }
+}
+
+//
+// plantStage - Advance the power stage by one step
+//
+static void plantStage(void)
+{
+    double h = PLANT_STEP_S;
+    double iout = 0;
+    uint16_t k, on;
+
+    for(k = 0; k < (uint16_t)plant.phases; k++)
+    {
+        on = (epwmSimLevel(EPWM_SIM_OUT(k + 1, 'A')) == 1);
+
+        plantIl[k] += (plant.vin - plant.rl * plantIl[k] -
+                       (on ? 0 : plantVout)) / plant.l * h;
+        if(plantIl[k] < 0)
+        {
+            plantIl[k] = 0;             // Diode blocks
+        }
+        if(!on)
+        {
+            iout += plantIl[k];
+        }
+    }
+
+    plantVout += (iout - plantVout / plant.rload) / plant.c * h;
+    plantT += h;
+
+    if(plantVout < plantMin)
+    {
+        plantMin = plantVout;
+    }
+    if(plantVout > plantMax)
+    {
+        plantMax = plantVout;
+    }
+}
+
+//
+// plantCmpss - CMPSS1 high comparator on Vout, through X-BAR TRIP4
+//
+static void plantCmpss(void)
+{
+    uint16_t sts = 0;
+
+    if(Cmpss1Regs.COMPCTL.bit.COMPDACE &&
+       ((AnalogSubsysRegs.CMPHPMXSEL.all & 7) == PLANT_VOUT_HPMXSEL))
+    {
+        sts = (plantCode() > Cmpss1Regs.DACHVALS.bit.DACVAL) ^
+              Cmpss1Regs.COMPCTL.bit.COMPHINV;
+    }
+    Cmpss1Regs.COMPSTS.bit.COMPHSTS = sts;
+
+    if(sts && (EPwmXbarRegs.TRIP4MUXENABLE.all & 1) &&
+       ((EPwmXbarRegs.TRIP4MUX0TO15CFG.all & 3) == 0))
+    {
+        epwmSimTripIn |= 1 << PLANT_TRIPIN4;
+    }
+    else
+    {
+        epwmSimTripIn &= ~(1 << PLANT_TRIPIN4);
+    }
+}
+
+//
+// plantTimer0Step - CPU Timer 0 over one step, 1 when it interrupts
+//
+static uint16_t plantTimer0Step(void)
+{
+    if(CpuTimer0Regs.TCR.bit.TRB)
+    {
+        CpuTimer0Regs.TCR.bit.TRB = 0;
+        plantTimer0 = 0;
+    }
+    if(CpuTimer0Regs.TCR.bit.TSS)
+    {
+        return(0);
+    }
+
+    plantTimer0 += PLANT_STEP_SYSCLKS;
+    if(plantTimer0 < CpuTimer0Regs.PRD.all + 1)
+    {
+        return(0);
+    }
+
+    plantTimer0 -= CpuTimer0Regs.PRD.all + 1;
+    return(CpuTimer0Regs.TCR.bit.TIE);
+}
+
+//
+// plantCpuInt - 1 if the CPU takes a PIE group interrupt enabled in pieier
+//
+static uint16_t plantCpuInt(uint16_t mint, uint16_t pieier)
+{
+    return(!hostIntm && (IER & mint) && pieier);
+}
+
+//
+// plantInterrupts - Take what is pending and enabled, as the CPU and CLA
+//                   would between two steps
+//
+static void plantInterrupts(uint16_t tick)
+{
+    static uint16_t timer0Pending;
+
+    if(Cla1Regs.MIFRC.bit.INT8)
+    {
+        Cla1Regs.MIFRC.bit.INT8 = 0;
+        Cla1Task8();
+    }
+    if(plantClaPending)
+    {
+        plantClaPending = 0;
+        if((Cla1Regs.MIER.all & M_INT1) &&
+           (DmaClaSrcSelRegs.CLA1TASKSRCSEL1.bit.TASK1 == CLA_TRIG_ADCA1))
+        {
+            Cla1Task1();
+        }
+    }
+
+    if(plantAdcPending &&
+       plantCpuInt(M_INT1, PieCtrlRegs.PIEIER1.bit.INTx1))
+    {
+        plantAdcPending = 0;
+        PieVectTable.ADCA1_INT();
+    }
+
+    timer0Pending |= tick;
+    if(timer0Pending && plantCpuInt(M_INT1, PieCtrlRegs.PIEIER1.bit.INTx7))
+    {
+        timer0Pending = 0;
+        PieVectTable.TIMER0_INT();
+    }
+
+    if(!EPwm1Regs.TZFLG.bit.INT)
+    {
+        plantTzTaken = 0;
+    }
+    else if(!plantTzTaken && EPwm1Regs.TZEINT.bit.OST &&
+            plantCpuInt(M_INT2, PieCtrlRegs.PIEIER2.bit.INTx1))
+    {
+        plantTzTaken = 1;
+        PieVectTable.EPWM1_TZ_INT();
+    }
+}
+
+//
+// plantSfo - hostSfoHook: run PLANT_SFO_SYSCLKS of simulated time, and
+//            leave appMain() once the scenario has ended
+//
+static void plantSfo(void)
+{
+    uint16_t k, i;
+
+    for(k = 0; k < PLANT_SFO_SYSCLKS / PLANT_STEP_SYSCLKS; k++)
+    {
+        while((plantNext < plantEventCount) &&
+              (plantEvents[plantNext].t <= plantT))
+        {
+            if(plantEvents[plantNext].param == 0)
+            {
+                longjmp(plantDone, 1);
+            }
+            *plantEvents[plantNext].param = plantEvents[plantNext].value;
+            plantNext++;
+        }
+
+        epwmSimRun(PLANT_STEP_SYSCLKS);
+        plantStage();
+        plantCmpss();
+        plantInterrupts(plantTimer0Step());
+
+        if(ovFault && (plantOvAt < 0))
+        {
+            plantOvAt = plantT * 1e3;
+        }
+        if(claFault && (plantClaAt < 0))
+        {
+            plantClaAt = plantT * 1e3;
+        }
+    }
+
+    if(plantCsv != 0)
+    {
+        fprintf(plantCsv, "%.6f,%.3f,%.4f,", plantT * 1e3, plant.vin,
+                plantVout);
+        for(i = 0; i < (uint16_t)plant.phases; i++)
+        {
+            fprintf(plantCsv, "%.4f,", plantIl[i]);
+        }
+        fprintf(plantCsv, "%.4f,%u,%u\n", Vout_DC / 65536.0,
+                (unsigned)ovFault, (unsigned)claFault);
+    }
+}
+
+//
+// plantParam - Parameter called name, 0 if there is none
+//
+static double *plantParam(const char *name)
+{
+    uint16_t i;
+
+    for(i = 0; i < PLANT_PARAMS; i++)
+    {
+        if(strcmp(plantParams[i].name, name) == 0)
+        {
+            return(plantParams[i].value);
+        }
+    }
+
+    return(0);
+}
+
+//
+// plantLoad - Read the scenario file at path, 0 on success
+//
+static int plantLoad(const char *path)
+{
+    FILE *f = fopen(path, "r");
+    char line[256], a[32], b[32];
+    double x, y;
+    int n, lineNo = 0;
+
+    if(f == 0)
+    {
+        printf("plant_sim: cannot open %s\n", path);
+        return(1);
+    }
+
+    while(fgets(line, sizeof(line), f) != 0)
+    {
+        lineNo++;
+        line[strcspn(line, "#\r\n")] = 0;
+        n = sscanf(line, "%31s %31s %lf %lf", a, b, &x, &y);
+        if(n <= 0)
+        {
+            continue;
+        }
+
+        if((strcmp(a, "expect") == 0) && (n == 4) &&
+           (plantExpectCount < PLANT_MAX_EXPECTS))
+        {
+            PLANT_EXPECT *e = &plantExpects[plantExpectCount++];
+
+            strcpy(e->name, "");
+            strncat(e->name, b, sizeof(e->name) - 1);
+            e->lo = x;
+            e->hi = y;
+        }
+        else if((n >= 2) && (plantEventCount < PLANT_MAX_EVENTS) &&
+                ((strcmp(b, "end") == 0) ||
+                 ((n == 3) && (plantParam(b) != 0))))
+        {
+            PLANT_EVENT *e = &plantEvents[plantEventCount++];
+
+            e->t = atof(a) * 1e-3;
+            e->param = plantParam(b);
+            e->value = x;
+        }
+        else
+        {
+            printf("plant_sim: %s:%d: cannot parse \"%s\"\n", path, lineNo,
+                   line);
+            fclose(f);
+            return(1);
+        }
+    }
+
+    fclose(f);
+    return(0);
+}
+
+//
+// plantExpect - Check name against its value, counting a failure
+//
+static void plantExpect(const char *name, double value, double lo,
+                        double hi)
+{
+    uint16_t ok = (value >= lo) && (value <= hi);
+
+    printf("  %-8s %8.3f in [%g, %g]: %s\n", name, value, lo, hi,
+           ok ? "ok" : "FAIL");
+    if(!ok)
+    {
+        hostFailures++;
+    }
+}
+
+//
+// plantReport - Print the run and check the expectations
+//
+static void plantReport(const char *path)
+{
+    double sense = Vout_DC / 65536.0;
+    double value;
+    uint16_t i;
+
+    printf("plant_sim: %s, %.1f ms\n", path, plantT * 1e3);
+    printf("  Vout min %.2f max %.2f final %.2f V, firmware %.2f V\n",
+           plantMin, plantMax, plantVout, sense);
+    printf("  ovFault %u (%.2f ms), claFault %u (%.2f ms)\n",
+           (unsigned)ovFault, plantOvAt, (unsigned)claFault, plantClaAt);
+
+    plantExpect("sense", sense - plantVout, -PLANT_SENSE_TOL,
+                PLANT_SENSE_TOL);
+
+    for(i = 0; i < plantExpectCount; i++)
+    {
+        const char *name = plantExpects[i].name;
+
+        if(strcmp(name, "final") == 0)
+        {
+            value = plantVout;
+        }
+        else if(strcmp(name, "min") == 0)
+        {
+            value = plantMin;
+        }
+        else if(strcmp(name, "max") == 0)
+        {
+            value = plantMax;
+        }
+        else if(strcmp(name, "ovFault") == 0)
+        {
+            value = ovFault;
+        }
+        else if(strcmp(name, "claFault") == 0)
+        {
+            value = claFault;
+        }
+        else if(strcmp(name, "ovAt") == 0)
+        {
+            value = plantOvAt;
+        }
+        else
+        {
+            printf("  %-8s unknown\n", name);
+            hostFailures++;
+            continue;
+        }
+
+        plantExpect(name, value, plantExpects[i].lo, plantExpects[i].hi);
+    }
+}
+
+//
+// Main
+//
+int main(int argc, char **argv)
+{
+    uint16_t k;
+
+    if((argc != 2) && !((argc == 4) && (strcmp(argv[2], "--csv") == 0)))
+    {
+        printf("usage: plant_sim <scenario> [--csv <file>]\n");
+        return(2);
+    }
+    if(plantLoad(argv[1]) != 0)
+    {
+        return(2);
+    }
+    if((plantEventCount == 0) ||
+       (plantEvents[plantEventCount - 1].param != 0))
+    {
+        printf("plant_sim: %s has no end\n", argv[1]);
+        return(2);
+    }
+
+    if(argc == 4)
+    {
+        plantCsv = fopen(argv[3], "w");
+        if(plantCsv == 0)
+        {
+            printf("plant_sim: cannot write %s\n", argv[3]);
+            return(2);
+        }
+        fprintf(plantCsv, "# t (ms), vin, vout, il..., Vout_DC, ovFault, "
+                "claFault\n");
+    }
+
+    //
+    // Events at 0 set the starting point; the stage starts in the steady
+    // state of 50% duty at vout0
+    //
+    while((plantNext < plantEventCount) &&
+          (plantEvents[plantNext].t <= 0) &&
+          (plantEvents[plantNext].param != 0))
+    {
+        *plantEvents[plantNext].param = plantEvents[plantNext].value;
+        plantNext++;
+    }
+    if((plant.phases < 1) || (plant.phases > PLANT_MAX_PHASES))
+    {
+        printf("plant_sim: phases must be 1..%d\n", PLANT_MAX_PHASES);
+        return(2);
+    }
+    plantVout = plant.vout0;
+    for(k = 0; k < (uint16_t)plant.phases; k++)
+    {
+        plantIl[k] = plantVout * plantVout / plant.rload / plant.vin /
+                     plant.phases;
+    }
+    plantMin = plantMax = plantVout;
+    plantOvAt = plantClaAt = -1;
+
+    hostReset();
+    epwmSimReset();
+    epwmSimSocaHook = plantSoca;
+    hostSfoHook = plantSfo;
+
+    if(setjmp(plantDone) == 0)
+    {
+        appMain();
+    }
+
+    hostSfoHook = 0;
+    if(plantCsv != 0)
+    {
+        fclose(plantCsv);
+    }
+
+    plantReport(argv[1]);
+
+    printf("plant_sim: %u failures\n", hostFailures);
+    return(hostFailures != 0);
+}
+
+//
+// End of File
+//
@@ -0,0 +1,232 @@
+//###########################################################################
+//
+// FILE:   test_adc_dma.c
+//
+// TITLE:  ADC_DMA.h capture through the DMA model.
+//
+// Runs the DC board application's initADCDMA()/startADCDMA() and its
+// adcDmaISR() on DMA CH1 and feeds it numbered ADC results, one trigger
+// per SOC burst. The buffer must come out in order, half by half, with
+// the ISR reporting each half once it is full and the source pointer back
+// on ADCRESULT0 after every burst. A second channel, set up by hand,
+// checks the wrap step the ping-pong setup leaves at its default.
+//
+//###########################################################################
+
+//
+// Included Files
+//
+#include "F28x_Project.h"
+#include "host_regs.h"
+#include "dma_sim.h"
+
+//
+// Defines
+//
+#define BUF_SIZE                512     // ADC_DMA_BUF_SIZE
+#define HALF_SIZE               (BUF_SIZE / 2)
+#define ADDR(p)                 ((uint32_t)(uintptr_t)(p))
+
+//
+// Application functions and state (ADC_DMA.h in
+// hrpwm_ex2_prdupdown_sfo_v9_noman_dc_board_test.c)
+//
+extern void initADCDMA(uint16_t socCount);
+extern void startADCDMA(void);
+extern __interrupt void adcDmaISR(void);
+extern uint16_t adcDmaBuf[BUF_SIZE];
+extern volatile uint16_t adcDmaHalf;
+extern volatile uint16_t adcDmaEvents;
+extern uint16_t adcDmaXfer;
+
+//
+// Globals
+//
+static uint16_t sample;                 // Next value the ADC "converts"
+
+//
+// burst - One SOC burst of socCount results, then the ADCA INT1 trigger
+//
+static void burst(uint16_t socCount)
+{
+    volatile Uint16 *result = &AdcaResultRegs.ADCRESULT0;
+    uint16_t i;
+
+    for(i = 0; i < socCount; i++)
+    {
+        result[i] = sample++;
+    }
+    dmaSimTrigger(1);
+
+    HOST_CHECK(DmaRegs.CH1.SRC_ADDR_ACTIVE ==
+               ADDR(&AdcaResultRegs.ADCRESULT0));
+}
+
+//
+// checkHalf - Half h holds the HALF_SIZE samples starting at first
+//
+static void checkHalf(uint16_t h, uint16_t first)
+{
+    uint32_t bad = 0;
+    uint16_t i;
+
+    for(i = 0; i < HALF_SIZE; i++)
+    {
+        bad += (adcDmaBuf[h * HALF_SIZE + i] != (uint16_t)(first + i));
+    }
+    HOST_CHECK(bad == 0);
+}
+
+//
+// checkCapture - Three halves of ping-pong capture with socCount SOCs
+//
+static void checkCapture(uint16_t socCount)
+{
+    uint16_t bursts = HALF_SIZE / socCount;
+    uint16_t i;
+
+    hostReset();
+    dmaSimReset();
+    PieVectTable.DMA_CH1_INT = &adcDmaISR;
+    memset(adcDmaBuf, 0, sizeof(adcDmaBuf));
+    sample = 1;
+
+    initADCDMA(socCount);
+    HOST_CHECK(DmaRegs.CH1.BURST_SIZE == socCount - 1);
+    HOST_CHECK(DmaRegs.CH1.TRANSFER_SIZE == bursts - 1);
+
+    //
+    // RUN starts the first transfer into half 0 and queues half 1; no
+    // half is complete yet
+    //
+    startADCDMA();
+    dmaSimPoll();
+    HOST_CHECK(dmaSim[0].interrupts == 1);
+    HOST_CHECK(adcDmaXfer == 1);
+    HOST_CHECK(adcDmaEvents == 0);
+    HOST_CHECK(DmaRegs.CH1.DST_ADDR_SHADOW == ADDR(&adcDmaBuf[HALF_SIZE]));
+
+    //
+    // All but the last burst of half 0: nothing reported
+    //
+    for(i = 0; i < bursts - 1; i++)
+    {
+        burst(socCount);
+    }
+    HOST_CHECK(adcDmaEvents == 0);
+    HOST_CHECK(DmaRegs.CH1.DST_ADDR_ACTIVE ==
+               ADDR(&adcDmaBuf[HALF_SIZE - socCount]));
+
+    //
+    // The last one completes it and starts half 1
+    //
+    burst(socCount);
+    HOST_CHECK(adcDmaEvents == 1);
+    HOST_CHECK(adcDmaHalf == 0);
+    HOST_CHECK(DmaRegs.CH1.DST_ADDR_ACTIVE == ADDR(&adcDmaBuf[HALF_SIZE]));
+    checkHalf(0, 1);
+    HOST_CHECK(adcDmaBuf[HALF_SIZE] == 0);
+
+    for(i = 0; i < bursts; i++)
+    {
+        burst(socCount);
+    }
+    HOST_CHECK(adcDmaEvents == 2);
+    HOST_CHECK(adcDmaHalf == 1);
+    checkHalf(1, 1 + HALF_SIZE);
+    checkHalf(0, 1);
+
+    //
+    // And back to half 0, overwriting it
+    //
+    for(i = 0; i < bursts; i++)
+    {
+        burst(socCount);
+    }
+    HOST_CHECK(adcDmaEvents == 3);
+    HOST_CHECK(adcDmaHalf == 0);
+    checkHalf(0, 1 + 2 * HALF_SIZE);
+    checkHalf(1, 1 + HALF_SIZE);
+
+    HOST_CHECK(dmaSim[0].bursts == 3 * bursts);
+    HOST_CHECK(dmaSim[0].transfers == 3);
+    HOST_CHECK(dmaSim[0].interrupts == 4);
+    HOST_CHECK(adcDmaXfer == 4);
+}
+
+//
+// checkWrap - Source wrap every 4 bursts, 8 words on, on CH2: one-word
+//             bursts read src[0..3], src[8..11], src[16..19]
+//
+static void checkWrap(void)
+{
+    static uint16_t src[24], dst[12];
+    uint16_t i;
+    uint32_t bad = 0;
+
+    hostReset();
+    dmaSimReset();
+    for(i = 0; i < 24; i++)
+    {
+        src[i] = 100 + i;
+    }
+
+    DmaRegs.CH2.BURST_SIZE = 0;
+    DmaRegs.CH2.TRANSFER_SIZE = 11;
+    DmaRegs.CH2.SRC_TRANSFER_STEP = 1;
+    DmaRegs.CH2.DST_TRANSFER_STEP = 1;
+    DmaRegs.CH2.SRC_WRAP_SIZE = 3;
+    DmaRegs.CH2.SRC_WRAP_STEP = 8;
+    DmaRegs.CH2.DST_WRAP_SIZE = 0xFFFF;
+    DmaRegs.CH2.SRC_BEG_ADDR_SHADOW = ADDR(&src[0]);
+    DmaRegs.CH2.SRC_ADDR_SHADOW = ADDR(&src[0]);
+    DmaRegs.CH2.DST_BEG_ADDR_SHADOW = ADDR(&dst[0]);
+    DmaRegs.CH2.DST_ADDR_SHADOW = ADDR(&dst[0]);
+    DmaRegs.CH2.MODE.bit.PERINTE = 1;
+    DmaRegs.CH2.MODE.bit.CHINTMODE = 1;     // Interrupt at transfer end
+    DmaRegs.CH2.MODE.bit.CHINTE = 1;
+    DmaRegs.CH2.CONTROL.bit.RUN = 1;
+
+    for(i = 0; i < 12; i++)
+    {
+        HOST_CHECK(dmaSim[1].interrupts == 0);
+        dmaSimTrigger(2);
+    }
+
+    for(i = 0; i < 12; i++)
+    {
+        bad += (dst[i] != 100 + (i / 4) * 8 + (i % 4));
+    }
+    HOST_CHECK(bad == 0);
+
+    //
+    // Not continuous: the end interrupt, then the channel stops
+    //
+    HOST_CHECK(dmaSim[1].interrupts == 1);
+    HOST_CHECK(dmaSim[1].transfers == 1);
+    HOST_CHECK(DmaRegs.CH2.CONTROL.bit.RUNSTS == 0);
+    dmaSimTrigger(2);
+    HOST_CHECK(dmaSim[1].bursts == 12);
+}
+
+//
+// Main
+//
+int main(void)
+{
+    //
+    // The DC board's one ADCA channel, then four and all sixteen SOCs
+    //
+    checkCapture(1);
+    checkCapture(4);
+    checkCapture(16);
+
+    checkWrap();
+
+    printf("test_adc_dma: %u failures\n", hostFailures);
+    return(hostFailures != 0);
+}
+
+//
+// End of File
+//
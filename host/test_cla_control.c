@@ -0,0 +1,189 @@
+//###########################################################################
+//
+// FILE:   test_cla_control.c
+//
+// TITLE:  cla_control.cla tasks, built as C, against CLA_CONTROL.h.
+//
+// The CLA tasks run here as ordinary functions, called where the CLA
+// would start them: initCLA()'s setup is checked on the register mocks,
+// then task 8 and task 1 are run by hand on ADC results. Task 1 is checked
+// for one PI step worked out independently, for the duty and integrator
+// clamps, and for settling a simple averaged buck on the reference.
+//
+//###########################################################################
+
+//
+// Included Files
+//
+#include <math.h>
+
+#include "F28x_Project.h"
+#include "host_regs.h"
+
+//
+// Mailbox types and task prototypes only, as cla_control.cla sees them;
+// the C28x side is defined in the application
+//
+#define __TMS320C28XX_CLA__
+#include "CLA_CONTROL.h"
+#undef __TMS320C28XX_CLA__
+
+//
+// Defines
+//
+#define GAIN                    (82.5f / 4095)      // VOUT_FULL_SCALE / max
+#define PERIOD                  500.0f
+#define VIN                     100.0f              // Plant input (V)
+
+//
+// Application functions (CLA_CONTROL.h in
+// hrpwm_ex2_prdupdown_sfo_v9_noman_dc_board_test.c)
+//
+extern void initCLA(void);
+
+//
+// sample - One ADCA burst reading vout, then task 1
+//
+static void sample(float vout)
+{
+    AdcaResultRegs.ADCRESULT0 = (Uint16)(vout / GAIN + 0.5f);
+    Cla1Task1();
+}
+
+//
+// checkCmp - claState.cmp splits duty * PERIOD into CMPA and the CMPAHR
+//            fraction, and is what task 1 wrote to ePWM1
+//
+static void checkCmp(void)
+{
+    double cmp = (double)claState.duty * PERIOD;
+    uint32_t coarse = claState.cmp >> 16;
+    uint32_t hr = (claState.cmp >> 8) & 0xFF;
+
+    HOST_CHECK(EPwm1Regs.CMPA.all == claState.cmp);
+    HOST_CHECK((claState.cmp & 0xFF) == 0);
+    HOST_CHECK(fabs(coarse + hr / 256.0 - cmp) < 1.0 / 256 + 1e-3);
+}
+
+//
+// Main
+//
+int main(void)
+{
+    float err, integ, duty, vout;
+    uint16_t i;
+
+    hostReset();
+
+    //
+    // Setup: task vectors, task 1 on ADCA INT1 and the forced task 8
+    //
+    initCLA();
+    HOST_CHECK(hostEallow == 0);
+    HOST_CHECK(Cla1Regs.MVECT1 == (uint16_t)(uintptr_t)&Cla1Task1);
+    HOST_CHECK(Cla1Regs.MVECT8 == (uint16_t)(uintptr_t)&Cla1Task8);
+    HOST_CHECK(DmaClaSrcSelRegs.CLA1TASKSRCSEL1.bit.TASK1 == CLA_TRIG_ADCA1);
+    HOST_CHECK(AdcaRegs.ADCINTSEL1N2.bit.INT1CONT == 1);
+    HOST_CHECK(Cla1Regs.MIER.all == (M_INT1 | M_INT8));
+    HOST_CHECK(Cla1Regs.MIFRC.bit.INT8 == 1);
+    HOST_CHECK(MemCfgRegs.LSxCLAPGM.bit.CLAPGM_LS4 == 1);
+    HOST_CHECK(MemCfgRegs.LSxCLAPGM.bit.CLAPGM_LS7 == 0);
+
+    //
+    // Task 8 clears whatever the message RAM held
+    //
+    memset(&claState, 0xA5, sizeof(claState));
+    Cla1Task8();
+    HOST_CHECK(claState.integ == 0);
+    HOST_CHECK(claState.cmp == 0);
+    HOST_CHECK(claState.runs == 0);
+    HOST_CHECK(claState.sat == 0);
+
+    claParams.vref = 48.0f;
+    claParams.gain = GAIN;
+    claParams.kp = 0.002f;
+    claParams.ki = 0.0002f;
+    claParams.dutyMin = 0.05f;
+    claParams.dutyMax = 0.95f;
+    claParams.period = PERIOD;
+    claParams.enable = 0;
+
+    //
+    // Disabled: Vout is reported, CMPA is left alone
+    //
+    EPwm1Regs.CMPA.all = 0x12345678;
+    AdcaResultRegs.ADCRESULT0 = 2048;
+    Cla1Task1();
+    HOST_CHECK(claState.runs == 1);
+    HOST_CHECK(fabsf(claState.vout - 2048 * GAIN) < 1e-4f);
+    HOST_CHECK(EPwm1Regs.CMPA.all == 0x12345678);
+
+    //
+    // One PI step from a zero integrator
+    //
+    claParams.enable = 1;
+    Cla1Task1();
+    vout = 2048 * GAIN;
+    err = 48.0f - vout;
+    integ = 0.05f;                              // ki * err is below dutyMin
+    duty = 0.002f * err + integ;
+    HOST_CHECK(claState.runs == 2);
+    HOST_CHECK(fabsf(claState.err - err) < 1e-4f);
+    HOST_CHECK(claState.integ == integ);
+    HOST_CHECK(fabsf(claState.duty - duty) < 1e-6f);
+    HOST_CHECK(claState.sat == 0);
+    checkCmp();
+
+    //
+    // Vout at 0 V: the duty and then the integrator run into dutyMax
+    //
+    for(i = 0; i < 1000; i++)
+    {
+        sample(0.0f);
+    }
+    HOST_CHECK(claState.sat == 1);
+    HOST_CHECK(claState.duty == 0.95f);
+    HOST_CHECK(claState.integ == 0.95f);
+    checkCmp();
+
+    //
+    // Overvoltage: down to dutyMin
+    //
+    for(i = 0; i < 2000; i++)
+    {
+        sample(80.0f);
+    }
+    HOST_CHECK(claState.sat == 1);
+    HOST_CHECK(claState.duty == 0.05f);
+    HOST_CHECK(claState.integ == 0.05f);
+    checkCmp();
+
+    //
+    // Closed loop on an averaged buck from VIN with a first-order output
+    // filter: Vout settles on vref with duty vref / VIN, unsaturated
+    //
+    vout = 0;
+    for(i = 0; i < 20000; i++)
+    {
+        sample(vout);
+        vout += (claState.duty * VIN - vout) * 0.05f;
+    }
+    HOST_CHECK(fabsf(vout - 48.0f) < 0.1f);
+    HOST_CHECK(fabsf(claState.duty - 0.48f) < 0.002f);
+    HOST_CHECK(claState.sat == 0);
+    checkCmp();
+
+    //
+    // Disabling resets the integrator for the next enable
+    //
+    claParams.enable = 0;
+    sample(vout);
+    HOST_CHECK(claState.integ == 0);
+
+    printf("test_cla_control: %u failures\n", hostFailures);
+    return(hostFailures != 0);
+}
+
+//
+// End of File
+//
@@ -0,0 +1,296 @@
+//###########################################################################
+//
+// FILE:   test_compensator.c
+//
+// TITLE:  COMPENSATOR.h step responses against the difference equations.
+//
+// Each kernel, float32 and Q24, is driven with an error step through the
+// Run/Update call sequence and compared sample by sample with its
+// difference equation evaluated directly in double. With the limits out
+// of the way the outputs settle on the DC gain; with a limit in the way
+// they must stop on it and, once the error turns round, come back off it
+// as the reference does from its clamped history (the anti-windup).
+//
+//###########################################################################
+
+//
+// Included Files
+//
+#include <math.h>
+
+#include "F28x_Project.h"
+#include "host_regs.h"
+#include "COMPENSATOR.h"
+
+//
+// Defines
+//
+#define STEPS                   300
+#define STEP_E                  0.1         // Error step
+
+#define Q24_TO_D(x)             ((double)(x) / 16777216.0)
+
+//
+// Test filters: a 2p2z with poles at 0.835 and 0.365 and DC gain 2, and a
+// 3p3z with poles at 0.5 and 0.5 +- 0.224 and DC gain 2.5
+//
+static const double b2p[3] = {0.5, -0.4, 0.1};
+static const double a2p[2] = {-1.2, 0.3};
+static const double b3p[4] = {0.3, -0.2, 0.1, 0.05};
+static const double a3p[3] = {-1.5, 0.7, -0.1};
+
+//
+// REF_IIR - Reference: direct evaluation of an order-n difference equation
+//           with the output clamped before it enters the history
+//
+typedef struct
+{
+    const double *b, *a;
+    uint16_t n;
+    double e[4], u[4];          // e[0] = e(k), u[1] = u(k-1), ...
+    double lo, hi;
+} REF_IIR;
+
+static double refIir(REF_IIR *r, double e)
+{
+    double u = 0;
+    uint16_t i;
+
+    for(i = r->n; i > 0; i--)
+    {
+        r->e[i] = r->e[i - 1];
+    }
+    r->e[0] = e;
+
+    for(i = 0; i <= r->n; i++)
+    {
+        u += r->b[i] * r->e[i];
+    }
+    for(i = 1; i <= r->n; i++)
+    {
+        u -= r->a[i - 1] * r->u[i];
+    }
+    u = (u < r->lo) ? r->lo : ((u > r->hi) ? r->hi : u);
+
+    for(i = r->n; i > 1; i--)
+    {
+        r->u[i] = r->u[i - 1];
+    }
+    r->u[1] = u;
+
+    return(u);
+}
+
+//
+// refInit - Zero history, limits lo and hi
+//
+static void refInit(REF_IIR *r, const double *b, const double *a,
+                    uint16_t n, double lo, double hi)
+{
+    memset(r, 0, sizeof(*r));
+    r->b = b;
+    r->a = a;
+    r->n = n;
+    r->lo = lo;
+    r->hi = hi;
+}
+
+//
+// error - Error sequence: +STEP_E, turning to -STEP_E at sample turn
+//
+static double error(uint16_t k, uint16_t turn)
+{
+    return((k < turn) ? STEP_E : -STEP_E);
+}
+
+//
+// check2p2z - Both 2p2z kernels against the reference; returns the last
+//             float32 output. tol is per sample for the Q24 kernel.
+//
+static double check2p2z(double lo, double hi, uint16_t turn, double tol)
+{
+    CNTL_2P2Z_F32 f;
+    CNTL_2P2Z_Q24 q;
+    REF_IIR r;
+    double ref, maxF = 0, maxQ = 0;
+    float uf, ef;
+    int32_t uq, eq;
+    uint16_t k;
+
+    f.b0 = b2p[0]; f.b1 = b2p[1]; f.b2 = b2p[2];
+    f.a1 = a2p[0]; f.a2 = a2p[1];
+    f.outMin = lo; f.outMax = hi;
+    cntlReset2p2zF32(&f);
+
+    q.b0 = CNTL_Q24(b2p[0]); q.b1 = CNTL_Q24(b2p[1]); q.b2 = CNTL_Q24(b2p[2]);
+    q.a1 = CNTL_Q24(a2p[0]); q.a2 = CNTL_Q24(a2p[1]);
+    q.outMin = CNTL_Q24(lo); q.outMax = CNTL_Q24(hi);
+    cntlReset2p2zQ24(&q);
+
+    refInit(&r, b2p, a2p, 2, lo, hi);
+
+    for(k = 0; k < STEPS; k++)
+    {
+        ef = error(k, turn);
+        eq = CNTL_Q24(error(k, turn));
+        ref = refIir(&r, error(k, turn));
+
+        uf = cntlRun2p2zF32(&f, ef);
+        cntlUpdate2p2zF32(&f, ef, uf);
+        uq = cntlRun2p2zQ24(&q, eq);
+        cntlUpdate2p2zQ24(&q, eq, uq);
+
+        maxF = fmax(maxF, fabs(uf - ref));
+        maxQ = fmax(maxQ, fabs(Q24_TO_D(uq) - ref));
+        HOST_CHECK((uf >= (float)lo) && (uf <= (float)hi));
+        HOST_CHECK((uq >= q.outMin) && (uq <= q.outMax));
+    }
+    HOST_CHECK(maxF < 1e-5);
+    HOST_CHECK(maxQ < tol);
+
+    return(uf);
+}
+
+//
+// check3p3z - Both 3p3z kernels against the reference, as check2p2z()
+//
+static double check3p3z(double lo, double hi, uint16_t turn, double tol)
+{
+    CNTL_3P3Z_F32 f;
+    CNTL_3P3Z_Q24 q;
+    REF_IIR r;
+    double ref, maxF = 0, maxQ = 0;
+    float uf, ef;
+    int32_t uq, eq;
+    uint16_t k;
+
+    f.b0 = b3p[0]; f.b1 = b3p[1]; f.b2 = b3p[2]; f.b3 = b3p[3];
+    f.a1 = a3p[0]; f.a2 = a3p[1]; f.a3 = a3p[2];
+    f.outMin = lo; f.outMax = hi;
+    cntlReset3p3zF32(&f);
+
+    q.b0 = CNTL_Q24(b3p[0]); q.b1 = CNTL_Q24(b3p[1]);
+    q.b2 = CNTL_Q24(b3p[2]); q.b3 = CNTL_Q24(b3p[3]);
+    q.a1 = CNTL_Q24(a3p[0]); q.a2 = CNTL_Q24(a3p[1]);
+    q.a3 = CNTL_Q24(a3p[2]);
+    q.outMin = CNTL_Q24(lo); q.outMax = CNTL_Q24(hi);
+    cntlReset3p3zQ24(&q);
+
+    refInit(&r, b3p, a3p, 3, lo, hi);
+
+    for(k = 0; k < STEPS; k++)
+    {
+        ef = error(k, turn);
+        eq = CNTL_Q24(error(k, turn));
+        ref = refIir(&r, error(k, turn));
+
+        uf = cntlRun3p3zF32(&f, ef);
+        cntlUpdate3p3zF32(&f, ef, uf);
+        uq = cntlRun3p3zQ24(&q, eq);
+        cntlUpdate3p3zQ24(&q, eq, uq);
+
+        maxF = fmax(maxF, fabs(uf - ref));
+        maxQ = fmax(maxQ, fabs(Q24_TO_D(uq) - ref));
+        HOST_CHECK((uf >= (float)lo) && (uf <= (float)hi));
+        HOST_CHECK((uq >= q.outMin) && (uq <= q.outMax));
+    }
+    HOST_CHECK(maxF < 1e-5);
+    HOST_CHECK(maxQ < tol);
+
+    return(uf);
+}
+
+//
+// checkPi - Both PI kernels: u(k) = kp e(k) + i(k), i(k) = i(k-1) + ki e(k),
+//           integrator clamped to the limits. Returns the last output.
+//
+static double checkPi(double kp, double ki, double lo, double hi,
+                      uint16_t turn)
+{
+    CNTL_PI_F32 f;
+    CNTL_PI_Q24 q;
+    double e, i = 0, ref, maxF = 0, maxQ = 0;
+    float uf;
+    int32_t uq;
+    uint16_t k;
+
+    f.kp = kp; f.ki = ki;
+    f.outMin = lo; f.outMax = hi;
+    cntlResetPiF32(&f);
+
+    q.kp = CNTL_Q24(kp); q.ki = CNTL_Q24(ki);
+    q.outMin = CNTL_Q24(lo); q.outMax = CNTL_Q24(hi);
+    cntlResetPiQ24(&q);
+
+    for(k = 0; k < STEPS; k++)
+    {
+        e = error(k, turn);
+        ref = kp * e + i + ki * e;
+        ref = (ref < lo) ? lo : ((ref > hi) ? hi : ref);
+        i += ki * e;
+        i = (i < lo) ? lo : ((i > hi) ? hi : i);
+
+        uf = cntlRunPiF32(&f, e);
+        cntlUpdatePiF32(&f, e);
+        uq = cntlRunPiQ24(&q, CNTL_Q24(e));
+        cntlUpdatePiQ24(&q, CNTL_Q24(e));
+
+        maxF = fmax(maxF, fabs(uf - ref));
+        maxQ = fmax(maxQ, fabs(Q24_TO_D(uq) - ref));
+    }
+    HOST_CHECK(maxF < 1e-5);
+
+    //
+    // The Q24 integrator is off by the rounding of ki and e plus the
+    // truncation, under 2 LSBs per sample
+    //
+    HOST_CHECK(maxQ < 2.0 * STEPS / 16777216.0);
+
+    return(uf);
+}
+
+//
+// Main
+//
+int main(void)
+{
+    double u;
+
+    //
+    // Unclamped: settle on the DC gain times the step. The Q24 error is
+    // the coefficient rounding amplified by the slowest pole, 1 / (1 -
+    // 0.835) for the 2p2z and 1 / (1 - 0.724) for the 3p3z.
+    //
+    u = check2p2z(-10.0, 10.0, STEPS, 1e-5);
+    HOST_CHECK(fabs(u - 2.0 * STEP_E) < 1e-4);
+    u = check3p3z(-10.0, 10.0, STEPS, 1e-5);
+    HOST_CHECK(fabs(u - 2.5 * STEP_E) < 1e-4);
+
+    //
+    // Clamped below the DC value: the outputs stop on the limit, and with
+    // the step reversed halfway they leave it with the reference
+    //
+    u = check2p2z(-0.15, 0.15, STEPS, 1e-5);
+    HOST_CHECK(u == 0.15f);
+    check2p2z(-0.15, 0.15, STEPS / 2, 1e-5);
+    u = check3p3z(-0.15, 0.15, STEPS, 1e-5);
+    HOST_CHECK(u == 0.15f);
+    check3p3z(-0.15, 0.15, STEPS / 2, 1e-5);
+
+    //
+    // PI: a ramp from kp e + ki e into outMax. Reversed halfway, it ramps
+    // down into outMin from outMax, where the integrator stopped.
+    //
+    u = checkPi(0.5, 0.05, 0.0, 0.95, STEPS);
+    HOST_CHECK(u == 0.95f);
+    u = checkPi(0.5, 0.05, 0.0, 0.95, STEPS / 2);
+    HOST_CHECK(u == 0.0f);
+    checkPi(0.5, 0.05, 0.0, 0.95, 10);
+
+    printf("test_compensator: %u failures\n", hostFailures);
+    return(hostFailures != 0);
+}
+
+//
+// End of File
+//
@@ -0,0 +1,524 @@
+//###########################################################################
+//
+// FILE:   test_epwm_sim.c
+//
+// TITLE:  ePWM outputs of the table-driven configuration, simulated.
+//
+// Configures ePWM1..6 with the modified3 application's configHRPWM()
+// (EPWM_TABLE.h) and checks the simulated pins: period, duty, sync chain
+// phase, dead band, MEP edge placement for HR_CMP and HR_PHS, the
+// one-shot global load of HRPWM_UPDATE.h and updateHRPWM()'s pacing, the
+// IBC_DRIVER.h phase spread, shedding and hysteresis, and the trip zone
+// with its digital compare input.
+// The edges of all 12 outputs are left in epwm_sim.vcd in the test
+// directory.
+//
+//###########################################################################
+
+//
+// Included Files
+//
+#include <stdlib.h>
+
+#include "F28x_Project.h"
+#include "host_regs.h"
+#include "epwm_sim.h"
+
+//
+// Defines
+//
+#define PERIOD                  500
+#define TB                      EPWM_SIM_SYSCLK_FS  // TBCLK = SYSCLK
+#define CYCLE                   (2ULL * PERIOD)     // TBCLKs, up-down
+
+//
+// The application, built into the test with its main() renamed, so its
+// configHRPWM() and the HRPWM_UPDATE.h/IBC_DRIVER.h types and state can
+// be used directly
+//
+#define main appMain
+#include "hrpwm_ex2_prdupdown_sfo_v9_noman_modified3.c"
+#undef main
+
+//
+// Globals
+//
+static uint32_t socaCount;
+
+//
+// soca - SOCA hook, counts the ePWM1 pulses
+//
+static void soca(uint16_t module)
+{
+    if(module == 1)
+    {
+        socaCount++;
+    }
+}
+
+//
+// last - Time of the back-th most recent edge of output o to level
+//
+static uint64_t last(uint16_t o, uint16_t level, uint16_t back)
+{
+    const EPWM_SIM_EDGE *e;
+    uint32_t n;
+
+    e = epwmSimEdges(o, &n);
+    while(n--)
+    {
+        if((e[n].level == level) && (back-- == 0))
+        {
+            return(e[n].t);
+        }
+    }
+
+    return(0);
+}
+
+//
+// high - Width of the last complete high pulse of output o
+//
+static uint64_t high(uint16_t o)
+{
+    uint64_t fall = last(o, 0, 0);
+    uint64_t rise = last(o, 1, 0);
+
+    if(rise > fall)
+    {
+        rise = last(o, 1, 1);
+    }
+
+    return(fall - rise);
+}
+
+//
+// lead - How much earlier the last rising edge of output o comes than the
+//        nearest one of ePWM1A, within half a cycle
+//
+static int64_t lead(uint16_t o)
+{
+    int64_t d = (int64_t)last(0, 1, 0) - (int64_t)last(o, 1, 0);
+    int64_t cycle = (int64_t)(CYCLE * TB);
+
+    while(d > cycle / 2)
+    {
+        d -= cycle;
+    }
+    while(d <= -cycle / 2)
+    {
+        d += cycle;
+    }
+
+    return(d);
+}
+
+//
+// checkPacing - updateHRPWM() refuses a set until the master's CTR = 0
+//               has latched the last one, and a caller once per period
+//               away from CTR = 0 gets every set through
+//
+static void checkPacing(void)
+{
+    HRPWM_UPDATE upd = {&EPwm2Regs, PERIOD, 0, 100, 0, PERIOD / 2, 0, 0, 0};
+    uint32_t loads, skips, wait;
+    uint16_t i, n;
+
+    //
+    // Counting up from PERIOD / 2: 1.5 periods to the latch
+    //
+    while((EPwm1Regs.TBCTR != PERIOD / 2) ||
+          (EPwm1Regs.TBSTS.bit.CTRDIR != 1))
+    {
+        epwmSimRun(1);
+    }
+    loads = epwmSim[1].globalLoads;
+    skips = hrpwmGldSkips;
+
+    HOST_CHECK(updateHRPWM(&upd, 1) == 1);
+    wait = CYCLE - PERIOD / 2 + HRPWM_GLD_MARGIN;      // SYSCLKs
+    HOST_CHECK(hrpwmGldWait == wait);
+
+    //
+    // Refused, registers untouched, until the wait is over
+    //
+    upd.cmpa = 150;
+    HOST_CHECK(updateHRPWM(&upd, 1) == 0);
+    HOST_CHECK(EPwm2Regs.CMPA.bit.CMPA == 100);
+    epwmSimRun(wait - 1);
+    HOST_CHECK(epwmSim[1].globalLoads == loads + 1);
+    HOST_CHECK(updateHRPWM(&upd, 1) == 0);
+    HOST_CHECK(hrpwmGldSkips == skips + 2);
+    epwmSimRun(1);
+    HOST_CHECK(updateHRPWM(&upd, 1) == 1);
+    HOST_CHECK(EPwm2Regs.CMPA.bit.CMPA == 150);
+
+    //
+    // Once per period, HRPWM_GLD_MARGIN + 2 TBCLKs after CTR = 0
+    //
+    epwmSimRun(CYCLE);
+    while((EPwm1Regs.TBCTR != HRPWM_GLD_MARGIN + 2) ||
+          (EPwm1Regs.TBSTS.bit.CTRDIR != 1))
+    {
+        epwmSimRun(1);
+    }
+    loads = epwmSim[1].globalLoads;
+    n = 0;
+    for(i = 0; i < 20; i++)
+    {
+        upd.cmpa = 100 + i;
+        n += updateHRPWM(&upd, 1);
+        epwmSimRun(CYCLE);
+        HOST_CHECK((epwmSim[1].cmpa >> 16) == 100 + i);
+    }
+    HOST_CHECK(n == 20);
+    HOST_CHECK(epwmSim[1].globalLoads == loads + 20);
+    HOST_CHECK(hrpwmGldSkips == skips + 2);
+}
+
+//
+// ibcStep - One modulate/update/commit pass of d, then four periods
+//
+static void ibcStep(IBC_DRV *d, const HRPWM_UPDATE *upd)
+{
+    ibcModulate(d);
+    while(updateHRPWM(upd, IBC_MAX_PHASES - 1) == 0)
+    {
+        epwmSimRun(1);
+    }
+    HOST_CHECK(ibcCommit(d) == 1);
+    epwmSimRun(4 * CYCLE);
+}
+
+//
+// ibcSpread - # of ePWM2..active outputs not lagging ePWM1A by k/active of
+//             the period, to within the coarse TBPHS step plus the HR
+//             phase shift, two TBCLKs
+//
+static uint16_t ibcSpread(uint16_t active)
+{
+    int64_t lag, cycle = (int64_t)(CYCLE * TB);
+    uint16_t k, bad = 0;
+
+    for(k = 1; k < active; k++)
+    {
+        lag = -(cycle * k / active);
+        if(lag <= -cycle / 2)
+        {
+            lag += cycle;
+        }
+        bad += (llabs(lead(EPWM_SIM_OUT(k + 1, 'A')) - lag) > 2 * (int64_t)TB);
+    }
+
+    return(bad);
+}
+
+//
+// ibcPulses - # of high pulses of output o that started after t and are
+//             not PERIOD wide
+//
+static uint16_t ibcPulses(uint16_t o, uint64_t t)
+{
+    const EPWM_SIM_EDGE *e;
+    uint32_t n, i;
+    uint16_t bad = 0;
+
+    e = epwmSimEdges(o, &n);
+    for(i = 0; i + 1 < n; i++)
+    {
+        if((e[i].t > t) && (e[i].level == 1))
+        {
+            bad += (e[i + 1].t - e[i].t != PERIOD * TB);
+        }
+    }
+
+    return(bad);
+}
+
+//
+// checkIBC - Six phases on ePWM1..6: even spread, shedding to three with
+//            the shed legs parked low on a period boundary, adding them
+//            back, and ibcAutoPhase()'s hysteresis
+//
+static void checkIBC(void)
+{
+    HRPWM_UPDATE upd[IBC_MAX_PHASES - 1];
+    IBC_DRV d;
+    uint32_t edges[IBC_MAX_PHASES + 1], n;
+    uint64_t t;
+    uint16_t i, cap;
+
+    EPwm3Regs.DBRED = 0;
+    EPwm3Regs.DBFED = 0;
+    for(i = 0; i < IBC_MAX_PHASES - 1; i++)
+    {
+        upd[i].regs = ePWM[i + 2];
+        upd[i].tbprd = PERIOD;
+        upd[i].tbprdhr = 0;
+        upd[i].cmpa = PERIOD / 2;
+        upd[i].cmpahr = 0;
+        upd[i].cmpb = PERIOD / 2;
+        upd[i].cmpbhr = 0;
+        upd[i].tbphs = 0;
+        upd[i].tbphshr = 0;
+    }
+
+    //
+    // All six active: slave k lags by k/6, from the table set up in Flash
+    //
+    initIBC(&d, &EPwm1Regs, upd, IBC_MAX_PHASES, PERIOD);
+    HOST_CHECK(d.active == 6);
+    for(i = 0; i < IBC_MAX_PHASES - 1; i++)
+    {
+        HOST_CHECK(d.lag[i] == (uint16_t)(0x10000UL * (i + 1) / 6));
+    }
+    ibcStep(&d, upd);
+    HOST_CHECK(ibcSpread(6) == 0);
+    HOST_CHECK(ibcCommit(&d) == 0);
+    HOST_CHECK(d.skips == 1);
+
+    //
+    // Shed to three: thirds for ePWM2/3, ePWM4..6 keep their lag and are
+    // parked low after a last full pulse
+    //
+    HOST_CHECK(ibcSetActive(&d, 3) == 3);
+    HOST_CHECK(d.changes == 1);
+    HOST_CHECK(d.lag[0] == 0x5555);
+    HOST_CHECK(d.lag[1] == 0xAAAA);
+    HOST_CHECK(d.lag[2] == 0x8000);
+    HOST_CHECK(ibcSetActive(&d, 3) == 3);
+    HOST_CHECK(d.changes == 1);
+
+    t = epwmSimTime;
+    ibcStep(&d, upd);
+    HOST_CHECK(ibcSpread(3) == 0);
+    for(i = 4; i <= 6; i++)
+    {
+        HOST_CHECK(ePWM[i]->AQCSFRC.all == 0x5);    // CSFA = CSFB = low
+        HOST_CHECK(ibcPulses(EPWM_SIM_OUT(i, 'A'), t) == 0);
+        epwmSimEdges(EPWM_SIM_OUT(i, 'A'), &edges[i]);
+    }
+    HOST_CHECK(EPwm2Regs.AQCSFRC.all == 0);
+    HOST_CHECK(EPwm3Regs.AQCSFRC.all == 0);
+
+    epwmSimRun(4 * CYCLE);
+    for(i = 4; i <= 6; i++)
+    {
+        epwmSimEdges(EPWM_SIM_OUT(i, 'A'), &n);
+        HOST_CHECK(n == edges[i]);
+        HOST_CHECK(epwmSimLevel(EPWM_SIM_OUT(i, 'A')) == 0);
+        HOST_CHECK(epwmSimLevel(EPWM_SIM_OUT(i, 'B')) == 0);
+    }
+
+    //
+    // Back to six: the parked legs start again with full pulses
+    //
+    HOST_CHECK(ibcSetActive(&d, 9) == 6);
+    t = epwmSimTime;
+    ibcStep(&d, upd);
+    HOST_CHECK(ibcSpread(6) == 0);
+    for(i = 4; i <= 6; i++)
+    {
+        HOST_CHECK(ePWM[i]->AQCSFRC.all == 0);
+        HOST_CHECK(ibcPulses(EPWM_SIM_OUT(i, 'A'), t) == 0);
+        epwmSimEdges(EPWM_SIM_OUT(i, 'A'), &n);
+        HOST_CHECK(n >= edges[i] + 6);
+    }
+
+    //
+    // Hysteresis: a phase is added as soon as the load needs it, and shed
+    // one at a time once the load is a hysteresis below the capacity
+    //
+    cap = d.capacity;
+    HOST_CHECK(ibcAutoPhase(&d, 0xFFFF) == 6);
+    HOST_CHECK(ibcAutoPhase(&d, 3 * cap) == 5);
+    HOST_CHECK(ibcAutoPhase(&d, 3 * cap) == 4);
+    HOST_CHECK(ibcAutoPhase(&d, 3 * cap) == 4);
+    HOST_CHECK(ibcAutoPhase(&d, 3 * cap - d.hysteresis) == 4);
+    HOST_CHECK(ibcAutoPhase(&d, 3 * cap - d.hysteresis - 1) == 3);
+    HOST_CHECK(d.lag[1] == 0xAAAA);
+    HOST_CHECK(ibcAutoPhase(&d, 3 * cap + 1) == 4);
+    HOST_CHECK(d.lag[2] == 0xC000);
+}
+
+//
+// Main
+//
+int main(void)
+{
+    uint32_t n, m;
+
+    hostReset();
+    epwmSimReset();
+    EPwm1Regs.HRMSTEP.bit.HRMSTEP = 60;     // Matches epwmSimMepSf
+    epwmSimSocaHook = soca;
+
+    configHRPWM(PERIOD);
+    HOST_CHECK(CpuSysRegs.PCLKCR0.bit.TBCLKSYNC == 1);
+    HOST_CHECK(EPwm2Regs.TBCTL.bit.SWFSYNC == 1);
+
+    //
+    // ePWM1 syncs the chain on CTR = 0. ePWM2 leads it by 98 TBCLKs, ePWM3
+    // and ePWM4 follow 2 TBCLKs behind (TBPHS = 0), ePWM3 with dead band
+    // and ePWM4B with half a TBCLK of HR phase
+    //
+    EPwm1Regs.TBCTL.bit.SYNCOSEL = TB_CTR_ZERO;
+    EPwm1Regs.ETSEL.bit.SOCASEL = 1;
+    EPwm1Regs.ETSEL.bit.SOCAEN = 1;
+    EPwm1Regs.ETPS.bit.SOCAPRD = 1;
+    EPwm2Regs.TBPHS.bit.TBPHS = 100;
+    EPwm2Regs.TBCTL.bit.PHSDIR = TB_UP;
+    EPwm3Regs.DBRED = 20;
+    EPwm3Regs.DBFED = 20;
+    EPwm4Regs.TBPHS.bit.TBPHSHR = 128 << 8;
+    EPwm4Regs.TBCTL.bit.PHSDIR = TB_UP;
+
+    epwmSimRun(20 * CYCLE);
+    HOST_CHECK(EPwm2Regs.TBCTL.bit.SWFSYNC == 0);
+    HOST_CHECK(CpuTimer1Regs.TIM.all == 0xFFFFFFFF - 20 * CYCLE);
+
+    //
+    // Period and 50% duty (CMPAHR = 1 << 8 is below one MEP step)
+    //
+    HOST_CHECK(last(0, 1, 0) - last(0, 1, 1) == CYCLE * TB);
+    HOST_CHECK(high(0) == PERIOD * TB);
+    HOST_CHECK(socaCount == 20);
+    HOST_CHECK(epwmSim[0].socs == 20);
+    HOST_CHECK(EPwm1Regs.ETFLG.bit.SOCA == 1);
+
+    //
+    // Phase
+    //
+    HOST_CHECK(lead(EPWM_SIM_OUT(2, 'A')) == 98 * TB);
+    HOST_CHECK(lead(EPWM_SIM_OUT(4, 'A')) == -2 * (int64_t)TB);
+    HOST_CHECK(epwmSim[1].syncs >= 20);
+    HOST_CHECK(epwmSim[2].syncs >= 20);
+
+    //
+    // Dead band: RED takes 20 TBCLKs off ePWM3A, FED adds them to ePWM3B
+    //
+    HOST_CHECK(lead(EPWM_SIM_OUT(3, 'A')) == -22 * (int64_t)TB);
+    HOST_CHECK(high(EPWM_SIM_OUT(3, 'A')) == (PERIOD - 20) * TB);
+    HOST_CHECK(high(EPWM_SIM_OUT(3, 'B')) == (PERIOD + 20) * TB);
+
+    //
+    // HR_PHS: 0.5 TBCLK of TBPHSHR, loaded counting up, moves the ePWM4B
+    // edges 5 ns ahead of the ePWM4A ones on the same event
+    //
+    HOST_CHECK(last(EPWM_SIM_OUT(4, 'B'), 1, 0) + TB / 2 ==
+               last(EPWM_SIM_OUT(4, 'A'), 0, 0));
+
+    HOST_CHECK(epwmSimWriteVcd("epwm_sim.vcd") == 0);
+
+    //
+    // HR_CMP: half a TBCLK of CMPAHR delays the up-count edge and advances
+    // the down-count one, 30 MEP steps of 1/60 TBCLK each
+    //
+    EPwm1Regs.CMPA.bit.CMPAHR = 128 << 8;
+    epwmSimRun(3 * CYCLE);
+    HOST_CHECK(high(0) == PERIOD * TB + TB);
+
+    //
+    // A stale HRMSTEP (silicon now at 66 steps per TBCLK) shortens it
+    //
+    epwmSimMepSf = 66;
+    epwmSimRun(3 * CYCLE);
+    HOST_CHECK(high(0) == PERIOD * TB + 2 * (30 * TB / 66));
+    epwmSimMepSf = 60;
+
+    //
+    // One-shot global load: the new CMPA waits for OSHTLD on the master
+    //
+    initHRPWMGlobalLoad(&ePWM[1], 6, &EPwm1Regs, HRPWM_LINK_EPWM1);
+    HOST_CHECK(hrpwmGldCycle == CYCLE);
+    HOST_CHECK(hrpwmGldDiv == 1);
+    EPwm2Regs.CMPA.bit.CMPA = 100;
+    epwmSimRun(3 * CYCLE);
+    HOST_CHECK((epwmSim[1].cmpa >> 16) == PERIOD / 2);
+    HOST_CHECK(epwmSim[1].globalLoads == 0);
+
+    EPwm1Regs.GLDCTL2.bit.OSHTLD = 1;
+    epwmSimRun(3 * CYCLE);
+    HOST_CHECK(EPwm1Regs.GLDCTL2.bit.OSHTLD == 0);
+    HOST_CHECK((epwmSim[1].cmpa >> 16) == 100);
+    HOST_CHECK(epwmSim[1].globalLoads == 1);
+    HOST_CHECK(epwmSim[5].globalLoads == 1);
+    HOST_CHECK(high(EPWM_SIM_OUT(2, 'A')) == 200 * TB);
+
+    checkPacing();
+    checkIBC();
+
+    //
+    // Trip zone: ePWM5 forced low, ePWM6 tri-stated
+    //
+    EALLOW;
+    EPwm5Regs.TZCTL.bit.TZA = 2;
+    EPwm5Regs.TZCTL.bit.TZB = 2;
+    EPwm6Regs.TZCTL.bit.TZA = 0;
+    EPwm6Regs.TZCTL.bit.TZB = 0;
+    EPwm5Regs.TZFRC.bit.OST = 1;
+    EPwm6Regs.TZFRC.bit.OST = 1;
+    EDIS;
+
+    epwmSimRun(1);
+    epwmSimEdges(EPWM_SIM_OUT(5, 'A'), &n);
+    epwmSimRun(3 * CYCLE);
+    epwmSimEdges(EPWM_SIM_OUT(5, 'A'), &m);
+    HOST_CHECK(m == n);
+    HOST_CHECK(EPwm5Regs.TZFLG.bit.OST == 1);
+    HOST_CHECK(epwmSimLevel(EPWM_SIM_OUT(5, 'A')) == 0);
+    HOST_CHECK(epwmSimLevel(EPWM_SIM_OUT(5, 'B')) == 0);
+    HOST_CHECK(epwmSimLevel(EPWM_SIM_OUT(6, 'A')) == EPWM_SIM_Z);
+    HOST_CHECK(epwmSimLevel(EPWM_SIM_OUT(6, 'B')) == EPWM_SIM_Z);
+
+    EALLOW;
+    EPwm5Regs.TZCLR.bit.OST = 1;
+    EDIS;
+    epwmSimRun(3 * CYCLE);
+    epwmSimEdges(EPWM_SIM_OUT(5, 'A'), &m);
+    HOST_CHECK(EPwm5Regs.TZFLG.bit.OST == 0);
+    HOST_CHECK(m > n + 4);
+
+    //
+    // Digital compare: TRIPIN4 high trips ePWM5 through DCAEVT1 and trips
+    // it again after a TZCLR.OST while it stays high
+    //
+    EALLOW;
+    EPwm5Regs.TZCLR.all = 0xFF;
+    EPwm5Regs.DCTRIPSEL.bit.DCAHCOMPSEL = 3;
+    EPwm5Regs.TZDCSEL.bit.DCAEVT1 = 2;
+    EPwm5Regs.TZSEL.bit.DCAEVT1 = 1;
+    EDIS;
+    epwmSimRun(CYCLE);
+    HOST_CHECK(EPwm5Regs.TZFLG.all == 0);
+
+    epwmSimTripIn = 1 << 3;
+    epwmSimRun(2);
+    HOST_CHECK(EPwm5Regs.TZFLG.bit.DCAEVT1 == 1);
+    HOST_CHECK(EPwm5Regs.TZFLG.bit.OST == 1);
+    HOST_CHECK(EPwm5Regs.TZFLG.bit.INT == 1);
+    HOST_CHECK(EPwm6Regs.TZFLG.bit.DCAEVT1 == 0);
+    HOST_CHECK(epwmSimLevel(EPWM_SIM_OUT(5, 'A')) == 0);
+
+    EALLOW;
+    EPwm5Regs.TZCLR.all = 0x0005;       // OST, INT
+    EDIS;
+    epwmSimRun(2);
+    HOST_CHECK(EPwm5Regs.TZFLG.bit.OST == 1);
+
+    epwmSimTripIn = 0;
+    EALLOW;
+    EPwm5Regs.TZCLR.all = 0x000D;       // OST, DCAEVT1, INT
+    EDIS;
+    epwmSimRun(CYCLE);
+    HOST_CHECK(EPwm5Regs.TZFLG.all == 0);
+    epwmSimEdges(EPWM_SIM_OUT(5, 'A'), &n);
+    HOST_CHECK(n > m);
+
+    printf("test_epwm_sim: %u failures\n", hostFailures);
+    return(hostFailures != 0);
+}
+
+//
+// End of File
+//
@@ -0,0 +1,203 @@
+//###########################################################################
+//
+// FILE:   test_epwm_table.c
+//
+// TITLE:  configEPWMTable() against the unrolled configHRPWM() it replaced.
+//
+// Runs modified3's table-driven configHRPWM() and the baseline's unrolled
+// one (base_config.c) from the same reset state and compares the ePWM1..6
+// register images word by word; they must match exactly. Each run also
+// counts the stores that reach the ePWM frames: the frames are mapped
+// read-only, every store faults, and the handler counts it and
+// single-steps the store with the page open (x86-64 Linux only, skipped
+// elsewhere).
+//
+//###########################################################################
+
+//
+// ucontext register names (REG_EFL) are a GNU extension
+//
+#define _GNU_SOURCE
+
+//
+// Included Files
+//
+#include <signal.h>
+#include <stdint.h>
+#include <sys/mman.h>
+#include <ucontext.h>
+#include <unistd.h>
+
+#include "F28x_Project.h"
+#include "host_regs.h"
+
+//
+// Defines
+//
+#define MODULES                 6
+#define PERIOD                  500
+#define WORDS                   (sizeof(struct EPWM_REGS) / sizeof(Uint16))
+
+#if defined(__x86_64__) && defined(__linux__)
+#define COUNT_WRITES            1
+#define EFLAGS_TF               0x100   // Trap after the next instruction
+#else
+#define COUNT_WRITES            0
+#endif
+
+//
+// Application functions (hrpwm_ex2_prdupdown_sfo_v9_noman_modified3.c,
+// base_config.c)
+//
+extern void configHRPWM(uint16_t period);
+extern void baseConfigHRPWM(uint16_t period);
+
+//
+// Globals
+//
+static Uint16 table[MODULES][WORDS];
+static Uint16 base[MODULES][WORDS];
+static uint32_t writes[MODULES];
+static uint32_t tableWrites[MODULES];
+static uintptr_t frameStart, frameEnd;          // ePWM1..6
+static uintptr_t pageStart, pageEnd;
+
+#if COUNT_WRITES
+//
+// onStore - A store to the read-only frames: count it, open the pages and
+//           trap after the store to close them again
+//
+static void onStore(int sig, siginfo_t *si, void *ctx)
+{
+    uintptr_t a = (uintptr_t)si->si_addr;
+
+    if((a < pageStart) || (a >= pageEnd))
+    {
+        signal(SIGSEGV, SIG_DFL);       // Not ours, fault for real
+        return;
+    }
+
+    if((a >= frameStart) && (a < frameEnd))
+    {
+        writes[(a - frameStart) / sizeof(struct EPWM_REGS)]++;
+    }
+
+    mprotect((void *)pageStart, pageEnd - pageStart, PROT_READ | PROT_WRITE);
+    ((ucontext_t *)ctx)->uc_mcontext.gregs[REG_EFL] |= EFLAGS_TF;
+}
+
+//
+// onStep - The store has completed; protect the frames again
+//
+static void onStep(int sig, siginfo_t *si, void *ctx)
+{
+    mprotect((void *)pageStart, pageEnd - pageStart, PROT_READ);
+    ((ucontext_t *)ctx)->uc_mcontext.gregs[REG_EFL] &= ~EFLAGS_TF;
+}
+#endif
+
+//
+// run - Configure from reset with config, keeping the image in image[]
+//       and the store counts in writes[]
+//
+static void run(void (*config)(uint16_t), Uint16 image[][WORDS])
+{
+    uint16_t m;
+
+    hostReset();
+    memset(writes, 0, sizeof(writes));
+
+#if COUNT_WRITES
+    mprotect((void *)pageStart, pageEnd - pageStart, PROT_READ);
+#endif
+    config(PERIOD);
+#if COUNT_WRITES
+    mprotect((void *)pageStart, pageEnd - pageStart, PROT_READ | PROT_WRITE);
+#endif
+
+    for(m = 0; m < MODULES; m++)
+    {
+        memcpy(image[m], (const void *)(frameStart +
+               m * sizeof(struct EPWM_REGS)), sizeof(image[m]));
+    }
+}
+
+//
+// diff - # of register words that differ between the two images; each
+//        difference is printed
+//
+static uint32_t diff(void)
+{
+    uint32_t bad = 0;
+    uint16_t m, w;
+
+    for(m = 0; m < MODULES; m++)
+    {
+        for(w = 0; w < WORDS; w++)
+        {
+            if(table[m][w] != base[m][w])
+            {
+                printf("ePWM%u +0x%02X: table 0x%04X, unrolled 0x%04X\n",
+                       m + 1, w, table[m][w], base[m][w]);
+                bad++;
+            }
+        }
+    }
+
+    return(bad);
+}
+
+//
+// Main
+//
+int main(void)
+{
+    long page = sysconf(_SC_PAGESIZE);
+    uint16_t m;
+
+    frameStart = (uintptr_t)&EPwm1Regs;
+    frameEnd = frameStart + MODULES * sizeof(struct EPWM_REGS);
+    pageStart = frameStart & ~(uintptr_t)(page - 1);
+    pageEnd = (frameEnd + page - 1) & ~(uintptr_t)(page - 1);
+    HOST_CHECK((uintptr_t)&EPwm6Regs == frameEnd - sizeof(struct EPWM_REGS));
+
+#if COUNT_WRITES
+    {
+        struct sigaction sa;
+
+        memset(&sa, 0, sizeof(sa));
+        sa.sa_flags = SA_SIGINFO;
+        sa.sa_sigaction = onStore;
+        sigaction(SIGSEGV, &sa, NULL);
+        sa.sa_sigaction = onStep;
+        sigaction(SIGTRAP, &sa, NULL);
+    }
+#endif
+
+    run(configHRPWM, table);
+    memcpy(tableWrites, writes, sizeof(writes));
+    run(baseConfigHRPWM, base);
+
+    HOST_CHECK(diff() == 0);
+
+#if COUNT_WRITES
+    for(m = 0; m < MODULES; m++)
+    {
+        printf("ePWM%u stores: table %u, unrolled %u\n", m + 1,
+               tableWrites[m], writes[m]);
+
+        //
+        // One store per register, TBCTL twice where SWFSYNC is strobed
+        //
+        HOST_CHECK(tableWrites[m] == ((m == 0) ? 13 : 14));
+        HOST_CHECK(tableWrites[m] < writes[m]);
+    }
+#endif
+
+    printf("test_epwm_table: %u failures\n", hostFailures);
+    return(hostFailures != 0);
+}
+
+//
+// End of File
+//
@@ -0,0 +1,214 @@
+//###########################################################################
+//
+// FILE:   test_hrpwm_math.c
+//
+// TITLE:  HRPWM_MATH.h kernels, bit for bit against reference arithmetic.
+//
+// Each kernel is checked over its input range against a reference that
+// computes the same quantity from its definition, in 64-bit integers or
+// in doubles where every intermediate is exact, rather than by the
+// kernel's own shift-and-multiply steps. The edges are covered explicitly:
+// ADC codes 0 and full scale, duty 0 and the largest Q16 duty (1 is not
+// representable), and phases and lags at 0, 0x8000 and 0xFFFF.
+//
+//###########################################################################
+
+//
+// Included Files
+//
+#include <stdlib.h>
+
+#include "F28x_Project.h"
+#include "host_regs.h"
+#include "HRPWM_MATH.h"
+
+//
+// Defines
+//
+#define Q16_MAX                 0xFFFF      // Largest Q16 fraction, 1 - 2^-16
+
+//
+// refFloorDiv - floor(n / d) for d > 0
+//
+static int64_t refFloorDiv(int64_t n, int64_t d)
+{
+    int64_t q = n / d;
+
+    return(((n % d) != 0 && (n < 0)) ? q - 1 : q);
+}
+
+//
+// refAdcToQ16 - adc * gain (Q24) in Q16, rounded half up
+//
+static int32_t refAdcToQ16(uint16_t adc, int32_t gainQ24)
+{
+    return((int32_t)refFloorDiv((int64_t)adc * gainQ24 + 128, 256));
+}
+
+//
+// refScaleQ16 - counts * frac / 2^16 in 16.16; the product of two 16-bit
+//               integers is exact in a double
+//
+static uint32_t refScaleQ16(uint16_t counts, uint16_t fracQ16)
+{
+    return((uint32_t)((double)counts * (double)fracQ16));
+}
+
+//
+// refLagToSync - TBPHS:TBPHSHR and PHSDIR from the slave position the lag
+//                asks for, worked out in 64-bit 16.16 counts
+//
+static uint32_t refLagToSync(uint16_t period, uint16_t lag, uint16_t *phsdir)
+{
+    int64_t span = (int64_t)2 * period * 65536;
+    int64_t lead;
+
+    //
+    // (1 - lag) of a period ahead, plus the counts lost to the sync delay
+    //
+    lead = (65536 - (int64_t)lag) * 2 * period +
+           (int64_t)HRMATH_SYNC_DELAY * 65536;
+    lead %= span;
+
+    if(lead <= (int64_t)period * 65536)
+    {
+        *phsdir = TB_UP;
+        return((uint32_t)lead);
+    }
+
+    *phsdir = TB_DOWN;
+    return((uint32_t)(span - lead));
+}
+
+//
+// checkAdc - Every ADC code with gain for fullscale
+//
+static void checkAdc(double fullscale)
+{
+    int32_t gain = HRMATH_ADC_GAIN_Q24(fullscale);
+    uint32_t bad = 0;
+    uint16_t adc;
+
+    for(adc = 0; adc <= HRMATH_ADC_MAX; adc++)
+    {
+        bad += (hrmathAdcToQ16(adc, gain) != refAdcToQ16(adc, gain));
+    }
+    HOST_CHECK(bad == 0);
+
+    //
+    // Code 0 reads 0 and full scale reads fullscale to within the gain's
+    // rounding: half a Q24 LSB times 4095 codes is 8 Q16 LSBs, plus one
+    // for the final rounding
+    //
+    HOST_CHECK(hrmathAdcToQ16(0, gain) == 0);
+    HOST_CHECK(labs(hrmathAdcToQ16(HRMATH_ADC_MAX, gain) -
+                    HRMATH_Q16(fullscale)) <= 9);
+}
+
+//
+// checkScale - Every Q16 fraction of counts
+//
+static void checkScale(uint16_t counts)
+{
+    uint32_t bad = 0;
+    uint32_t f;
+
+    for(f = 0; f <= Q16_MAX; f++)
+    {
+        bad += (hrmathScaleQ16(counts, f) != refScaleQ16(counts, f));
+        bad += (hrmathDutyToCmp(counts, f) != refScaleQ16(counts, f));
+        bad += (hrmathPhaseToTbphs(counts, f) != refScaleQ16(counts, f));
+    }
+    HOST_CHECK(bad == 0);
+}
+
+//
+// checkLag - Every lag for period, against the reference and against the
+//            position the slave counter actually takes
+//
+static void checkLag(uint16_t period)
+{
+    uint32_t bad = 0, badPos = 0;
+    uint16_t dir, refDir;
+    uint32_t img, ref, lag;
+    int64_t span = (int64_t)2 * period * 65536;
+    int64_t pos, want;
+
+    for(lag = 0; lag <= Q16_MAX; lag++)
+    {
+        img = hrmathLagToSync(period, lag, &dir);
+        ref = refLagToSync(period, lag, &refDir);
+        bad += (img != ref) || (dir != refDir);
+
+        //
+        // A counting-down load at v sits 2 * period - v into the cycle;
+        // less the sync delay, the slave must be lag behind the master
+        //
+        pos = (dir == TB_UP) ? (int64_t)img : span - img;
+        want = (int64_t)(65536 - lag) * 2 * period % span;
+        badPos += ((pos - (int64_t)HRMATH_SYNC_DELAY * 65536 - want +
+                    2 * span) % span) != 0;
+        badPos += (img > ((uint32_t)period << 16));
+    }
+    HOST_CHECK(bad == 0);
+    HOST_CHECK(badPos == 0);
+}
+
+//
+// Main
+//
+int main(void)
+{
+    uint16_t dir;
+
+    //
+    // ADC scaling: the DC board's 82.5 V and 3.3 V channels, and the
+    // largest full scale the Q24 gain allows without overflow
+    //
+    checkAdc(82.5);
+    checkAdc(3.3);
+    checkAdc(127.99);
+    HOST_CHECK(hrmathAdcToQ16(HRMATH_ADC_COUNTS(48.0, 82.5),
+                              HRMATH_ADC_GAIN_Q24(82.5)) ==
+               refAdcToQ16(HRMATH_ADC_COUNTS(48.0, 82.5),
+                           HRMATH_ADC_GAIN_Q24(82.5)));
+
+    //
+    // Scaling, duty and phase
+    //
+    checkScale(0);
+    checkScale(1);
+    checkScale(500);
+    checkScale(1000);
+    checkScale(0xFFFF);
+
+    HOST_CHECK(hrmathDutyToCmp(500, 0) == 0);
+    HOST_CHECK(hrmathDutyToCmp(500, Q16_MAX) == ((499UL << 16) | 0xFE0C));
+    HOST_CHECK(hrmathDutyToCmp(500, 0x8000) == (250UL << 16));
+    HOST_CHECK(hrmathPhaseToTbphs(1000, 0x8000) == (500UL << 16));
+    HOST_CHECK(hrmathPhaseToTbphs(1000, Q16_MAX) == ((999UL << 16) | 0xFC18));
+    HOST_CHECK(hrmathPhaseToTbphs(0xFFFF, Q16_MAX) == 0xFFFE0001UL);
+
+    //
+    // Lag to sync over every lag, including the wrap at 0 and 0xFFFF and
+    // the mirror point at 0x8000
+    //
+    checkLag(2);
+    checkLag(500);
+    checkLag(1000);
+    checkLag(0x7FFF);
+
+    HOST_CHECK(hrmathLagToSync(500, 0, &dir) == (2UL << 16));
+    HOST_CHECK(dir == TB_UP);
+    HOST_CHECK(hrmathLagToSync(500, 0x8000, &dir) == (498UL << 16));
+    HOST_CHECK(dir == TB_DOWN);
+    HOST_CHECK(hrmathLagToSync(500, Q16_MAX, &dir) == ((2UL << 16) | 1000));
+    HOST_CHECK(dir == TB_UP);
+
+    printf("test_hrpwm_math: %u failures\n", hostFailures);
+    return(hostFailures != 0);
+}
+
+//
+// End of File
+//
@@ -0,0 +1,147 @@
+//###########################################################################
+//
+// FILE:   test_init.c
+//
+// TITLE:  Start-up path of the DC board application on the register mocks.
+//
+// Runs the TI start-up code and the application's configuration functions
+// in the order main() calls them, then one ADCA INT1, and checks the
+// register state they leave behind.
+//
+//###########################################################################
+
+//
+// Included Files
+//
+#include "F28x_Project.h"
+#include "host_regs.h"
+
+//
+// Application functions and state (hrpwm_ex2_prdupdown_sfo_v9_noman_
+// dc_board_test.c, ADC_CONFIG.h, PWM_CONFIG.h, OV_PROTECTION.h)
+//
+extern void configHRPWM(uint16_t period);
+extern void initADC(void);
+extern void initADCSOC(void);
+extern void initEPWM(void);
+extern void initADCSequencer(const uint16_t *a, uint16_t na,
+                             const uint16_t *b, uint16_t nb);
+extern void initOVProtection(volatile struct CMPSS_REGS *cmpss,
+                             uint16_t cmpssNum, uint16_t hpMux,
+                             uint16_t dacCode,
+                             volatile struct EPWM_REGS * const regs[],
+                             uint16_t count);
+extern __interrupt void adcA1ISR(void);
+extern volatile struct EPWM_REGS * const ovModules[];
+extern const uint16_t adcChannelsA[];
+extern uint16_t adcAResults2;
+extern int32_t Vout_DC;
+
+//
+// Main
+//
+int main(void)
+{
+    hostReset();
+
+    //
+    // Device start-up
+    //
+    InitSysCtrl();
+    HOST_CHECK(hostEallow == 0);
+    HOST_CHECK(hostDeviceCal == 1);
+    HOST_CHECK(WdRegs.WDCR.all == 0x0068);
+    HOST_CHECK(ClkCfgRegs.SYSPLLMULT.bit.IMULT == IMULT_10);
+    HOST_CHECK(ClkCfgRegs.SYSPLLCTL1.bit.PLLEN == 1);
+    HOST_CHECK(ClkCfgRegs.SYSPLLCTL1.bit.PLLCLKEN == 0);   // See host_regs.c
+    HOST_CHECK(CpuSysRegs.PCLKCR0.bit.HRPWM == 1);
+    HOST_CHECK(CpuSysRegs.PCLKCR2.bit.EPWM1 == 1);
+
+    GpioCtrlRegs.GPAPUD.all = 0xFFFFFFFF;
+    GpioCtrlRegs.GPAMUX1.all = 0x55555555;
+    GpioCtrlRegs.GPBMUX1.all = 0x12345678;
+    InitGpio();
+    HOST_CHECK(GpioCtrlRegs.GPAPUD.all == 0xFFFFFFFF);
+    HOST_CHECK(GpioCtrlRegs.GPAMUX1.all == 0);
+    HOST_CHECK(GpioCtrlRegs.GPBMUX1.all == 0x12345678);
+
+    GPIO_SetupPinMux(0, GPIO_MUX_CPU1, 1);
+    GPIO_SetupPinOptions(0, GPIO_OUTPUT, GPIO_PUSHPULL);
+    HOST_CHECK(GpioCtrlRegs.GPAMUX1.bit.GPIO0 == 1);
+    HOST_CHECK(GpioCtrlRegs.GPADIR.bit.GPIO0 == 1);
+    GPIO_WritePin(34, 1);
+    HOST_CHECK(GpioDataRegs.GPBSET.bit.GPIO2 == 1);
+
+    DINT;
+    InitPieCtrl();
+    InitPieVectTable();
+    HOST_CHECK(hostIntm == 1);
+    HOST_CHECK(PieCtrlRegs.PIEIER1.all == 0);
+    HOST_CHECK(PieVectTable.ADCA1_INT == &DEFAULT_ISR);
+    PieVectTable.ADCA1_INT = &adcA1ISR;
+
+    //
+    // ADC and ePWM configuration
+    //
+    initADC();
+    HOST_CHECK(hostDelayUs == 1000);
+    HOST_CHECK(AdcaRegs.ADCCTL1.bit.ADCPWDNZ == 1);
+    HOST_CHECK(AdcbRegs.ADCCTL2.bit.PRESCALE == 6);
+    HOST_CHECK(hostVref[ADC_ADCA] == ((ADC_INTERNAL << 8) | ADC_VREF3P3));
+
+    initADCSOC();
+    HOST_CHECK(AdcaRegs.ADCSOC0CTL.bit.CHSEL == 6);
+    HOST_CHECK(AdcaRegs.ADCSOC0CTL.bit.TRIGSEL == 5);
+    HOST_CHECK(AdcaRegs.ADCINTSEL1N2.bit.INT1E == 1);
+
+    initEPWM();
+    HOST_CHECK(EPwm1Regs.ETSEL.bit.SOCASEL == 4);
+    HOST_CHECK(EPwm1Regs.ETPS.bit.SOCAPRD == 1);
+
+    initADCSequencer(adcChannelsA, 1, 0, 0);
+    configHRPWM(500);
+    HOST_CHECK(hostEallow == 1);        // Returns without EDIS
+    HOST_CHECK(CpuSysRegs.PCLKCR0.bit.TBCLKSYNC == 1);
+    HOST_CHECK(EPwm1Regs.TBPRD == 500);
+    HOST_CHECK(EPwm1Regs.TBCTL.bit.CTRMODE == TB_COUNT_UPDOWN);
+    HOST_CHECK(EPwm1Regs.CMPA.bit.CMPA == 250);
+    HOST_CHECK(EPwm2Regs.TBCTL.bit.PHSEN == 1);
+    HOST_CHECK(EPwm2Regs.HRCNFG.bit.EDGMODE == HR_BEP);
+
+    //
+    // Overvoltage trip: CMPSS1 against 55 V (2730 counts), through X-BAR
+    // TRIP4 to a one-shot DCAEVT1 trip on ePWM1 and ePWM2
+    //
+    initOVProtection(&Cmpss1Regs, 1, 1, 2730, ovModules, 2);
+    HOST_CHECK(AnalogSubsysRegs.CMPHPMXSEL.all == 1);
+    HOST_CHECK(Cmpss1Regs.COMPCTL.bit.COMPDACE == 1);
+    HOST_CHECK(Cmpss1Regs.DACHVALS.bit.DACVAL == 2730);
+    HOST_CHECK(EPwmXbarRegs.TRIP4MUXENABLE.all == 1);
+    HOST_CHECK(EPwm1Regs.DCTRIPSEL.bit.DCAHCOMPSEL == 3);
+    HOST_CHECK(EPwm2Regs.TZDCSEL.bit.DCAEVT1 == 2);
+    HOST_CHECK(EPwm2Regs.TZSEL.bit.DCAEVT1 == 1);
+    HOST_CHECK(EPwm2Regs.TZCTL.bit.TZA == TZ_FORCE_LO);
+    HOST_CHECK(EPwm3Regs.TZSEL.bit.DCAEVT1 == 0);
+    HOST_CHECK(EPwm1Regs.TZEINT.bit.OST == 1);
+    HOST_CHECK(EPwm2Regs.TZEINT.bit.OST == 0);
+
+    //
+    // One conversion: 2048 counts of the 82.5 V full scale
+    //
+    AdcaResultRegs.ADCRESULT0 = 2048;
+    AdcaRegs.ADCINTFLG.bit.ADCINT1 = 1;
+    PieVectTable.ADCA1_INT();
+    HOST_CHECK(adcAResults2 == 2048);
+    HOST_CHECK(Vout_DC > (int32_t)(41.2 * 65536));
+    HOST_CHECK(Vout_DC < (int32_t)(41.3 * 65536));
+    HOST_CHECK(AdcaRegs.ADCINTFLGCLR.bit.ADCINT1 == 1);
+    HOST_CHECK(PieCtrlRegs.PIEACK.all == PIEACK_GROUP1);
+    HOST_CHECK(hostEstopCount == 0);
+
+    printf("test_init: %u failures\n", hostFailures);
+    return(hostFailures != 0);
+}
+
+//
+// End of File
+//
@@ -0,0 +1,198 @@
+//###########################################################################
+//
+// FILE:   test_mep_cache.c
+//
+// TITLE:  MEP_CACHE.h record validation and fallback.
+//
+// Starts from the garbage a power-up leaves in the NOINIT record and walks
+// the cache through its life: fallback, first store, warm-start hit,
+// skipped stores, and then every single-bit corruption of a good record
+// and a store torn before its CRC, each of which must fall back and clear
+// the record. The CRC is checked against a byte-wise CRC-16/CCITT-FALSE.
+//
+//###########################################################################
+
+//
+// Included Files
+//
+#include "F28x_Project.h"
+#include "host_regs.h"
+#include "TIMEBASE.h"
+#include "MEP_CACHE.h"
+
+//
+// Defines
+//
+#define SF_DEFAULT              60          // Fallback, BOOT_MEP_SF_DEFAULT
+#define WORDS                   (sizeof(MEP_CACHE) / sizeof(uint16_t))
+
+//
+// refCrc - CRC-16/CCITT-FALSE over n bytes
+//
+static uint16_t refCrc(const uint8_t *b, uint16_t n)
+{
+    uint16_t crc = 0xFFFF;
+    uint16_t i;
+
+    while(n--)
+    {
+        crc ^= (uint16_t)*b++ << 8;
+        for(i = 0; i < 8; i++)
+        {
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+        }
+    }
+
+    return(crc);
+}
+
+//
+// refRecordCrc - The record's CRC as mepCacheCrc() defines it: every word
+//                but the last, high byte first
+//
+static uint16_t refRecordCrc(const MEP_CACHE *r)
+{
+    const uint16_t *w = (const uint16_t *)r;
+    uint8_t b[2 * WORDS];
+    uint16_t i;
+
+    for(i = 0; i < WORDS - 1; i++)
+    {
+        b[2 * i] = w[i] >> 8;
+        b[2 * i + 1] = w[i] & 0xFF;
+    }
+
+    return(refCrc(b, 2 * (WORDS - 1)));
+}
+
+//
+// checkCorrupt - Every single-bit flip of the current (good) record is
+//                rejected, falls back and clears the record
+//
+static void checkCorrupt(void)
+{
+    MEP_CACHE good = mepCache;
+    uint16_t *w = (uint16_t *)&mepCache;
+    uint32_t bad = 0;
+    uint16_t i, bit;
+
+    for(i = 0; i < WORDS; i++)
+    {
+        for(bit = 0; bit < 16; bit++)
+        {
+            mepCache = good;
+            w[i] ^= 1U << bit;
+
+            bad += (mepCacheValid() != 0);
+            bad += (mepCacheLoad(SF_DEFAULT) != SF_DEFAULT);
+            bad += (mepCacheHit != 0);
+            bad += (mepCache.magic != 0) || (mepCache.seq != 0);
+        }
+    }
+    HOST_CHECK(bad == 0);
+
+    mepCache = good;
+}
+
+//
+// Main
+//
+int main(void)
+{
+    uint8_t check[] = "123456789";
+    uint32_t t;
+
+    hostReset();
+    HOST_CHECK(refCrc(check, 9) == 0x29B1);     // The CCITT-FALSE check value
+    HOST_CHECK(WORDS == 8);                     // As on the C28x
+
+    //
+    // Power-up: RAM garbage, fallback, record cleared
+    //
+    memset(&mepCache, 0xA5, sizeof(mepCache));
+    mepCacheHit = 1;
+    HOST_CHECK(mepCacheValid() == 0);
+    HOST_CHECK(mepCacheLoad(SF_DEFAULT) == SF_DEFAULT);
+    HOST_CHECK(mepCacheHit == 0);
+    HOST_CHECK(mepCache.magic == 0);
+    HOST_CHECK(mepCache.seq == 0);
+
+    //
+    // First converged SFO(): stored, stamped and checksummed
+    //
+    hostTimerAdvance(123456);
+    t = timebaseNow();
+    mepCacheStore(57, MEP_CACHE_TEMP_NONE);
+    HOST_CHECK(mepCache.magic == MEP_CACHE_MAGIC);
+    HOST_CHECK(mepCache.scaleFactor == 57);
+    HOST_CHECK(mepCache.temp == MEP_CACHE_TEMP_NONE);
+    HOST_CHECK(mepCache.timestamp == t);
+    HOST_CHECK(t == 123456);
+    HOST_CHECK(mepCache.seq == 1);
+    HOST_CHECK(mepCache.crc == refRecordCrc(&mepCache));
+    HOST_CHECK(mepCacheCrc(&mepCache) == refRecordCrc(&mepCache));
+    HOST_CHECK(mepCacheValid() == 1);
+
+    //
+    // Warm start: the cached value, not the fallback
+    //
+    HOST_CHECK(mepCacheLoad(SF_DEFAULT) == 57);
+    HOST_CHECK(mepCacheHit == 1);
+
+    //
+    // Unchanged and out-of-range values are not written; a new value or
+    // temperature is
+    //
+    hostTimerAdvance(1000);
+    mepCacheStore(57, MEP_CACHE_TEMP_NONE);
+    HOST_CHECK(mepCache.seq == 1);
+    HOST_CHECK(mepCache.timestamp == t);
+    mepCacheStore(0, 25);
+    mepCacheStore(256, 25);
+    HOST_CHECK(mepCache.seq == 1);
+    HOST_CHECK(mepCache.scaleFactor == 57);
+    mepCacheStore(57, 25);
+    HOST_CHECK(mepCache.seq == 2);
+    HOST_CHECK(mepCache.temp == 25);
+    mepCacheStore(58, 25);
+    HOST_CHECK(mepCache.seq == 3);
+    HOST_CHECK(mepCache.timestamp == t + 1000);
+    HOST_CHECK(mepCacheValid() == 1);
+
+    //
+    // Corruption anywhere in the record, the CRC included
+    //
+    checkCorrupt();
+    HOST_CHECK(mepCacheLoad(SF_DEFAULT) == 58);
+
+    //
+    // A store cut short before its CRC write
+    //
+    mepCache.scaleFactor = 59;
+    mepCache.seq++;
+    HOST_CHECK(mepCacheValid() == 0);
+    HOST_CHECK(mepCacheLoad(SF_DEFAULT) == SF_DEFAULT);
+
+    //
+    // A valid CRC over an out-of-range scale factor is still rejected
+    //
+    mepCache.magic = MEP_CACHE_MAGIC;
+    mepCache.scaleFactor = 0;
+    mepCache.crc = mepCacheCrc(&mepCache);
+    HOST_CHECK(mepCacheValid() == 0);
+
+    //
+    // After a fallback the record starts over
+    //
+    HOST_CHECK(mepCacheLoad(SF_DEFAULT) == SF_DEFAULT);
+    mepCacheStore(61, MEP_CACHE_TEMP_NONE);
+    HOST_CHECK(mepCache.seq == 1);
+    HOST_CHECK(mepCacheLoad(SF_DEFAULT) == 61);
+
+    printf("test_mep_cache: %u failures\n", hostFailures);
+    return(hostFailures != 0);
+}
+
+//
+// End of File
+//
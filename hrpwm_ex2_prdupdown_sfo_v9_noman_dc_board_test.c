@@ -87,6 +87,20 @@
 #include "PWM_CONFIG.h"
 #include "ADC_CONFIG.h"
 #include "GPIO_CONFIG.h"
+#include "SCHEDULER.h"
+#include "HRPWM_MATH.h"
+#include "OV_PROTECTION.h"
+#include "ADC_DMA.h"
+#include "TIMEBASE.h"
+#include "ISR_PROFILE.h"
+#include "CLA_CONTROL.h"
+#include "FLASH_BENCH.h"
+#include "FAULT_RECORD.h"
+#include "OPT_BENCH.h"
+#include "DATALOG.h"
+#include "TELEMETRY.h"
+#include "BOOT_PROFILE.h"
+#include "MEP_CACHE.h"
 //#include "gpio.h"
 extern void InitCpuTimers(void);
 extern void ConfigCpuTimer(struct CPUTIMER_VARS *, float, float);
@@ -94,40 +108,111 @@ extern void Init_ADC_converter(void);
 interrupt void adc_isr(void);
 interrupt void cpu_timer0_isr(void);
 __interrupt void adcA1ISR(void);
+#pragma CODE_SECTION(adcA1ISR, ".TI.ramfunc");
 //
 // Defines
 //
 #define PWM_CH            3        // # of PWM channels - 1
 #define STATUS_SUCCESS    1
 #define STATUS_FAIL       0
+#define SWEEP_TICKS       (20 * (PWM_CH - 1))   // 2ms per PWM channel
 #define RESULTS_BUFFER_SIZE     256
+#define ADC_CAPTURE_DMA         0   // 1 = DMA capture into adcDmaBuf[],
+                                    //     no per-sample ADCA1 interrupt
+#ifndef CONTROL_CLA
+#define CONTROL_CLA             0   // 1 = CLA task 1 runs the Vout loop,
+                                    //     the CPU only supervises it.
+                                    //     adcA1ISR() then never runs: its
+                                    //     ISR_PROFILE slot and GPIO13
+                                    //     probe stay idle.
+#endif
+#define VOUT_FULL_SCALE         (3.3 * 25)  // Vout at ADC full scale (V)
+#define VOUT_GAIN_Q24           HRMATH_ADC_GAIN_Q24(VOUT_FULL_SCALE)
+#define VOUT_OV_VOLTS           55          // Overvoltage limit (V)
+#define VOUT_OV_COUNTS          HRMATH_ADC_COUNTS(VOUT_OV_VOLTS, VOUT_FULL_SCALE)
+#define OV_CMPSS                Cmpss1Regs  // CMPSS wired to the Vout pin
+#define OV_CMPSS_NUM            1           // and its HP mux input select
+#define OV_CMPSS_HPMXSEL        1           // (board specific)
+#define OV_MODULES              2           // ePWM1..2 are tripped on OV
+#define VOUT_REF                48.0f       // CLA loop reference (V)
+#define VOUT_KP                 0.002f      // CLA loop gains (duty / V)
+#define VOUT_KI                 0.0002f
+#define VOUT_DUTY_MIN           0.05f
+#define VOUT_DUTY_MAX           0.95f
+#define DLOG_DECIMATION         2           // Log every 2nd dlogRun() call
+#define DLOG_PRE_FRAC           0x4000      // 25% of the capture pre-trigger
 int32  adcAResults1=0;
 uint16_t adcAResults[RESULTS_BUFFER_SIZE];   // Buffer for results
 uint16_t adcAResults2;   // Buffer for results
 uint16_t index;                              // Index into result buffer
 volatile uint16_t bufferFull;                // Flag to indicate buffer is full
-float Vout_DC=0;
+int32_t Vout_DC=0;                           // Output voltage (V), Q16
 
 
 //
 // Globals
 //
 uint16_t UpdateFine, PeriodFine, status;
+uint16_t claFault;          // 1 = supervisor disabled the CLA loop
+uint16_t claStalls;         // # of supervisor periods without a CLA run
+uint32_t claRunsLast;
+FAULT_RECORD bootFault;     // Default-ISR capture from before the reset
 int MEP_ScaleFactor; // Global variable used by the SFO library
                      // Result can be used for all HRPWM channels
                      // This variable is also copied to HRMSTEP
                      // register by SFO(0) function.
 
-// Used by SFO library (ePWM[0] is a dummy value that isn't used)
-volatile struct EPWM_REGS *ePWM[PWM_CH] = {&EPwm1Regs, &EPwm1Regs};
+// ADC sequencer channel lists (ADCA SOC0.., ADCB SOC0..)
+const uint16_t adcChannelsA[] = {6};        // A6 - Vout_DC
+#define ADC_CH_A    (sizeof(adcChannelsA) / sizeof(adcChannelsA[0]))
+#define ADC_CH_B    0
+
+// Used by SFO library (ePWM[0] is a dummy value that isn't used); one entry
+// per channel, the loops over 1..PWM_CH-1 write through every one
+volatile struct EPWM_REGS *ePWM[PWM_CH] = {&EPwm1Regs, &EPwm1Regs, &EPwm2Regs};
 //volatile struct AdcRegs *Adc[PWM_CH] = {&Adc1Regs, &Adc1Regs};
 
+// ePWM modules forced low by the hardware overvoltage trip
+volatile struct EPWM_REGS * const ovModules[OV_MODULES] =
+    {&EPwm1Regs, &EPwm2Regs};
+
 //
 // Function Prototypes
 //
 void initHRPWM1GPIO(void);
 void configHRPWM(uint16_t period);
 void error(void);
+void sweepTask(void);
+void sfoTask(void);
+void superviseTask(void);
+void logTask(void);
+void tlmTask(void);
+
+// Background tasks, fastest first
+SCHED_TASK schedTasks[] =
+{
+#if CONTROL_CLA
+    {logTask, SCHED_10KHZ},
+    {superviseTask, SCHED_1KHZ},
+#endif
+    {sweepTask, SWEEP_TICKS},
+    {tlmTask, SCHED_100HZ}
+};
+#define SCHED_TASKS (sizeof(schedTasks) / sizeof(schedTasks[0]))
+
+// Telemetry frame contents, in order (tlm_decode.py FIELDS)
+TLM_FIELD tlmFields[] =
+{
+    {&schedTick, 1},
+    {&Vout_DC, 2},
+    {&MEP_ScaleFactor, 1},
+    {&adcAResults2, 1},
+    {&status, 1},
+    {&claState.vout, 2},
+    {&claState.duty, 2},
+    {&claFault, 1}
+};
+#define TLM_FIELDS  (sizeof(tlmFields) / sizeof(tlmFields[0]))
 
 //
 // Main
@@ -136,10 +221,35 @@ void main(void)
 {
     uint16_t i;
 
+    //
+    // Boot stages are timed on CPU Timer 1 from here (BOOT_PROFILE.h)
+    //
+    initTimebase();
+    bootStart();
+
     //
     // Initialize device clock and peripherals
     //
+#if FAST_BOOT
+    bootInitSysCtrl();
+#else
     InitSysCtrl();
+#endif
+    bootStage(BOOT_ID_PLL);
+
+    //
+    // Keep a default-ISR capture from before the reset for the debugger
+    //
+    if(faultRecordValid())
+    {
+        bootFault = faultRecord;
+        faultRecordClear();
+    }
+
+    initISRProfile();
+    initOptBench();
+    runFlashBench();
+    bootStage(BOOT_ID_INIT);
 
     //
     // Initialize GPIO
@@ -162,12 +272,25 @@ void main(void)
     InitPieVectTable();
     EALLOW;
     PieVectTable.ADCA1_INT = &adcA1ISR;     // Function for ADCA interrupt 1
+    PieVectTable.TIMER0_INT = &schedTickISR;    // Scheduler tick
+    PieVectTable.DMA_CH1_INT = &adcDmaISR;  // Function for DMA CH1 interrupt
+    PieVectTable.SCIA_TX_INT = &tlmTxISR;   // Telemetry TX FIFO refill
+    PieVectTable.EPWM1_TZ_INT = &ovTripISR; // Function for OV trip interrupt
     EDIS;
+    bootStage(BOOT_ID_PIE);
     //
 
+#if FAST_BOOT
+    //
+    // The ADCs were powered up ahead of the PLL, wait out the rest
+    //
+    bootAdcWait();
+#else
     // Configure the ADC and power it up
      //
      initADC();
+#endif
+    bootStage(BOOT_ID_ADC);
 
      //
      // Configure the ePWM
@@ -175,14 +298,28 @@ void main(void)
      initEPWM();
 
      //
-     // Setup the ADC for ePWM triggered conversions on channel 1
+     // Setup the ADC sequencer for ePWM triggered conversions
+     //
+     initADCSequencer(adcChannelsA, ADC_CH_A, 0, ADC_CH_B);
+
+#if ADC_CAPTURE_DMA
+     //
+     // Move the ADCA results by DMA, interrupting only per buffer half
      //
-     initADCSOC();
+     initADCDMA(ADC_CH_A);
+     startADCDMA();
+#endif
 
 
     initHRPWM1GPIO();
+    initTelemetry(tlmFields, TLM_FIELDS);
 
     IER |= M_INT1;  // Enable group 1 interrupts
+    IER |= M_INT2;  // Enable group 2 interrupts (OV trip)
+    IER |= M_INT9;  // Enable group 9 interrupts (SCIA TX)
+#if ADC_CAPTURE_DMA
+    IER |= M_INT7;  // Enable group 7 interrupts
+#endif
 
     EINT;           // Enable Global interrupt INTM
     ERTM;           // Enable Global realtime interrupt DBGM
@@ -209,7 +346,32 @@ void main(void)
     ERTM;
 
 
+    //
+    // Datalogger: raw ADC, Vout and the loop state. Triggers on overvoltage,
+    // or from superviseTask() when it drops the CLA loop. Set up before the
+    // ADC interrupt is enabled: dlog is not zeroed at boot and the ISRs call
+    // dlogRun() from their first conversion.
+    //
+    initDatalog(DLOG_DECIMATION);
+    dlogSetChannel(0, &AdcaResultRegs.ADCRESULT0, DLOG_U16);
+#if CONTROL_CLA
+    dlogSetChannel(1, &claState.vout, DLOG_F32);
+    dlogSetChannel(2, &claState.duty, DLOG_F32);
+    dlogSetChannel(3, &claState.integ, DLOG_F32);
+#else
+    dlogSetChannel(1, &Vout_DC, DLOG_Q16);
+#endif
+    dlogArm(DLOG_TRIG_ABOVE, 1, VOUT_OV_VOLTS, DLOG_PRE_FRAC);
+
+
+#if ADC_CAPTURE_DMA
+    PieCtrlRegs.PIEIER7.bit.INTx1 = 1;
+#elif !CONTROL_CLA
     PieCtrlRegs.PIEIER1.bit.INTx1 = 1;
+#endif
+    PieCtrlRegs.PIEIER1.bit.INTx7 = 1;
+    PieCtrlRegs.PIEIER2.bit.INTx1 = 1;
+    PieCtrlRegs.PIEIER9.bit.INTx2 = 1;
     //
     // ePWM and HRPWM register initialization
     //
@@ -219,9 +381,26 @@ void main(void)
         // (PWM clock needs to be > 60MHz)
         (*ePWM[i]).TBCTL.bit.HSPCLKDIV = 0;
     }
+    OPT_BENCH_ENTRY(OPT_ID_CONFIG_HRPWM);
     configHRPWM(500);
+    OPT_BENCH_EXIT(OPT_ID_CONFIG_HRPWM);
 
+    //
+    // Overvoltage forces the PWM outputs low in hardware; ovFault is set by
+    // ovTripISR() and the outputs stay off until rearmOVProtection()
+    //
+    initOVProtection(&OV_CMPSS, OV_CMPSS_NUM, OV_CMPSS_HPMXSEL,
+                     VOUT_OV_COUNTS, ovModules, OV_MODULES);
+    bootStage(BOOT_ID_EPWM);
 
+#if FAST_BOOT
+    //
+    // Start on the scale factor cached before the reset, or the nominal
+    // one after power-up; sfoTask() runs the first full calibration in the
+    // background and replaces it
+    //
+    bootSeedScaleFactor(mepCacheLoad(BOOT_MEP_SF_DEFAULT));
+#else
     //
     // Calling SFO() updates the HRMSTEP register with calibrated MEP_ScaleFactor.
     // HRMSTEP must be populated with a scale factor value prior to enabling
@@ -230,59 +409,59 @@ void main(void)
     while(status == SFO_INCOMPLETE)
     {
 
+        OPT_BENCH_ENTRY(OPT_ID_SFO);
         status = SFO();
+        OPT_BENCH_EXIT(OPT_ID_SFO);
         if (status == SFO_ERROR)
         {
           //  error();    // SFO function returns 2 if an error occurs & # of MEP
         }               // steps/coarse step exceeds maximum of 255.
 
     }
+    if(status == SFO_COMPLETE)
+    {
+        mepCacheStore(MEP_ScaleFactor, MEP_CACHE_TEMP_NONE);
+    }
+#endif
+    bootStage(BOOT_ID_SFO);
 
+#if CONTROL_CLA
+    //
+    // Hand the Vout loop to the CLA. Task 1 runs on every ADCA burst but
+    // leaves CMPA alone until the parameters are in place and enable is set.
+    //
+    initCLA();
+
+    claParams.vref = VOUT_REF;
+    claParams.gain = (float)VOUT_FULL_SCALE / HRMATH_ADC_MAX;
+    claParams.kp = VOUT_KP;
+    claParams.ki = VOUT_KI;
+    claParams.dutyMin = VOUT_DUTY_MIN;
+    claParams.dutyMax = VOUT_DUTY_MAX;
+    claParams.period = EPwm1Regs.TBPRD;
+    claFault = 0;
+    claStalls = 0;
+    claRunsLast = 0;
+    claParams.enable = 1;
+#else
+    //
+    // The telemetry frame carries the CLA fields either way; read them as 0
+    //
+    initCLAMsgRAM();
+    claFault = 0;
+#endif
 
-
+    //
+    // Background tasks share the CPU through the scheduler instead of
+    // busy-waiting; SFO() calibration runs whenever no task is due
+    //
+    initScheduler(schedTasks, SCHED_TASKS, sfoTask);
+    bootStage(BOOT_ID_RUN);
+    bootReport();
 
     for(;;)
     {
-       // adcAResults1 = AdcaResultRegs.ADCRESULT0;
-        //
-        // Sweep PeriodFine as a Q16 number from 0.2 - 0.999
-        //
-        for(PeriodFine = 0x3333; PeriodFine < 0xFFFF; PeriodFine++)
-        {
-            if(UpdateFine)
-            {
-                //
-
-                for(i=1; i<PWM_CH; i++)
-                {
-                    DELAY_US(2000);
-                 //   (*ePWM[i]).TBPRDHR = PeriodFine; //In Q16 format
-                  // EPwm2Regs.TBPHS.bit.TBPHSHR = PeriodFine;  // 750 for  minimum voltage  phase shift 695=100
-
-                }
-            }
-            else
-            {
-                //
-                // No high-resolution movement on TBPRDHR.
-                //
-                for(i=1; i<PWM_CH; i++)
-                {
-                    (*ePWM[i]).TBPRDHR = 0;
-                }
-            }
-
-
-            //
-            status = SFO(); // in background, MEP calibration module
-                            // continuously updates MEP_ScaleFactor
-
-            if(status == SFO_ERROR)
-            {
-              //  error();   // SFO function returns 2 if an error occurs & # of
-                           // MEP steps/coarse step exceeds maximum of 255.
-            }
-        } // end PeriodFine for loop
+        schedRun();
     } // end infinite for loop
 
 
@@ -293,23 +472,124 @@ void main(void)
 
 
 
-__interrupt void adcA1ISR(void)
+//
+// sweepTask - Step PeriodFine as a Q16 number from 0.2 - 0.999
+//
+void sweepTask(void)
 {
-    GpioDataRegs.GPACLEAR.bit.GPIO13=1;
- //   GpioDataRegs.GPASET.bit.GPIO13=0;
-    //
-    // Add the latest result to the buffer
-    // ADCRESULT0 is the result register of SOC0
-    adcAResults[index++] = AdcaResultRegs.ADCRESULT0;
-    adcAResults2 = AdcaResultRegs.ADCRESULT0;
-    Vout_DC= ((adcAResults2*3.3)/4095)*25;
+    uint16_t i;
 
+    OPT_BENCH_ENTRY(OPT_ID_HR_UPDATE);
 
-    if (Vout_DC>55)
+    PeriodFine++;
+    if((PeriodFine < 0x3333) || (PeriodFine >= 0xFFFF))
     {
+        PeriodFine = 0x3333;
+    }
 
- //       configHRPWM(0);
+    if(UpdateFine)
+    {
+        //
+        // (*ePWM[i]).TBPRDHR = PeriodFine; //In Q16 format
+        // EPwm2Regs.TBPHS.bit.TBPHSHR = PeriodFine;  // 750 for  minimum voltage  phase shift 695=100
+        //
     }
+    else
+    {
+        //
+        // No high-resolution movement on TBPRDHR.
+        //
+        for(i=1; i<PWM_CH; i++)
+        {
+            (*ePWM[i]).TBPRDHR = 0;
+        }
+    }
+
+    OPT_BENCH_EXIT(OPT_ID_HR_UPDATE);
+}
+
+//
+// sfoTask - Idle task, in background, MEP calibration module
+//           continuously updates MEP_ScaleFactor
+//
+void sfoTask(void)
+{
+    OPT_BENCH_ENTRY(OPT_ID_SFO);
+    status = SFO();
+    OPT_BENCH_EXIT(OPT_ID_SFO);
+
+    if(status == SFO_ERROR)
+    {
+      //  error();   // SFO function returns 2 if an error occurs & # of
+                     // MEP steps/coarse step exceeds maximum of 255.
+    }
+    else if(status == SFO_COMPLETE)
+    {
+        //
+        // Keep the converged value for the next warm start. No die
+        // temperature is measured on this board.
+        //
+        mepCacheStore(MEP_ScaleFactor, MEP_CACHE_TEMP_NONE);
+    }
+}
+
+//
+// superviseTask - Watch the CLA loop: drop the loop on overvoltage, count
+//                 periods in which task 1 did not run and publish Vout_DC
+//
+void superviseTask(void)
+{
+    uint32_t runs;
+
+    //
+    // adcA1ISR() is not running, keep Vout_DC (telemetry) current
+    //
+    Vout_DC = (int32_t)(claState.vout * 65536.0f);
+
+    if(claState.vout > VOUT_OV_VOLTS)
+    {
+        claParams.enable = 0;
+        claFault = 1;
+        dlogTrigger();
+    }
+
+    runs = claState.runs;
+    if(runs == claRunsLast)
+    {
+        claStalls++;
+    }
+    claRunsLast = runs;
+}
+
+//
+// tlmTask - Send one telemetry frame
+//
+void tlmTask(void)
+{
+    tlmSend();
+}
+
+//
+// logTask - Datalogger sampling while the CLA owns the ADCA interrupt
+//
+void logTask(void)
+{
+    dlogRun();
+}
+
+__interrupt void adcA1ISR(void)
+{
+    ISR_PROFILE_ENTRY(ISR_ID_ADCA1);
+    probeSet(PROBE_ADCA1_ISR);
+
+    //
+    // Publish the burst and add the latest Vout result to the buffer
+    //
+    adcSeqCapture();
+    adcAResults2 = adcFrame[adcFrameReady].a[0];
+    adcAResults[index++] = adcAResults2;
+    Vout_DC = hrmathAdcToQ16(adcAResults2, VOUT_GAIN_Q24);
+    dlogRun();
 
     //
     // Set the bufferFull flag if the buffer is full
@@ -338,6 +618,9 @@ __interrupt void adcA1ISR(void)
     // Acknowledge the interrupt
     //
     PieCtrlRegs.PIEACK.all = PIEACK_GROUP1;
+
+    probeClear(PROBE_ADCA1_ISR);
+    ISR_PROFILE_EXIT(ISR_ID_ADCA1);
 }
 
 //
@@ -87,6 +87,9 @@
 #include "PWM_CONFIG.h"
 #include "ADC_CONFIG.h"
 #include "GPIO_CONFIG.h"
+#include "SCHEDULER.h"
+#include "HRPWM_MATH.h"
+#include "OV_PROTECTION.h"
 #include "driverlib.h"
 #include "device.h"
 extern void InitCpuTimers(void);
@@ -101,13 +104,22 @@ __interrupt void adcA1ISR(void);
 #define PWM_CH            3        // # of PWM channels - 1
 #define STATUS_SUCCESS    1
 #define STATUS_FAIL       0
+#define SWEEP_TICKS       (20 * (PWM_CH - 1))   // 2ms per PWM channel
 #define RESULTS_BUFFER_SIZE     256
+#define VOUT_FULL_SCALE         (3.3 * 25)  // Vout at ADC full scale (V)
+#define VOUT_GAIN_Q24           HRMATH_ADC_GAIN_Q24(VOUT_FULL_SCALE)
+#define VOUT_OV_LIMIT           55          // Overvoltage limit (V)
+#define VOUT_OV_COUNTS          HRMATH_ADC_COUNTS(VOUT_OV_LIMIT, VOUT_FULL_SCALE)
+#define OV_CMPSS                Cmpss1Regs  // CMPSS wired to the Vout pin
+#define OV_CMPSS_NUM            1           // and its HP mux input select
+#define OV_CMPSS_HPMXSEL        1           // (board specific)
+#define OV_MODULES              5           // ePWM1..5 are tripped on OV
 int32  adcAResults1=0;
 uint16_t adcAResults[RESULTS_BUFFER_SIZE];   // Buffer for results
 uint16_t adcAResults2;   // Buffer for results
 uint16_t index;                              // Index into result buffer
 volatile uint16_t bufferFull;                // Flag to indicate buffer is full
-float Vout_DC=0;
+int32_t Vout_DC=0;                           // Output voltage (V), Q16
 
 
 //
@@ -123,12 +135,25 @@ int MEP_ScaleFactor; // Global variable used by the SFO library
 volatile struct EPWM_REGS *ePWM[PWM_CH] = {&EPwm1Regs, &EPwm1Regs};
 //volatile struct AdcRegs *Adc[PWM_CH] = {&Adc1Regs, &Adc1Regs};
 
+// ePWM modules forced low by the hardware overvoltage trip
+volatile struct EPWM_REGS * const ovModules[OV_MODULES] =
+    {&EPwm1Regs, &EPwm2Regs, &EPwm3Regs, &EPwm4Regs, &EPwm5Regs};
+
 //
 // Function Prototypes
 //
 void initHRPWM1GPIO(void);
 void configHRPWM(uint16_t period);
 void error(void);
+void sweepTask(void);
+void sfoTask(void);
+
+// Background tasks, fastest first
+SCHED_TASK schedTasks[] =
+{
+    {sweepTask, SWEEP_TICKS}
+};
+#define SCHED_TASKS (sizeof(schedTasks) / sizeof(schedTasks[0]))
 
 //
 // Main
@@ -163,6 +188,8 @@ void main(void)
     InitPieVectTable();
     EALLOW;
     PieVectTable.ADCA1_INT = &adcA1ISR;     // Function for ADCA interrupt 1
+    PieVectTable.TIMER0_INT = &schedTickISR;    // Scheduler tick
+    PieVectTable.EPWM1_TZ_INT = &ovTripISR; // Function for OV trip interrupt
     EDIS;
     //
 
@@ -184,6 +211,7 @@ void main(void)
     initHRPWM1GPIO();
 
     IER |= M_INT1;  // Enable group 1 interrupts
+    IER |= M_INT2;  // Enable group 2 interrupts
 
     EINT;           // Enable Global interrupt INTM
     ERTM;           // Enable Global realtime interrupt DBGM
@@ -211,6 +239,8 @@ void main(void)
 
 
     PieCtrlRegs.PIEIER1.bit.INTx1 = 1;
+    PieCtrlRegs.PIEIER1.bit.INTx7 = 1;
+    PieCtrlRegs.PIEIER2.bit.INTx1 = 1;
     //
     // ePWM and HRPWM register initialization
     //
@@ -222,6 +252,13 @@ void main(void)
     }
     configHRPWM(500);
 
+    //
+    // Overvoltage forces the PWM outputs low in hardware; ovFault is set by
+    // ovTripISR() and the outputs stay off until rearmOVProtection()
+    //
+    initOVProtection(&OV_CMPSS, OV_CMPSS_NUM, OV_CMPSS_HPMXSEL,
+                     VOUT_OV_COUNTS, ovModules, OV_MODULES);
+
     //
     // Calling SFO() updates the HRMSTEP register with calibrated MEP_ScaleFactor.
     // HRMSTEP must be populated with a scale factor value prior to enabling
@@ -241,48 +278,15 @@ void main(void)
 
 
 
+    //
+    // Background tasks share the CPU through the scheduler instead of
+    // busy-waiting; SFO() calibration runs whenever no task is due
+    //
+    initScheduler(schedTasks, SCHED_TASKS, sfoTask);
+
     for(;;)
     {
-       // adcAResults1 = AdcaResultRegs.ADCRESULT0;
-        //
-        // Sweep PeriodFine as a Q16 number from 0.2 - 0.999
-        //
-        for(PeriodFine = 0x3333; PeriodFine < 0xFFFF; PeriodFine++)
-        {
-            if(UpdateFine)
-            {
-                //
-
-                for(i=1; i<PWM_CH; i++)
-                {
-                    DELAY_US(2000);
-                 //   (*ePWM[i]).TBPRDHR = PeriodFine; //In Q16 format
-                  // EPwm2Regs.TBPHS.bit.TBPHSHR = PeriodFine;  // 750 for  minimum voltage  phase shift 695=100
-
-                }
-            }
-            else
-            {
-                //
-                // No high-resolution movement on TBPRDHR.
-                //
-                for(i=1; i<PWM_CH; i++)
-                {
-                    (*ePWM[i]).TBPRDHR = 0;
-                }
-            }
-
-
-            //
-            status = SFO(); // in background, MEP calibration module
-                            // continuously updates MEP_ScaleFactor
-
-            if(status == SFO_ERROR)
-            {
-                error();   // SFO function returns 2 if an error occurs & # of
-                           // MEP steps/coarse step exceeds maximum of 255.
-            }
-        } // end PeriodFine for loop
+        schedRun();
     } // end infinite for loop
 
 
@@ -293,21 +297,61 @@ void main(void)
 
 
 
-__interrupt void adcA1ISR(void)
+//
+// sweepTask - Step PeriodFine as a Q16 number from 0.2 - 0.999
+//
+void sweepTask(void)
 {
-    //
-    // Add the latest result to the buffer
-    // ADCRESULT0 is the result register of SOC0
-    adcAResults[index++] = AdcaResultRegs.ADCRESULT0;
-    adcAResults2 = AdcaResultRegs.ADCRESULT0;
-    Vout_DC= ((adcAResults2*3.3)/4095)*25;
+    uint16_t i;
 
+    PeriodFine++;
+    if((PeriodFine < 0x3333) || (PeriodFine >= 0xFFFF))
+    {
+        PeriodFine = 0x3333;
+    }
 
-    if (Vout_DC>55)
+    if(UpdateFine)
     {
+        //
+        // (*ePWM[i]).TBPRDHR = PeriodFine; //In Q16 format
+        // EPwm2Regs.TBPHS.bit.TBPHSHR = PeriodFine;  // 750 for  minimum voltage  phase shift 695=100
+        //
+    }
+    else
+    {
+        //
+        // No high-resolution movement on TBPRDHR.
+        //
+        for(i=1; i<PWM_CH; i++)
+        {
+            (*ePWM[i]).TBPRDHR = 0;
+        }
+    }
+}
+
+//
+// sfoTask - Idle task, in background, MEP calibration module
+//           continuously updates MEP_ScaleFactor
+//
+void sfoTask(void)
+{
+    status = SFO();
 
-        configHRPWM(0);
+    if(status == SFO_ERROR)
+    {
+            error();   // SFO function returns 2 if an error occurs & # of
+                   // MEP steps/coarse step exceeds maximum of 255.
     }
+}
+
+__interrupt void adcA1ISR(void)
+{
+    //
+    // Add the latest result to the buffer
+    // ADCRESULT0 is the result register of SOC0
+    adcAResults2 = AdcaResultRegs.ADCRESULT0;
+    adcAResults[index++] = adcAResults2;
+    Vout_DC = hrmathAdcToQ16(adcAResults2, VOUT_GAIN_Q24);
 
     //
     // Set the bufferFull flag if the buffer is full
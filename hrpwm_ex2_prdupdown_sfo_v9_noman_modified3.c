@@ -83,29 +83,180 @@
 //
 #include "F28x_Project.h"
 #include "SFO_V8.h"
+#include "EPWM_TABLE.h"
+#include "HRPWM_UPDATE.h"
+#include "DAB_MOD.h"
+#include "IBC_DRIVER.h"
+#include "TIMEBASE.h"
+#include "SFO_SCHED.h"
 
 //
 // Defines
 //
-#define PWM_CH_IBC            12        // # of PWM channels - 4 for IBC
+#define IBC_PHASES            2         // IBC phases, ePWM1..2
 #define PWM_CH_DAB_PRI        12        // # of PWM channels - 4
 #define PWM_CH_DAB_SEC        12        // # of PWM channels - 4
 #define STATUS_SUCCESS    1
 #define STATUS_FAIL       0
+#define EPWM_MODULES      6         // # of ePWM modules in epwmCfg[]
+#define PWM_CH            (EPWM_MODULES + 1)  // # of entries in ePWM[]
+#define HR_UPDATES        EPWM_MODULES        // ePWM1..6 get HR period updates
+#define PWM_PERIOD        500
+#define SFO_PERIOD        1000000UL // SYSCLKs between calibrations (10ms)
+#define SFO_BUDGET        2000UL    // SYSCLKs per background SFO slot (20us)
+#define SFO_THRESHOLD     1         // MEP_ScaleFactor drift raising an event
+#define DAB_PHASE_INIT    0x0CCD    // Outer phase shift, Q16 period (18 deg)
+#define DAB_INNER_INIT    0         // Inner EPS angle, Q16 period
+#define IBC_LOAD_INIT     0xFFFF    // IBC load, Q16 of rated (all phases)
 
 //
 // Globals
 //
 uint16_t UpdateFine, PeriodFine, status;
+uint16_t DabPhase, DabInner;    // DAB phase commands, Q16 switching period
+uint16_t IbcLoad;               // IBC load, Q16 of rated, sets the phases
 int MEP_ScaleFactor; // Global variable used by the SFO library
                      // Result can be used for all HRPWM channels
                      // This variable is also copied to HRMSTEP
                      // register by SFO(0) function.
 
 // Used by SFO library (ePWM[0] is a dummy value that isn't used)
-volatile struct EPWM_REGS *ePWM[12] = {&EPwm1Regs, &EPwm1Regs , &EPwm2Regs, &EPwm2Regs,&EPwm3Regs, &EPwm3Regs , &EPwm4Regs, &EPwm4Regs,&EPwm5Regs, &EPwm5Regs , &EPwm6Regs, &EPwm6Regs};
+volatile struct EPWM_REGS *ePWM[PWM_CH] = {&EPwm1Regs, &EPwm1Regs, &EPwm2Regs,
+                                           &EPwm3Regs, &EPwm4Regs, &EPwm5Regs,
+                                           &EPwm6Regs};
 //volatile struct EPWM_REGS *ePWM[PWM_CH_DAB_PRI] = {&EPwm3Regs, &EPwm3Regs , &EPwm4Regs, &EPwm4Regs};
 
+//
+// ePWM/HRPWM configuration table used by configHRPWM()
+// ePWM1/2 - IBC legs, ePWM3..6 - DAB legs (ePWM1 is the sync master)
+//
+const EPWM_CHANNEL_CFG epwmCfg[EPWM_MODULES] =
+{
+    // ePWM1 - IBC, sync master
+    {
+        &EPwm1Regs,
+        EPWM_TBCTL(TB_COUNT_UPDOWN, TB_DISABLE, TB_SHADOW, TB_SYNC_DISABLE,
+                   TB_DOWN, 3),
+        0,
+        EPWM_CMPCTL(CC_CTR_ZERO, CC_CTR_ZERO, CC_SHADOW, CC_SHADOW),
+        EPWM_AQCTL(AQ_NO_ACTION, AQ_NO_ACTION, AQ_CLEAR, AQ_SET,
+                   AQ_NO_ACTION, AQ_NO_ACTION),
+        EPWM_AQCTL(AQ_NO_ACTION, AQ_NO_ACTION, AQ_NO_ACTION, AQ_NO_ACTION,
+                   AQ_SET, AQ_CLEAR),
+        EPWM_DBCTL(DB_FULL_ENABLE, DB_ACTV_HI, DBA_ALL, 1),
+        EPWM_HRCNFG(HR_BEP, HR_CMP, HR_CTR_ZERO_PRD,
+                    HR_BEP, HR_PHS, HR_CTR_ZERO_PRD, 1),
+        EPWM_HRPCTL(1, 1),
+        0, 0, 0,
+        (1 << 8), 1
+    },
+    // ePWM2 - IBC
+    {
+        &EPwm2Regs,
+        EPWM_TBCTL(TB_COUNT_UPDOWN, TB_ENABLE, TB_SHADOW, TB_SYNC_IN,
+                   TB_DOWN, 3),
+        1,
+        EPWM_CMPCTL(CC_CTR_ZERO, CC_CTR_ZERO, CC_SHADOW, CC_SHADOW),
+        EPWM_AQCTL(AQ_NO_ACTION, AQ_NO_ACTION, AQ_CLEAR, AQ_SET,
+                   AQ_NO_ACTION, AQ_NO_ACTION),
+        EPWM_AQCTL(AQ_NO_ACTION, AQ_NO_ACTION, AQ_NO_ACTION, AQ_NO_ACTION,
+                   AQ_SET, AQ_CLEAR),
+        EPWM_DBCTL(DB_FULL_ENABLE, DB_ACTV_HI, DBA_ALL, 1),
+        EPWM_HRCNFG(HR_BEP, HR_CMP, HR_CTR_ZERO_PRD,
+                    HR_BEP, HR_PHS, HR_CTR_ZERO_PRD, 1),
+        EPWM_HRPCTL(1, 1),
+        0, 1, 0,            // 750 for  minimum voltage  phase shift 695=100
+        (1 << 8), 1
+    },
+    // ePWM3 - DAB secondary
+    {
+        &EPwm3Regs,
+        EPWM_TBCTL(TB_COUNT_UPDOWN, TB_ENABLE, TB_SHADOW, TB_SYNC_IN,
+                   TB_DOWN, 3),
+        1,
+        EPWM_CMPCTL(CC_CTR_ZERO, CC_CTR_ZERO, CC_SHADOW, CC_SHADOW),
+        EPWM_AQCTL(AQ_NO_ACTION, AQ_NO_ACTION, AQ_CLEAR, AQ_SET,
+                   AQ_NO_ACTION, AQ_NO_ACTION),
+        EPWM_AQCTL(AQ_NO_ACTION, AQ_NO_ACTION, AQ_NO_ACTION, AQ_NO_ACTION,
+                   AQ_SET, AQ_CLEAR),
+        EPWM_DBCTL(DB_FULL_ENABLE, DB_ACTV_HI, DBA_ALL, 0),
+        EPWM_HRCNFG(HR_BEP, HR_CMP, HR_CTR_ZERO_PRD,
+                    HR_BEP, HR_CMP, HR_CTR_ZERO_PRD, 1),
+        EPWM_HRPCTL(1, 1),
+        0, 0, 0,
+        (1 << 8), 1
+    },
+    // ePWM4 - DAB secondary
+    {
+        &EPwm4Regs,
+        EPWM_TBCTL(TB_COUNT_UPDOWN, TB_ENABLE, TB_SHADOW, TB_SYNC_IN,
+                   TB_DOWN, 3),
+        1,
+        EPWM_CMPCTL(CC_CTR_ZERO, CC_CTR_ZERO, CC_SHADOW, CC_SHADOW),
+        EPWM_AQCTL(AQ_NO_ACTION, AQ_NO_ACTION, AQ_CLEAR, AQ_SET,
+                   AQ_NO_ACTION, AQ_NO_ACTION),
+        EPWM_AQCTL(AQ_NO_ACTION, AQ_NO_ACTION, AQ_NO_ACTION, AQ_NO_ACTION,
+                   AQ_SET, AQ_CLEAR),
+        EPWM_DBCTL(DBA_ENABLE, DB_ACTV_HI, DBA_ALL, 0),
+        EPWM_HRCNFG(HR_BEP, HR_CMP, HR_CTR_ZERO_PRD,
+                    HR_BEP, HR_PHS, HR_CTR_ZERO_PRD, 1),
+        EPWM_HRPCTL(1, 1),
+        0, 0, 0,
+        (1 << 8), 1
+    },
+    // ePWM5 - DAB primary
+    {
+        &EPwm5Regs,
+        EPWM_TBCTL(TB_COUNT_UPDOWN, TB_ENABLE, TB_SHADOW, TB_SYNC_IN,
+                   TB_DOWN, 3),
+        1,
+        EPWM_CMPCTL(CC_CTR_ZERO, CC_CTR_ZERO, CC_SHADOW, CC_SHADOW),
+        EPWM_AQCTL(AQ_NO_ACTION, AQ_NO_ACTION, AQ_CLEAR, AQ_SET,
+                   AQ_NO_ACTION, AQ_NO_ACTION),
+        EPWM_AQCTL(AQ_NO_ACTION, AQ_NO_ACTION, AQ_NO_ACTION, AQ_NO_ACTION,
+                   AQ_SET, AQ_CLEAR),
+        EPWM_DBCTL(DB_DISABLE, DB_ACTV_HI, DBA_ALL, 0),
+        EPWM_HRCNFG(HR_BEP, HR_CMP, HR_CTR_ZERO_PRD,
+                    HR_BEP, HR_PHS, HR_CTR_ZERO_PRD, 1),
+        EPWM_HRPCTL(1, 1),
+        0, 0, 0,
+        (1 << 8), 1
+    },
+    // ePWM6 - DAB primary
+    {
+        &EPwm6Regs,
+        EPWM_TBCTL(TB_COUNT_UPDOWN, TB_ENABLE, TB_SHADOW, TB_SYNC_IN,
+                   TB_DOWN, 3),
+        1,
+        EPWM_CMPCTL(CC_CTR_ZERO, CC_CTR_ZERO, CC_SHADOW, CC_SHADOW),
+        EPWM_AQCTL(AQ_NO_ACTION, AQ_NO_ACTION, AQ_CLEAR, AQ_SET,
+                   AQ_NO_ACTION, AQ_NO_ACTION),
+        EPWM_AQCTL(AQ_NO_ACTION, AQ_NO_ACTION, AQ_NO_ACTION, AQ_NO_ACTION,
+                   AQ_SET, AQ_CLEAR),
+        EPWM_DBCTL(DB_DISABLE, DB_ACTV_HI, DBA_ALL, 0),
+        EPWM_HRCNFG(HR_BEP, HR_CMP, HR_CTR_ZERO_PRD,
+                    HR_BEP, HR_PHS, HR_CTR_ZERO_PRD, 1),
+        EPWM_HRPCTL(1, 1),
+        0, 0, 0,
+        (1 << 8), 1
+    }
+};
+
+//
+// HR period update set for ePWM1..6, committed with one global load. The
+// sync master ePWM1 is in it so every module moves to a new period together.
+//
+HRPWM_UPDATE hrUpdate[HR_UPDATES];
+
+//
+// DAB modulator, legs ePWM3..6 (hrUpdate[2..5])
+//
+DAB_MOD dab;
+
+//
+// Interleaved boost, phase 0 on ePWM1, phase 1 on ePWM2 (hrUpdate[1])
+//
+IBC_DRV ibc;
 
 
 //
@@ -126,6 +277,7 @@ void main(void)
     // Initialize device clock and peripherals
     //
     InitSysCtrl();
+    initTimebase();
 
     //
     // Initialize GPIO
@@ -165,13 +317,46 @@ void main(void)
     //
     // ePWM and HRPWM register initialization
     //
-    for(i=1; i<12; i++)
+    for(i=1; i<PWM_CH; i++)
     {
         // Change clock divider to /1
         // (PWM clock needs to be > 60MHz)
         (*ePWM[i]).TBCTL.bit.HSPCLKDIV = 0;
     }    
-    configHRPWM(500);
+    configHRPWM(PWM_PERIOD);
+
+    //
+    // All modules latch period/compare updates together on ePWM1 CTR = 0
+    //
+    initHRPWMGlobalLoad(&ePWM[1], EPWM_MODULES, &EPwm1Regs, HRPWM_LINK_EPWM1);
+
+    for(i=0; i<HR_UPDATES; i++)
+    {
+        hrUpdate[i].regs    = ePWM[i + 1];
+        hrUpdate[i].tbprd   = PWM_PERIOD;
+        hrUpdate[i].tbprdhr = 0;
+        hrUpdate[i].cmpa    = PWM_PERIOD / 2;
+        hrUpdate[i].cmpahr  = epwmCfg[i].cmpahr;
+        hrUpdate[i].cmpb    = PWM_PERIOD / 2;
+        hrUpdate[i].cmpbhr  = epwmCfg[i].cmpbhr;
+        hrUpdate[i].tbphs   = epwmCfg[i].tbphs;
+        hrUpdate[i].tbphshr = epwmCfg[i].tbphshr;
+    }
+
+    //
+    // DAB legs: primary ePWM5/6 at 0/180 degrees, the lagging primary leg
+    // moved by the inner angle; secondary ePWM3/4 follow the outer phase
+    //
+    initDAB(&dab, &EPwm1Regs, PWM_PERIOD);
+    dabAddLeg(&dab, &hrUpdate[4], 0, 0);
+    dabAddLeg(&dab, &hrUpdate[5], DAB_HALF_PERIOD, DAB_LEG_INNER);
+    dabAddLeg(&dab, &hrUpdate[2], 0, DAB_LEG_PHASE);
+    dabAddLeg(&dab, &hrUpdate[3], DAB_HALF_PERIOD, DAB_LEG_PHASE);
+    DabPhase = DAB_PHASE_INIT;
+    DabInner = DAB_INNER_INIT;
+
+    initIBC(&ibc, &EPwm1Regs, &hrUpdate[1], IBC_PHASES, PWM_PERIOD);
+    IbcLoad = IBC_LOAD_INIT;
     
     //
     // Calling SFO() updates the HRMSTEP register with calibrated MEP_ScaleFactor.
@@ -191,13 +376,20 @@ void main(void)
 
     }
 
+    //
+    // From here on calibration runs on its own period with a bounded cost
+    // per background call
+    //
+    initSFOSched(SFO_PERIOD, SFO_BUDGET, SFO_THRESHOLD);
+
 
     for(;;)
     {
         //
-        // Sweep PeriodFine as a Q16 number from 0.2 - 0.999
+        // Sweep PeriodFine as a Q16 number from 0.2 - 0.999, one step per
+        // accepted update set
         //
-        for(PeriodFine = 0x3333; PeriodFine < 0xFFBF; PeriodFine++)
+        for(PeriodFine = 0x3333; PeriodFine < 0xFFBF; )
         {
             if(UpdateFine)
             {
@@ -218,9 +410,9 @@ void main(void)
                 // MEP delay movement = ((TBPRDHR(15:0) >> 8) *  HRMSTEP(7:0) +
                 //                       0x80) >> 8
                 //
-                for(i=2; i<12; i++)
+                for(i=0; i<HR_UPDATES; i++)
                 {
-                    (*ePWM[i]).TBPRDHR = PeriodFine; //In Q16 format
+                    hrUpdate[i].tbprdhr = PeriodFine; //In Q16 format
                 }
             }
             else
@@ -228,22 +420,38 @@ void main(void)
                 //
                 // No high-resolution movement on TBPRDHR.
                 //
-                for(i=1; i<12; i++)
+                for(i=0; i<HR_UPDATES; i++)
                 {
-                    (*ePWM[i]).TBPRDHR = 0;
+                    hrUpdate[i].tbprdhr = 0;
                 }
             }
 
             //
-            // Call the scale factor optimizer lib function SFO(0)
-            // periodically to track for any change due to temp/voltage.
-            // This function generates MEP_ScaleFactor by running the
-            // MEP calibration module in the HRPWM logic. This scale
-            // factor can be used for all HRPWM channels. HRMSTEP
-            // register is automatically updated by the SFO function.
+            // Stage every module once and latch them all in the next
+            // period; the DAB and IBC phases load on the master sync armed
+            // by the commits. Until the previous set has latched nothing
+            // is staged or armed: hrUpdate[] keeps this step pending, the
+            // next pass rewrites it with the latest values and PeriodFine
+            // only moves on once a set has gone through.
             //
-            status = SFO(); // in background, MEP calibration module
-                            // continuously updates MEP_ScaleFactor
+            ibcAutoPhase(&ibc, IbcLoad);
+            ibcModulate(&ibc);
+            dabModulate(&dab, DabPhase, DabInner);
+            if(updateHRPWM(hrUpdate, HR_UPDATES))
+            {
+                ibcCommit(&ibc);
+                dabCommit(&dab);
+                PeriodFine++;
+            }
+
+            //
+            // Run the scale factor optimizer in the background to track
+            // any change due to temp/voltage. sfoSchedRun() starts an MEP
+            // calibration every SFO_PERIOD and spends at most SFO_BUDGET
+            // per call on it. HRMSTEP register is automatically updated
+            // by the SFO function.
+            //
+            status = sfoSchedRun();
 
             if(status == SFO_ERROR)
             {
@@ -260,418 +468,7 @@ void main(void)
 //
 void configHRPWM(uint16_t period)
 {
-    uint16_t j,k;
-
-    //
-    // ePWM channel register configuration with HRPWM
-    // ePWMxA toggle low/high with MEP control on Rising edge
-    //
-    EALLOW;
-    CpuSysRegs.PCLKCR0.bit.TBCLKSYNC = 1;   // Disable TBCLK within the EPWM
-    EDIS;
-
-
-    // IBC PWM INITIALIZATION /////
-
-
-
-    EPwm1Regs.TBCTL.bit.PRDLD = TB_SHADOW;  // set Shadow load
-    EPwm1Regs.TBPRD = period;               // PWM frequency = 1/(2*TBPRD)
-    EPwm1Regs.CMPA.bit.CMPA = period / 2;   // set duty 50% initially
-    EPwm1Regs.CMPA.bit.CMPAHR = (1 << 8);   // initialize HRPWM extension
-    EPwm1Regs.CMPB.bit.CMPB = period / 2;   // set duty 50% initially
-    EPwm1Regs.CMPB.all |= 1;
-  //  (*ePWM[1]).TBPHS.all = 0;
-    EPwm1Regs.TBCTR = 0;
-    EPwm1Regs.DBCTL.bit.HALFCYCLE =1;
-
-    EPwm1Regs.TBCTL.bit.CTRMODE = TB_COUNT_UPDOWN; // Select up-down
-                                                    // count mode
-    EPwm1Regs.TBCTL.bit.SYNCOSEL = TB_SYNC_DISABLE;
-    EPwm1Regs.TBCTL.bit.HSPCLKDIV = TB_DIV1;
-    EPwm1Regs.TBCTL.bit.CLKDIV = TB_DIV1;          // TBCLK = SYSCLKOUT
-    EPwm1Regs.TBCTL.bit.FREE_SOFT = 11;
-
-    EPwm1Regs.DBCTL.bit.OUT_MODE = 3;   // ePWM1A = RED
-    EPwm1Regs.DBCTL.bit.IN_MODE = 0;    // ePWM1A = source for RED & FED
-
-
-
-    EPwm1Regs.CMPCTL.bit.LOADAMODE = CC_CTR_ZERO;  // LOAD CMPA on CTR = 0
-    EPwm1Regs.CMPCTL.bit.LOADBMODE = CC_CTR_ZERO;
-    EPwm1Regs.CMPCTL.bit.SHDWAMODE = CC_SHADOW;
-    EPwm1Regs.CMPCTL.bit.SHDWBMODE = CC_SHADOW;
-
-    EPwm1Regs.AQCTLA.bit.CAU = AQ_CLEAR;// AQ_SET;             // PWM toggle high/low
-    EPwm1Regs.AQCTLA.bit.CAD = AQ_SET;//  AQ_CLEAR;
-    EPwm1Regs.AQCTLB.bit.CBU = AQ_SET;             // PWM toggle high/low
-    EPwm1Regs.AQCTLB.bit.CBD = AQ_CLEAR;
-
-
-
-    EPwm1Regs.HRCNFG.all = 0x0;
-    EPwm1Regs.HRCNFG.bit.EDGMODE = HR_BEP;          // MEP control on
-                                                    // both edges.
-    EPwm1Regs.HRCNFG.bit.CTLMODE = HR_CMP;          // CMPAHR and TBPRDHR
-                                                     // HR control.
-    EPwm1Regs.HRCNFG.bit.HRLOAD = HR_CTR_ZERO_PRD;  // load on CTR = 0
-                                                     // and CTR = TBPRD
-    EPwm1Regs.HRCNFG.bit.EDGMODEB = HR_BEP;         // MEP control on
-                                                     // both edges
-    EPwm1Regs.HRCNFG.bit.CTLMODEB = 1;         // CMPBHR and TBPRDHR
-                                                     // HR control
-    EPwm1Regs.HRCNFG.bit.HRLOADB = HR_CTR_ZERO_PRD; // load on CTR = 0
-                                                     // and CTR = TBPRD
-    EPwm1Regs.HRCNFG.bit.AUTOCONV = 1;        // Enable autoconversion for
-                                               // HR period
-
-    EPwm1Regs.HRPCTL.bit.TBPHSHRLOADE = 1;    // Enable TBPHSHR sync
-                                               // (required for updwn
-                                               //  count HR control)
-    EPwm1Regs.HRPCTL.bit.HRPE = 1;            // Turn on high-resolution
-                                               // period control.
-
-    CpuSysRegs.PCLKCR0.bit.TBCLKSYNC = 1;      // Enable TBCLK within
-                                               // the EPWM
- //   EPwm1Regs.TBCTL.bit.SWFSYNC = 1;          // Synchronize high
-
-                                               // resolution phase to
-                                               // start HR period
-
-
-
-//PWM2
-
-    EPwm2Regs.TBCTL.bit.PRDLD = TB_SHADOW;  // set Shadow load
-    EPwm2Regs.TBPRD = period;               // PWM frequency = 1/(2*TBPRD)
-    EPwm2Regs.CMPA.bit.CMPA = period / 2;   // set duty 50% initially
-    EPwm2Regs.CMPA.bit.CMPAHR = (1 << 8);   // initialize HRPWM extension
-    EPwm2Regs.CMPB.bit.CMPB = period / 2;   // set duty 50% initially
-    EPwm2Regs.CMPB.all |= 1;
-//    (*ePWM[2]).TBPHS.all = 0;
-    EPwm2Regs.TBCTR = 0;
-    EPwm2Regs.DBCTL.bit.HALFCYCLE =1;
-    EPwm2Regs.TBCTL.bit.PHSEN = 1;        // enable phase shift for ePWM2
-
-    EPwm2Regs.TBCTL.bit.CTRMODE = TB_COUNT_UPDOWN; // Select up-down
-                                                    // count mode
-    EPwm2Regs.TBCTL.bit.SYNCOSEL = 0;
-    EPwm2Regs.TBCTL.bit.HSPCLKDIV = TB_DIV1;
-    EPwm2Regs.TBCTL.bit.CLKDIV = TB_DIV1;          // TBCLK = SYSCLKOUT
-    EPwm2Regs.TBCTL.bit.FREE_SOFT = 11;
-
-
-    EPwm2Regs.DBCTL.bit.OUT_MODE = 3;   // ePWM1A = RED
-    EPwm2Regs.DBCTL.bit.IN_MODE = 0;    // ePWM1A = source for RED & FED
-
-
-    EPwm2Regs.CMPCTL.bit.LOADAMODE = CC_CTR_ZERO;  // LOAD CMPA on CTR = 0
-    EPwm2Regs.CMPCTL.bit.LOADBMODE = CC_CTR_ZERO;
-    EPwm2Regs.CMPCTL.bit.SHDWAMODE = CC_SHADOW;
-    EPwm2Regs.CMPCTL.bit.SHDWBMODE = CC_SHADOW;
-
-    EPwm2Regs.AQCTLA.bit.CAU = AQ_CLEAR;// AQ_SET;             // PWM toggle high/low
-    EPwm2Regs.AQCTLA.bit.CAD = AQ_SET;//  AQ_CLEAR;
-    EPwm2Regs.AQCTLB.bit.CBU = AQ_SET;             // PWM toggle high/low
-    EPwm2Regs.AQCTLB.bit.CBD = AQ_CLEAR;
-
-    EPwm2Regs.HRCNFG.all = 0x0;
-    EPwm2Regs.HRCNFG.bit.EDGMODE = HR_BEP;          // MEP control on
-                                                    // both edges.
-    EPwm2Regs.HRCNFG.bit.CTLMODE = HR_CMP;          // CMPAHR and TBPRDHR
-                                                     // HR control.
-    EPwm2Regs.HRCNFG.bit.HRLOAD = HR_CTR_ZERO_PRD;  // load on CTR = 0
-                                                     // and CTR = TBPRD
-    EPwm2Regs.HRCNFG.bit.EDGMODEB = HR_BEP;         // MEP control on
-                                                     // both edges
-    EPwm2Regs.HRCNFG.bit.CTLMODEB = 1;         // CMPBHR and TBPRDHR
-                                                    // HR control
-    EPwm2Regs.HRCNFG.bit.HRLOADB = HR_CTR_ZERO_PRD; // load on CTR = 0
-                                                     // and CTR = TBPRD
-    EPwm2Regs.HRCNFG.bit.AUTOCONV = 1;        // Enable autoconversion for
-                                               // HR period
-
-    EPwm2Regs.HRPCTL.bit.TBPHSHRLOADE = 1;    // Enable TBPHSHR sync
-                                               // (required for updwn
-                                               //  count HR control)
-    EPwm2Regs.HRPCTL.bit.HRPE = 1;            // Turn on high-resolution
-                                               // period control.
-    EPwm2Regs.TBPHS.bit.TBPHS = 0; // 750 for  minimum voltage  phase shift 695=100
-    EPwm2Regs.TBPHS.bit.TBPHSHR = 1; // 750 for  minimum voltage  phase shift 695=100
-
-    EPwm2Regs.TRREM.bit.TRREM = 0; // 750 for  minimum voltage  phase shift 695=100
-
-
-    CpuSysRegs.PCLKCR0.bit.TBCLKSYNC = 1;      // Enable TBCLK within
-
-                                               // the EPWM
-    EPwm2Regs.TBCTL.bit.SWFSYNC = 1;          // Synchronize high
-                                               // resolution phase to
-                                               // start HR period
-
-
-
-
-
-
-
-    // DAB SECONDry PWM INITIALIZATION
-
-
-    EPwm3Regs.TBCTL.bit.PRDLD = TB_SHADOW;  // set Shadow load
-    EPwm3Regs.TBPRD = period;               // PWM frequency = 1/(2*TBPRD)
-    EPwm3Regs.CMPA.bit.CMPA = period / 2;   // set duty 50% initially
-    EPwm3Regs.CMPA.bit.CMPAHR = (1 << 8);   // initialize HRPWM extension
-    EPwm3Regs.CMPB.bit.CMPB = period / 2;   // set duty 50% initially
-    EPwm3Regs.CMPB.all |= 1;
-     //      (*ePWM[3]).TBPHS.all = 0;
-    EPwm3Regs.TBCTR = 0;
-
-    EPwm3Regs.TBCTL.bit.CTRMODE = TB_COUNT_UPDOWN; // Select up-down
-                                                           // count mode
-    EPwm3Regs.TBCTL.bit.SYNCOSEL = 0;
-    EPwm3Regs.TBCTL.bit.HSPCLKDIV = TB_DIV1;
-    EPwm3Regs.TBCTL.bit.CLKDIV = TB_DIV1;          // TBCLK = SYSCLKOUT
-    EPwm3Regs.TBCTL.bit.FREE_SOFT = 11;
-    EPwm3Regs.TBCTL.bit.PHSEN = 1;        // enable phase shift for ePWM2
-           //(*ePWM[k]).TBCTL.bit.PHSEN = 1;
-
-    EPwm3Regs.DBCTL.bit.OUT_MODE = 3;   // ePWM1A = RED
-    EPwm3Regs.DBCTL.bit.IN_MODE = 0;    // ePWM1A = source for RED & FED
-
-
-    EPwm3Regs.CMPCTL.bit.LOADAMODE = CC_CTR_ZERO;  // LOAD CMPA on CTR = 0
-    EPwm3Regs.CMPCTL.bit.LOADBMODE = CC_CTR_ZERO;
-    EPwm3Regs.CMPCTL.bit.SHDWAMODE = CC_SHADOW;
-    EPwm3Regs.CMPCTL.bit.SHDWBMODE = CC_SHADOW;
-
-    EPwm3Regs.AQCTLA.bit.CAU = AQ_CLEAR;// AQ_SET;             // PWM toggle high/low
-    EPwm3Regs.AQCTLA.bit.CAD = AQ_SET;//  AQ_CLEAR;
-    EPwm3Regs.AQCTLB.bit.CBU = AQ_SET;             // PWM toggle high/low
-    EPwm3Regs.AQCTLB.bit.CBD = AQ_CLEAR;
-
-    EPwm3Regs.HRCNFG.all = 0x0;
-    EPwm3Regs.HRCNFG.bit.EDGMODE = HR_BEP;          // MEP control on
-                                                            // both edges.
-    EPwm3Regs.HRCNFG.bit.CTLMODE = HR_CMP;          // CMPAHR and TBPRDHR
-                                                            // HR control.
-    EPwm3Regs.HRCNFG.bit.HRLOAD = HR_CTR_ZERO_PRD;  // load on CTR = 0
-                                                            // and CTR = TBPRD
-    EPwm3Regs.HRCNFG.bit.EDGMODEB = HR_BEP;         // MEP control on
-                                                            // both edges
-    EPwm3Regs.HRCNFG.bit.CTLMODEB = HR_CMP;         // CMPBHR and TBPRDHR
-                                                            // HR control
-    EPwm3Regs.HRCNFG.bit.HRLOADB = HR_CTR_ZERO_PRD; // load on CTR = 0
-                                                            // and CTR = TBPRD
-    EPwm3Regs.HRCNFG.bit.AUTOCONV = 1;        // Enable autoconversion for
-                                                      // HR period
-
-    EPwm3Regs.HRPCTL.bit.TBPHSHRLOADE = 1;    // Enable TBPHSHR sync
-                                                      // (required for updwn
-                                                      //  count HR control)
-    EPwm3Regs.HRPCTL.bit.HRPE = 1;            // Turn on high-resolution
-                                                      // period control.
-    EPwm3Regs.TBPHS.bit.TBPHS = 0; // 750 for  minimum voltage  phase shift 695=100
-
-    EPwm3Regs.TRREM.bit.TRREM = 0; // 750 for  minimum voltage  phase shift 695=100
-
-    CpuSysRegs.PCLKCR0.bit.TBCLKSYNC = 1;      // Enable TBCLK within
-                                                      // the EPWM
-    EPwm3Regs.TBCTL.bit.SWFSYNC = 1;          // Synchronize high
-                                                      // resolution phase to
-                                                      // start HR period
-
-
-
-
-     EPwm4Regs.TBCTL.bit.PRDLD = TB_SHADOW;  // set Shadow load
-         //     (*ePWM[k]).TBCTL2.bit.PRDLDSYNC = 0x2;  // set Shadow load
-     EPwm4Regs.TBPRD = period;               // PWM frequency = 1/(2*TBPRD)
-     EPwm4Regs.CMPA.bit.CMPA = period / 2;   // set duty 50% initially
-     EPwm4Regs.CMPA.bit.CMPAHR = (1 << 8);   // initialize HRPWM extension
-     EPwm4Regs.CMPB.bit.CMPB = period / 2;   // set duty 50% initially
-     EPwm4Regs.CMPB.all |= 1;
-   //           (*ePWM[4]).TBPHS.all = 0;
-     EPwm4Regs.TBCTR = 0;
-
-     EPwm4Regs.TBCTL.bit.CTRMODE = TB_COUNT_UPDOWN; // Select up-down
-                                                              // count mode
-     EPwm4Regs.TBCTL.bit.SYNCOSEL = 0;
-     EPwm4Regs.TBCTL.bit.HSPCLKDIV = TB_DIV1;
-     EPwm4Regs.TBCTL.bit.CLKDIV = TB_DIV1;          // TBCLK = SYSCLKOUT
-     EPwm4Regs.TBCTL.bit.FREE_SOFT = 11;
-     EPwm4Regs.TBCTL.bit.PHSEN = 1;        // enable phase shift for ePWM2
-
-     EPwm4Regs.DBCTL.bit.OUT_MODE = 2;   // ePWM1A = RED
-     EPwm4Regs.DBCTL.bit.IN_MODE = 0;    // ePWM1A = source for RED & FED
-
-
-     EPwm4Regs.CMPCTL.bit.LOADAMODE = CC_CTR_ZERO;  // LOAD CMPA on CTR = 0
-     EPwm4Regs.CMPCTL.bit.LOADBMODE = CC_CTR_ZERO;
-     EPwm4Regs.CMPCTL.bit.SHDWAMODE = CC_SHADOW;
-     EPwm4Regs.CMPCTL.bit.SHDWBMODE = CC_SHADOW;
-
-     EPwm4Regs.AQCTLA.bit.CAU = AQ_CLEAR;// AQ_SET;             // PWM toggle high/low
-     EPwm4Regs.AQCTLA.bit.CAD = AQ_SET;//  AQ_CLEAR;
-     EPwm4Regs.AQCTLB.bit.CBU = AQ_SET;             // PWM toggle high/low
-     EPwm4Regs.AQCTLB.bit.CBD = AQ_CLEAR;
-
-      EPwm4Regs.HRCNFG.all = 0x0;
-      EPwm4Regs.HRCNFG.bit.EDGMODE = HR_BEP;          // MEP control on
-                                                               // both edges.
-      EPwm4Regs.HRCNFG.bit.CTLMODE = HR_CMP;          // CMPAHR and TBPRDHR
-                                                               // HR control.
-      EPwm4Regs.HRCNFG.bit.HRLOAD = HR_CTR_ZERO_PRD;  // load on CTR = 0
-                                                               // and CTR = TBPRD
-      EPwm4Regs.HRCNFG.bit.EDGMODEB = HR_BEP;         // MEP control on
-                                                               // both edges
-      EPwm4Regs.HRCNFG.bit.CTLMODEB = 1;         // CMPBHR and TBPRDHR
-                                                               // HR control
-      EPwm4Regs.HRCNFG.bit.HRLOADB = HR_CTR_ZERO_PRD; // load on CTR = 0
-                                                               // and CTR = TBPRD
-      EPwm4Regs.HRCNFG.bit.AUTOCONV = 1;        // Enable autoconversion for
-                                                         // HR period
-
-      EPwm4Regs.HRPCTL.bit.TBPHSHRLOADE = 1;    // Enable TBPHSHR sync
-                                                         // (required for updwn
-                                                         //  count HR control)
-      EPwm4Regs.HRPCTL.bit.HRPE = 1;            // Turn on high-resolution
-                                                         // period control.
-      EPwm4Regs.TBPHS.bit.TBPHS = 0; // 750 for  minimum voltage  phase shift 695=100
-      EPwm4Regs.TRREM.bit.TRREM = 0; // 750 for  minimum voltage  phase shift 695=100
-
-      CpuSysRegs.PCLKCR0.bit.TBCLKSYNC = 1;      // Enable TBCLK within
-                                                         // the EPWM
-      EPwm4Regs.TBCTL.bit.SWFSYNC = 1;          // Synchronize high
-                                                         // resolution phase to
-                                                         // start HR period
-
-
-
-
-      EPwm5Regs.TBCTL.bit.PRDLD = TB_SHADOW;  // set Shadow load
-          //     (*ePWM[k]).TBCTL2.bit.PRDLDSYNC = 0x2;  // set Shadow load
-      EPwm5Regs.TBPRD = period;               // PWM frequency = 1/(2*TBPRD)
-      EPwm5Regs.CMPA.bit.CMPA = period / 2;   // set duty 50% initially
-      EPwm5Regs.CMPA.bit.CMPAHR = (1 << 8);   // initialize HRPWM extension
-      EPwm5Regs.CMPB.bit.CMPB = period / 2;   // set duty 50% initially
-      EPwm5Regs.CMPB.all |= 1;
-    //           (*ePWM[4]).TBPHS.all = 0;
-      EPwm5Regs.TBCTR = 0;
-
-      EPwm5Regs.TBCTL.bit.CTRMODE = TB_COUNT_UPDOWN; // Select up-down
-                                                               // count mode
-      EPwm5Regs.TBCTL.bit.SYNCOSEL = 0;
-      EPwm5Regs.TBCTL.bit.HSPCLKDIV = TB_DIV1;
-      EPwm5Regs.TBCTL.bit.CLKDIV = TB_DIV1;          // TBCLK = SYSCLKOUT
-      EPwm5Regs.TBCTL.bit.FREE_SOFT = 11;
-      EPwm5Regs.TBCTL.bit.PHSEN = 1;        // enable phase shift for ePWM2
-
-      EPwm5Regs.CMPCTL.bit.LOADAMODE = CC_CTR_ZERO;  // LOAD CMPA on CTR = 0
-      EPwm5Regs.CMPCTL.bit.LOADBMODE = CC_CTR_ZERO;
-      EPwm5Regs.CMPCTL.bit.SHDWAMODE = CC_SHADOW;
-      EPwm5Regs.CMPCTL.bit.SHDWBMODE = CC_SHADOW;
-
-      EPwm5Regs.AQCTLA.bit.CAU = AQ_CLEAR;// AQ_SET;             // PWM toggle high/low
-      EPwm5Regs.AQCTLA.bit.CAD = AQ_SET;//  AQ_CLEAR;
-      EPwm5Regs.AQCTLB.bit.CBU = AQ_SET;             // PWM toggle high/low
-      EPwm5Regs.AQCTLB.bit.CBD = AQ_CLEAR;
-
-       EPwm5Regs.HRCNFG.all = 0x0;
-       EPwm5Regs.HRCNFG.bit.EDGMODE = HR_BEP;          // MEP control on
-                                                                // both edges.
-       EPwm5Regs.HRCNFG.bit.CTLMODE = HR_CMP;          // CMPAHR and TBPRDHR
-                                                                // HR control.
-       EPwm5Regs.HRCNFG.bit.HRLOAD = HR_CTR_ZERO_PRD;  // load on CTR = 0
-                                                                // and CTR = TBPRD
-       EPwm5Regs.HRCNFG.bit.EDGMODEB = HR_BEP;         // MEP control on
-                                                                // both edges
-       EPwm5Regs.HRCNFG.bit.CTLMODEB = 1;         // CMPBHR and TBPRDHR
-                                                                // HR control
-       EPwm5Regs.HRCNFG.bit.HRLOADB = HR_CTR_ZERO_PRD; // load on CTR = 0
-                                                                // and CTR = TBPRD
-       EPwm5Regs.HRCNFG.bit.AUTOCONV = 1;        // Enable autoconversion for
-                                                          // HR period
-
-       EPwm5Regs.HRPCTL.bit.TBPHSHRLOADE = 1;    // Enable TBPHSHR sync
-                                                          // (required for updwn
-                                                          //  count HR control)
-       EPwm5Regs.HRPCTL.bit.HRPE = 1;            // Turn on high-resolution
-                                                          // period control.
-       EPwm5Regs.TBPHS.bit.TBPHS = 0; // 750 for  minimum voltage  phase shift 695=100
-       EPwm5Regs.TRREM.bit.TRREM = 0; // 750 for  minimum voltage  phase shift 695=100
-
-       CpuSysRegs.PCLKCR0.bit.TBCLKSYNC = 1;      // Enable TBCLK within
-                                                          // the EPWM
-       EPwm5Regs.TBCTL.bit.SWFSYNC = 1;          // Synchronize high
-                                                          // resolution phase to
-                                                          // start HR period
-
-
-
-       EPwm6Regs.TBCTL.bit.PRDLD = TB_SHADOW;  // set Shadow load
-              //     (*ePWM[k]).TBCTL2.bit.PRDLDSYNC = 0x2;  // set Shadow load
-          EPwm6Regs.TBPRD = period;               // PWM frequency = 1/(2*TBPRD)
-          EPwm6Regs.CMPA.bit.CMPA = period / 2;   // set duty 50% initially
-          EPwm6Regs.CMPA.bit.CMPAHR = (1 << 8);   // initialize HRPWM extension
-          EPwm6Regs.CMPB.bit.CMPB = period / 2;   // set duty 50% initially
-          EPwm6Regs.CMPB.all |= 1;
-        //           (*ePWM[4]).TBPHS.all = 0;
-          EPwm6Regs.TBCTR = 0;
-
-          EPwm6Regs.TBCTL.bit.CTRMODE = TB_COUNT_UPDOWN; // Select up-down
-                                                                   // count mode
-          EPwm6Regs.TBCTL.bit.SYNCOSEL = 0;
-          EPwm6Regs.TBCTL.bit.HSPCLKDIV = TB_DIV1;
-          EPwm6Regs.TBCTL.bit.CLKDIV = TB_DIV1;          // TBCLK = SYSCLKOUT
-          EPwm6Regs.TBCTL.bit.FREE_SOFT = 11;
-          EPwm6Regs.TBCTL.bit.PHSEN = 1;        // enable phase shift for ePWM2
-
-          EPwm6Regs.CMPCTL.bit.LOADAMODE = CC_CTR_ZERO;  // LOAD CMPA on CTR = 0
-          EPwm6Regs.CMPCTL.bit.LOADBMODE = CC_CTR_ZERO;
-          EPwm6Regs.CMPCTL.bit.SHDWAMODE = CC_SHADOW;
-          EPwm6Regs.CMPCTL.bit.SHDWBMODE = CC_SHADOW;
-
-          EPwm6Regs.AQCTLA.bit.CAU = AQ_CLEAR;// AQ_SET;             // PWM toggle high/low
-          EPwm6Regs.AQCTLA.bit.CAD = AQ_SET;//  AQ_CLEAR;
-          EPwm6Regs.AQCTLB.bit.CBU = AQ_SET;             // PWM toggle high/low
-          EPwm6Regs.AQCTLB.bit.CBD = AQ_CLEAR;
-
-           EALLOW;
-           EPwm6Regs.HRCNFG.all = 0x0;
-           EPwm6Regs.HRCNFG.bit.EDGMODE = HR_BEP;          // MEP control on
-                                                                    // both edges.
-           EPwm6Regs.HRCNFG.bit.CTLMODE = HR_CMP;          // CMPAHR and TBPRDHR
-                                                                    // HR control.
-           EPwm6Regs.HRCNFG.bit.HRLOAD = HR_CTR_ZERO_PRD;  // load on CTR = 0
-                                                                    // and CTR = TBPRD
-           EPwm6Regs.HRCNFG.bit.EDGMODEB = HR_BEP;         // MEP control on
-                                                                    // both edges
-           EPwm6Regs.HRCNFG.bit.CTLMODEB = 1;         // CMPBHR and TBPRDHR
-                                                                    // HR control
-           EPwm6Regs.HRCNFG.bit.HRLOADB = HR_CTR_ZERO_PRD; // load on CTR = 0
-                                                                    // and CTR = TBPRD
-           EPwm6Regs.HRCNFG.bit.AUTOCONV = 1;        // Enable autoconversion for
-                                                              // HR period
-
-           EPwm6Regs.HRPCTL.bit.TBPHSHRLOADE = 1;    // Enable TBPHSHR sync
-                                                              // (required for updwn
-                                                              //  count HR control)
-           EPwm6Regs.HRPCTL.bit.HRPE = 1;            // Turn on high-resolution
-                                                              // period control.
-           EPwm6Regs.TBPHS.bit.TBPHS = 0; // 750 for  minimum voltage  phase shift 695=100
-           EPwm6Regs.TRREM.bit.TRREM = 0; // 750 for  minimum voltage  phase shift 695=100
-
-           CpuSysRegs.PCLKCR0.bit.TBCLKSYNC = 1;      // Enable TBCLK within
-                                                              // the EPWM
-           EPwm6Regs.TBCTL.bit.SWFSYNC = 1;          // Synchronize high
-                                                              // resolution phase to
-                                                              // start HR period
-
-
-
-
-
+    configEPWMTable(epwmCfg, EPWM_MODULES, period);
 }
 
 //
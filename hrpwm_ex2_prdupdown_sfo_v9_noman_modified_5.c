@@ -87,6 +87,7 @@
 #include "PWM_CONFIG.h"
 #include "ADC_CONFIG.h"
 #include "GPIO_CONFIG.h"
+#include "SCHEDULER.h"
 extern void InitCpuTimers(void);
 extern void ConfigCpuTimer(struct CPUTIMER_VARS *, float, float);
 extern void Init_ADC_converter(void);
@@ -99,6 +100,7 @@ __interrupt void adcA1ISR(void);
 #define PWM_CH            3        // # of PWM channels - 1
 #define STATUS_SUCCESS    1
 #define STATUS_FAIL       0
+#define SWEEP_TICKS       (20 * (PWM_CH - 1))   // 2ms per PWM channel
 #define RESULTS_BUFFER_SIZE     256
 int32  adcAResults1=0;
 uint16_t adcAResults[RESULTS_BUFFER_SIZE];   // Buffer for results
@@ -126,6 +128,15 @@ volatile struct EPWM_REGS *ePWM[PWM_CH] = {&EPwm1Regs, &EPwm1Regs};
 void initHRPWM1GPIO(void);
 void configHRPWM(uint16_t period);
 void error(void);
+void sweepTask(void);
+void sfoTask(void);
+
+// Background tasks, fastest first
+SCHED_TASK schedTasks[] =
+{
+    {sweepTask, SWEEP_TICKS}
+};
+#define SCHED_TASKS (sizeof(schedTasks) / sizeof(schedTasks[0]))
 
 //
 // Main
@@ -160,6 +171,7 @@ void main(void)
     InitPieVectTable();
     EALLOW;
     PieVectTable.ADCA1_INT = &adcA1ISR;     // Function for ADCA interrupt 1
+    PieVectTable.TIMER0_INT = &schedTickISR;    // Scheduler tick
     EDIS;
     //
 
@@ -208,6 +220,7 @@ void main(void)
 
 
     PieCtrlRegs.PIEIER1.bit.INTx1 = 1;
+    PieCtrlRegs.PIEIER1.bit.INTx7 = 1;
     //
     // ePWM and HRPWM register initialization
     //
@@ -238,48 +251,15 @@ void main(void)
 
 
 
+    //
+    // Background tasks share the CPU through the scheduler instead of
+    // busy-waiting; SFO() calibration runs whenever no task is due
+    //
+    initScheduler(schedTasks, SCHED_TASKS, sfoTask);
+
     for(;;)
     {
-       // adcAResults1 = AdcaResultRegs.ADCRESULT0;
-        //
-        // Sweep PeriodFine as a Q16 number from 0.2 - 0.999
-        //
-        for(PeriodFine = 0x3333; PeriodFine < 0xFFFF; PeriodFine++)
-        {
-            if(UpdateFine)
-            {
-                //
-
-                for(i=1; i<PWM_CH; i++)
-                {
-                    DELAY_US(2000);
-                 //   (*ePWM[i]).TBPRDHR = PeriodFine; //In Q16 format
-                  // EPwm2Regs.TBPHS.bit.TBPHSHR = PeriodFine;  // 750 for  minimum voltage  phase shift 695=100
-
-                }
-            }
-            else
-            {
-                //
-                // No high-resolution movement on TBPRDHR.
-                //
-                for(i=1; i<PWM_CH; i++)
-                {
-                    (*ePWM[i]).TBPRDHR = 0;
-                }
-            }
-
-
-            //
-            status = SFO(); // in background, MEP calibration module
-                            // continuously updates MEP_ScaleFactor
-
-            if(status == SFO_ERROR)
-            {
-                error();   // SFO function returns 2 if an error occurs & # of
-                           // MEP steps/coarse step exceeds maximum of 255.
-            }
-        } // end PeriodFine for loop
+        schedRun();
     } // end infinite for loop
 
 
@@ -290,6 +270,53 @@ void main(void)
 
 
 
+//
+// sweepTask - Step PeriodFine as a Q16 number from 0.2 - 0.999
+//
+void sweepTask(void)
+{
+    uint16_t i;
+
+    PeriodFine++;
+    if((PeriodFine < 0x3333) || (PeriodFine >= 0xFFFF))
+    {
+        PeriodFine = 0x3333;
+    }
+
+    if(UpdateFine)
+    {
+        //
+        // (*ePWM[i]).TBPRDHR = PeriodFine; //In Q16 format
+        // EPwm2Regs.TBPHS.bit.TBPHSHR = PeriodFine;  // 750 for  minimum voltage  phase shift 695=100
+        //
+    }
+    else
+    {
+        //
+        // No high-resolution movement on TBPRDHR.
+        //
+        for(i=1; i<PWM_CH; i++)
+        {
+            (*ePWM[i]).TBPRDHR = 0;
+        }
+    }
+}
+
+//
+// sfoTask - Idle task, in background, MEP calibration module
+//           continuously updates MEP_ScaleFactor
+//
+void sfoTask(void)
+{
+    status = SFO();
+
+    if(status == SFO_ERROR)
+    {
+        error();   // SFO function returns 2 if an error occurs & # of
+                   // MEP steps/coarse step exceeds maximum of 255.
+    }
+}
+
 __interrupt void adcA1ISR(void)
 {
     //
@@ -0,0 +1,200 @@
+#!/usr/bin/env python
+#
+# mem_budget.py - Memory budget report and check for the C2000 link.
+#
+# Reads the linker's XML link information (--xml_link_info, written next to
+# the .out as <project>_linkInfo.xml) and prints
+#
+#   - per memory region: used / length / budget
+#   - per region group: summed used / length / budget
+#   - per region, the words each object file places there
+#   - where every hot section runs
+#
+# and exits with status 1 when a region is over its budget or a hot section
+# runs outside its allowed regions (e.g. .TI.ramfunc spilled into Flash or
+# Cla1Prog outside the CLA program RAM). It runs as the CCS post-build step:
+#
+#   python "${PROJECT_ROOT}/mem_budget.py" "${ProjName}_linkInfo.xml"
+#
+# The .map file carries the same data in text form; the XML is used because
+# it is stable to parse. Budgets are in 16-bit words and leave headroom below
+# the region length so growth is caught before the link fails.
+#
+
+import sys
+import xml.etree.ElementTree as ET
+
+#
+# Region budgets (words). Regions not listed are reported but not checked.
+#
+BUDGETS = {
+    "RAMM0":   0x300,
+    "RAMM1":   0x3F8,
+    "RAMLS4":  0x800,       # CLA program
+    "RAMLS5":  0x780,
+    "RAMLS7":  0x800,       # CLA data
+}
+
+#
+# Group budgets (words) for regions the linker fills as one: .text and
+# .TI.ramfunc are split-allocated with >> RAMLS0 | RAMLS1 | RAMLS2 | RAMLS3,
+# which packs LS0 (then LS1) to the last word before spilling, so only the
+# sum says how much room is left.
+#
+GROUP_BUDGETS = {
+    "RAMLS0-3": (("RAMLS0", "RAMLS1", "RAMLS2", "RAMLS3"), 0x1E00),
+}
+
+#
+# Only memory regions are reported; the peripheral frames in the header
+# command file are left out
+#
+REGION_PREFIXES = ("BEGIN", "RAM", "FLASH_BANK", "CLA1_MSGRAM")
+
+#
+# Hot sections and the regions they must run from. A section split by the
+# linker (name.1, name.2, ...) is checked piece by piece.
+#
+HOT_SECTIONS = {
+    ".TI.ramfunc": ("RAMM0", "RAMLS0", "RAMLS1", "RAMLS2", "RAMLS3"),
+    "Cla1Prog":    ("RAMLS4",),
+}
+
+
+def num(node, tag):
+    text = node.findtext(tag)
+    return int(text, 0) if text is not None else 0
+
+
+def load(path):
+    root = ET.parse(path).getroot()
+
+    files = {}
+    for f in root.iter("input_file"):
+        files[f.get("id")] = f.findtext("name") or f.findtext("file")
+
+    comps = []
+    for oc in root.iter("object_component"):
+        if oc.findtext("name").startswith(".debug"):
+            continue
+        ref = oc.find("input_file_ref")
+        comps.append({
+            "name": oc.findtext("name"),
+            "run": num(oc, "run_address"),
+            "size": num(oc, "size"),
+            "file": files.get(ref.get("idref")) if ref is not None else "?",
+        })
+
+    groups = []
+    for lg in root.iter("logical_group"):
+        groups.append({
+            "name": lg.findtext("name"),
+            "run": num(lg, "run_address"),
+            "size": num(lg, "size"),
+        })
+
+    areas = []
+    for ma in root.iter("memory_area"):
+        if not ma.findtext("name").startswith(REGION_PREFIXES):
+            continue
+        areas.append({
+            "name": ma.findtext("name"),
+            "page": num(ma, "page_id"),
+            "origin": num(ma, "origin"),
+            "length": num(ma, "length"),
+            "used": num(ma, "used_space"),
+        })
+
+    return comps, groups, areas
+
+
+def area_of(areas, addr):
+    for a in areas:
+        if a["origin"] <= addr < a["origin"] + a["length"]:
+            return a
+    return None
+
+
+def main(argv):
+    if len(argv) != 2:
+        sys.stderr.write("usage: mem_budget.py <project>_linkInfo.xml\n")
+        return 2
+
+    comps, groups, areas = load(argv[1])
+    errors = []
+
+    #
+    # Regions
+    #
+    print("%-18s %8s %8s %8s" % ("region", "used", "length", "budget"))
+    for a in areas:
+        if a["used"] == 0:
+            continue
+        budget = BUDGETS.get(a["name"])
+        mark = ""
+        if budget is not None and a["used"] > budget:
+            mark = "  OVER"
+            errors.append("%s uses 0x%x words, budget 0x%x"
+                          % (a["name"], a["used"], budget))
+        print("%-18s %8s %8s %8s%s"
+              % (a["name"], "0x%x" % a["used"], "0x%x" % a["length"],
+                 "0x%x" % budget if budget is not None else "-", mark))
+
+    #
+    # Region groups
+    #
+    for name, (members, budget) in sorted(GROUP_BUDGETS.items()):
+        used = sum(a["used"] for a in areas if a["name"] in members)
+        length = sum(a["length"] for a in areas if a["name"] in members)
+        mark = ""
+        if used > budget:
+            mark = "  OVER"
+            errors.append("%s uses 0x%x words, budget 0x%x"
+                          % (name, used, budget))
+        print("%-18s %8s %8s %8s%s"
+              % (name, "0x%x" % used, "0x%x" % length, "0x%x" % budget,
+                 mark))
+
+    #
+    # Objects per region (run addresses, code and data together)
+    #
+    checked = set(BUDGETS)
+    for members, budget in GROUP_BUDGETS.values():
+        checked.update(members)
+
+    print("")
+    for a in areas:
+        if a["used"] == 0 or a["name"] not in checked:
+            continue
+        usage = {}
+        for c in comps:
+            if c["size"] and area_of([a], c["run"]):
+                key = "%s (%s)" % (c["file"], c["name"])
+                usage[key] = usage.get(key, 0) + c["size"]
+        print("%s:" % a["name"])
+        for key, size in sorted(usage.items(), key=lambda kv: -kv[1]):
+            print("  %6s  %s" % ("0x%x" % size, key))
+
+    #
+    # Hot sections
+    #
+    print("")
+    for name, allowed in sorted(HOT_SECTIONS.items()):
+        parts = [g for g in groups
+                 if g["name"] == name or g["name"].startswith(name + ".")]
+        for g in parts:
+            a = area_of(areas, g["run"])
+            where = a["name"] if a else "0x%x" % g["run"]
+            print("%-18s 0x%-6x runs in %s" % (g["name"], g["size"], where))
+            if g["size"] and where not in allowed:
+                errors.append("%s runs in %s, allowed %s"
+                              % (g["name"], where, ", ".join(allowed)))
+
+    for e in errors:
+        sys.stderr.write("mem_budget: error: %s\n" % e)
+
+    return 1 if errors else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
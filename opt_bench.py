@@ -0,0 +1,98 @@
+#!/usr/bin/env python
+#
+# opt_bench.py - Code size and cycle table across optimization builds.
+#
+# Takes one build directory per optimization level (or per set of per-file
+# overrides). The CCS optimizer assistant leaves these under
+# CPU1_RAM/optimizerAssistant/opt_level__*. For each build it prints the
+# code words per object file, from the linker's XML link info:
+#
+#   python opt_bench.py CPU1_RAM/optimizerAssistant/opt_level__*
+#
+# If a build directory also holds opt_bench.csv, a second table of cycle
+# counts is printed. bench_dump.js writes that file from isrStats[]
+# (ISR_PROFILE.h) and optBench[] (OPT_BENCH.h) by running the build on
+# target, one line per probe:
+#
+#   # name, min, max, mean (SYSCLKs)
+#   configHRPWM, 412, 412, 412
+#
+# Lines starting with '#' are ignored.
+#
+
+import glob
+import os
+import sys
+
+from mem_budget import load
+
+CODE_SECTIONS = (".text", ".TI.ramfunc", "Cla1Prog", "codestart")
+
+
+def code_size(xml):
+    comps, groups, areas = load(xml)
+    sizes = {}
+    for c in comps:
+        name = c["name"]
+        if name.startswith(CODE_SECTIONS):
+            sizes[c["file"]] = sizes.get(c["file"], 0) + c["size"]
+    return sizes
+
+
+def cycles(path):
+    rows = {}
+    if not os.path.exists(path):
+        return rows
+    with open(path) as f:
+        for line in f:
+            line = line.strip()
+            if not line or line.startswith("#"):
+                continue
+            fields = [x.strip() for x in line.split(",")]
+            rows[fields[0]] = fields[1:4]
+    return rows
+
+
+def table(title, builds, rows, cell):
+    width = max([len(r) for r in rows] + [len(title)])
+    print("%-*s" % (width, title) +
+          "".join(" %16s" % b for b in builds))
+    for r in rows:
+        print("%-*s" % (width, r) +
+              "".join(" %16s" % cell(b, r) for b in builds))
+
+
+def main(argv):
+    if len(argv) < 2:
+        sys.stderr.write("usage: opt_bench.py <build dir>...\n")
+        return 2
+
+    builds = []
+    sizes = {}
+    cyc = {}
+    for d in argv[1:]:
+        xml = glob.glob(os.path.join(d, "*_linkInfo.xml"))
+        if not xml:
+            sys.stderr.write("opt_bench: no link info in %s\n" % d)
+            continue
+        b = os.path.basename(os.path.normpath(d))
+        builds.append(b)
+        sizes[b] = code_size(xml[0])
+        cyc[b] = cycles(os.path.join(d, "opt_bench.csv"))
+
+    objs = sorted(set(o for b in builds for o in sizes[b]))
+    table("code words", builds, objs + ["total"],
+          lambda b, o: str(sum(sizes[b].values())) if o == "total"
+          else str(sizes[b].get(o, "-")))
+
+    probes = sorted(set(p for b in builds for p in cyc[b]))
+    if probes:
+        print("")
+        table("cycles min/max/mean", builds, probes,
+              lambda b, p: "/".join(cyc[b].get(p, ["-"])))
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,270 @@
+#!/usr/bin/env python
+#
+# tlm_decode.py - Decoder for the SCI telemetry stream (TELEMETRY.h).
+#
+# Reads frames from a serial port, checks sync, length and CRC, and prints
+# the fields of each frame or, with -q, one statistics line per second:
+#
+#   python tlm_decode.py /dev/ttyUSB0
+#   python tlm_decode.py -q /dev/ttyUSB0
+#
+# Missing sequence numbers are split into frames dropped on the target (the
+# frame's drops counter moved) and frames lost on the wire (bad CRC, lost
+# sync, host overrun).
+#
+# --sim runs the decoder without a board: a pseudo-terminal stands in for
+# the port and a thread writes frames into it at the target's frame rate,
+# dropping and corrupting some on purpose. At the end the decoder's counts
+# are checked against what was injected:
+#
+#   python tlm_decode.py --sim --seconds 5 --drop 0.02 --corrupt 0.01
+#
+# FIELDS must match tlmFields[] in the application, in order.
+#
+
+import os
+import random
+import struct
+import sys
+import termios
+import threading
+import time
+
+#
+# Field name, struct format (little-endian), scale
+#
+FIELDS = [
+    ("tick",        "H", 1),
+    ("vout_dc",     "i", 1.0 / 65536),      # Q16 (V)
+    ("mep_sf",      "h", 1),
+    ("adc",         "H", 1),
+    ("sfo_status",  "H", 1),
+    ("cla_vout",    "f", 1),
+    ("cla_duty",    "f", 1),
+    ("cla_fault",   "H", 1),
+]
+
+SYNC = b"\xa5\x5a"
+HEADER = 7
+PAYLOAD_FMT = "<" + "".join(f[1] for f in FIELDS)
+PAYLOAD_LEN = struct.calcsize(PAYLOAD_FMT)
+BAUD = 115200
+FRAME_HZ = 100
+
+
+def crc16(data):
+    crc = 0xFFFF
+    for b in bytearray(data):
+        crc ^= b << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else crc << 1
+            crc &= 0xFFFF
+    return crc
+
+
+def frame(seq, drops, values):
+    payload = struct.pack(PAYLOAD_FMT, *values)
+    body = struct.pack("<BHH", len(payload), seq & 0xFFFF, drops & 0xFFFF)
+    body += payload
+    return SYNC + body + struct.pack("<H", crc16(body))
+
+
+class Decoder(object):
+    def __init__(self):
+        self.buf = bytearray()
+        self.frames = 0
+        self.crc_errors = 0
+        self.skipped = 0        # Bytes discarded while searching for sync
+        self.bytes = 0
+        self.target_drops = 0
+        self.wire_lost = 0
+        self.last = None        # (seq, drops) of the last good frame
+
+    def feed(self, data):
+        self.bytes += len(data)
+        self.buf += data
+        out = []
+        while True:
+            i = self.buf.find(SYNC)
+            if i < 0:
+                keep = 1 if self.buf[-1:] == SYNC[:1] else 0
+                self.skipped += len(self.buf) - keep
+                del self.buf[:len(self.buf) - keep]
+                return out
+            if i:
+                self.skipped += i
+                del self.buf[:i]
+            if len(self.buf) < HEADER:
+                return out
+            n = HEADER + self.buf[2] + 2
+            if len(self.buf) < n:
+                return out
+            body = bytes(self.buf[2:n - 2])
+            crc, = struct.unpack("<H", bytes(self.buf[n - 2:n]))
+            if crc != crc16(body):
+                self.crc_errors += 1
+                self.skipped += 1
+                del self.buf[:1]
+                continue
+            del self.buf[:n]
+            out.append(self.accept(body))
+
+    def accept(self, body):
+        length, seq, drops = struct.unpack("<BHH", body[:5])
+        if self.last is not None:
+            gap = (seq - self.last[0] - 1) & 0xFFFF
+            dropped = (drops - self.last[1]) & 0xFFFF
+            self.target_drops += min(gap, dropped)
+            self.wire_lost += gap - min(gap, dropped)
+        self.last = (seq, drops)
+        self.frames += 1
+
+        values = None
+        if length == PAYLOAD_LEN:
+            raw = struct.unpack(PAYLOAD_FMT, body[5:])
+            values = [v * f[2] for v, f in zip(raw, FIELDS)]
+        return seq, drops, values
+
+    def stats(self, seconds):
+        return ("%d frames (%.1f/s, %.0f B/s), %d dropped on target, "
+                "%d lost on wire, %d CRC errors, %d bytes skipped"
+                % (self.frames, self.frames / seconds, self.bytes / seconds,
+                   self.target_drops, self.wire_lost, self.crc_errors,
+                   self.skipped))
+
+
+def open_port(path, baud):
+    fd = os.open(path, os.O_RDONLY | os.O_NOCTTY)
+    attr = termios.tcgetattr(fd)
+    speed = getattr(termios, "B%d" % baud)
+    attr[0] = 0                                         # iflag
+    attr[1] = 0                                         # oflag
+    attr[2] = termios.CS8 | termios.CREAD | termios.CLOCAL
+    attr[3] = 0                                         # lflag: raw
+    attr[4] = speed
+    attr[5] = speed
+    attr[6][termios.VMIN] = 0
+    attr[6][termios.VTIME] = 1                          # 100 ms read timeout
+    termios.tcsetattr(fd, termios.TCSANOW, attr)
+    return fd
+
+
+def run(fd, dec, quiet, seconds):
+    start = time.time()
+    report = start + 1
+    while seconds is None or time.time() - start < seconds:
+        data = os.read(fd, 4096)
+        for seq, drops, values in dec.feed(data):
+            if quiet:
+                continue
+            if values is None:
+                print("%5d  unknown layout" % seq)
+            else:
+                print("%5d  " % seq + "  ".join(
+                    "%s=%.4g" % (f[0], v) for f, v in zip(FIELDS, values)))
+        if quiet and time.time() >= report:
+            print(dec.stats(time.time() - start))
+            report += 1
+    return time.time() - start
+
+
+#
+# Stand-in for the target: same frame builder and drop rule as tlmSend(),
+# paced at FRAME_HZ, with wire errors flipped into a byte of the frame
+#
+class Target(threading.Thread):
+    def __init__(self, fd, seconds, drop, corrupt):
+        threading.Thread.__init__(self)
+        self.daemon = True
+        self.fd = fd
+        self.count = int(seconds * FRAME_HZ)
+        self.drop = drop
+        self.corrupt = corrupt
+        self.sent = 0
+        self.dropped = 0
+        self.corrupted = 0
+
+    def run(self):
+        rng = random.Random(1)
+        seq = 0
+        drops = 0
+        for k in range(self.count):
+            if rng.random() < self.drop:
+                seq += 1
+                drops += 1
+                self.dropped += 1
+                continue
+            values = [k & 0xFFFF, int(48.0 * 65536), 60, 2200, 1,
+                      48.0 + rng.random(), 0.4, 0]
+            data = bytearray(frame(seq, drops, values))
+            seq += 1
+            if rng.random() < self.corrupt:
+                data[rng.randrange(len(data))] ^= 0x10
+                self.corrupted += 1
+            else:
+                self.sent += 1
+            os.write(self.fd, bytes(data))
+            time.sleep(1.0 / FRAME_HZ)
+
+
+def sim(seconds, drop, corrupt, quiet):
+    master, slave = os.openpty()
+    fd = open_port(os.ttyname(slave), BAUD)
+    target = Target(master, seconds, drop, corrupt)
+    dec = Decoder()
+
+    target.start()
+    elapsed = run(fd, dec, quiet, seconds + 0.5)
+    target.join()
+    print(dec.stats(elapsed))
+    print("injected: %d sent, %d dropped on target, %d corrupted"
+          % (target.sent, target.dropped, target.corrupted))
+
+    #
+    # A corrupted frame that is followed only by dropped frames up to the
+    # end is not seen as a gap, so allow the tail to fall short
+    #
+    ok = (dec.frames == target.sent and
+          dec.target_drops <= target.dropped and
+          dec.wire_lost <= target.corrupted and
+          dec.target_drops + dec.wire_lost
+          <= target.dropped + target.corrupted)
+    if not ok:
+        sys.stderr.write("tlm_decode: error: counts do not match\n")
+    return 0 if ok else 1
+
+
+def main(argv):
+    args = argv[1:]
+    quiet = "-q" in args
+    args = [a for a in args if a != "-q"]
+
+    if args[:1] == ["--sim"]:
+        opts = {"--seconds": 5.0, "--drop": 0.02, "--corrupt": 0.01}
+        rest = args[1:]
+        while len(rest) >= 2 and rest[0] in opts:
+            opts[rest[0]] = float(rest[1])
+            rest = rest[2:]
+        if rest:
+            sys.stderr.write("tlm_decode: unknown option %s\n" % rest[0])
+            return 2
+        return sim(opts["--seconds"], opts["--drop"], opts["--corrupt"],
+                   quiet)
+
+    if len(args) != 1:
+        sys.stderr.write("usage: tlm_decode.py [-q] <port>\n"
+                         "       tlm_decode.py [-q] --sim [--seconds s] "
+                         "[--drop p] [--corrupt p]\n")
+        return 2
+
+    dec = Decoder()
+    fd = open_port(args[0], BAUD)
+    try:
+        run(fd, dec, quiet, None)
+    except KeyboardInterrupt:
+        pass
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))